@@ -0,0 +1,48 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace A1::Utils
+{
+
+/**
+ * Array is a single contiguous buffer, the header holding the length and the capacity
+ * is followed by the elements. Thus the length is read from the handle itself and the
+ * element is found at the fixed offset from it, without any indirection.
+ */
+struct ArrayHeader
+{
+    std::uint64_t length;
+    std::uint64_t capacity;
+};
+
+/** Offset of the first element from the beginning of the buffer, elements are aligned to it. */
+inline constexpr std::size_t arrayDataOffset{ 16U };
+
+static_assert( sizeof( ArrayHeader ) <= arrayDataOffset );
+
+} // namespace A1::Utils
+
+/**
+ * Runtime of the array type. The array is created on the first append to the null array,
+ * thus zero-initialized storage holds the empty array. Growth doubles the capacity, hence
+ * the append is amortized constant time.
+ *
+ * array_append returns the appended element, zero-initialized. It may reallocate the buffer,
+ * hence it is given the pointer to the handle, which is updated, and the pointers to the
+ * elements are invalidated by it.
+ */
+extern "C"
+{
+    void * array_append( A1::Utils::ArrayHeader ** array, std::uint32_t const elementSize );
+
+    std::uint64_t array_length( A1::Utils::ArrayHeader const * array );
+}
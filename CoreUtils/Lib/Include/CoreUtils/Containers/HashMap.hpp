@@ -0,0 +1,96 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace A1::Utils
+{
+    // fwd
+    class HashMap;
+} // namespace A1::Utils
+
+/**
+ * Runtime of the map type. Keys and values are fixed-size blobs, e.g. integers of the width of
+ * the key type or the bytes of the address, and they are passed by pointer. The map is created
+ * on the first insertion into the null map, thus zero-initialized storage holds the empty map.
+ *
+ * map_get returns null if the key is not present, map_insert returns the value of the key,
+ * zero-initialized if the key was not present. Pointers to the values are invalidated by
+ * the subsequent insertion or erasure.
+ */
+extern "C"
+{
+    void * map_get   ( A1::Utils::HashMap const * map, void const * key );
+    void * map_insert( A1::Utils::HashMap ** map, std::uint32_t const keySize, std::uint32_t const valueSize, void const * key );
+    bool   map_erase ( A1::Utils::HashMap * map, void const * key );
+
+    std::uint64_t map_size( A1::Utils::HashMap const * map );
+}
+
+namespace A1::Utils
+{
+
+/**
+ * Open-addressing hash table with linear probing. One byte of control data per slot holds
+ * either 7 bits of the hash of the key stored in the slot or the empty marker, so that the
+ * lookup matches a whole group of slots at once and compares keys of the matching slots only.
+ * Slots hold the key and the value next to each other, thus the found value is in the cache line
+ * of its key. Erasure shifts the following entries backwards instead of leaving a tombstone,
+ * hence probe sequences never grow longer than they are right after the insertions.
+ *
+ * Storage is allocated with malloc, as the runtime is linked into contracts without the C++ library.
+ */
+class HashMap
+{
+public:
+    HashMap( std::uint32_t const keySize, std::uint32_t const valueSize ) noexcept;
+    ~HashMap();
+
+    HashMap( HashMap const & ) = delete;
+    HashMap & operator=( HashMap const & ) = delete;
+
+    /** Returns the value of the key or null if the key is not present. */
+    [[ nodiscard ]] void * find( void const * key ) const noexcept;
+
+    /** Returns the value of the key, zero-initialized if the key was not present. */
+    [[ nodiscard ]] void * insert( void const * key ) noexcept;
+
+    /** Returns whether the key was present. */
+    bool erase( void const * key ) noexcept;
+
+    [[ nodiscard ]] std::size_t size    () const noexcept { return size_;     }
+    [[ nodiscard ]] std::size_t capacity() const noexcept { return capacity_; }
+
+    /** Fixed-cost hash of the key, it depends on the size of the key only, not on its contents. */
+    [[ nodiscard ]] std::uint64_t hash( void const * key ) const noexcept;
+
+private:
+    [[ nodiscard ]] std::uint8_t * slot( std::size_t const index ) const noexcept { return slots_ + index * slotSize_; }
+
+    [[ nodiscard ]] std::size_t findIndex( void const * key, std::uint64_t const hash ) const noexcept;
+    [[ nodiscard ]] std::size_t findEmpty( std::uint64_t const hash ) const noexcept;
+
+    void setControl( std::size_t const index, std::uint8_t const control ) noexcept;
+    void allocate  ( std::size_t const capacity ) noexcept;
+    void grow      () noexcept;
+
+    std::uint32_t keySize_;
+    std::uint32_t valueSize_;
+    std::uint32_t valueOffset_;
+    std::uint32_t slotSize_;
+
+    std::size_t size_    { 0U };
+    std::size_t capacity_{ 0U };
+
+    std::uint8_t * control_{ nullptr };
+    std::uint8_t * slots_  { nullptr };
+};
+
+} // namespace A1::Utils
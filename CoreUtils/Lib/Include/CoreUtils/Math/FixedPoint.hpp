@@ -0,0 +1,66 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * Runtime of the num type, i.e. of the fixed-point decimals. The compiler emits addition,
+ * subtraction and comparisons inline, as well as multiplication and division by an integer,
+ * only products and quotients of two decimals are left to the runtime.
+ *
+ * The buffer passed to the string conversion has to hold at least 24 characters.
+ */
+extern "C"
+{
+    std::int64_t num_mul( std::int64_t lhs, std::int64_t rhs );
+    std::int64_t num_div( std::int64_t lhs, std::int64_t rhs );
+
+    char * num_to_string( std::int64_t value, char * buffer );
+}
+
+namespace A1::Utils::FixedPoint
+{
+
+/**
+ * Value of the num is the 64-bit integer of its millionths, e.g. 1.25 is 1'250'000.
+ * Scale has to match the decimal places of the number literals supported by the compiler.
+ */
+using Type = std::int64_t;
+
+inline constexpr unsigned decimals{ 6U };
+inline constexpr Type     scale   { 1'000'000 };
+
+/**
+ * Arithmetic wraps around on overflow, as the arithmetic of the integer types. Intermediate
+ * results of the multiplication and division are 128-bit, thus they never overflow
+ * before the rescaling. Results are truncated towards zero, division by zero results in zero.
+ */
+
+[[ nodiscard ]]
+constexpr Type add( Type const lhs, Type const rhs ) noexcept
+{
+    return static_cast< Type >( static_cast< std::uint64_t >( lhs ) + static_cast< std::uint64_t >( rhs ) );
+}
+
+[[ nodiscard ]]
+constexpr Type multiply( Type const lhs, Type const rhs ) noexcept
+{
+    return static_cast< Type >( static_cast< __int128 >( lhs ) * rhs / scale );
+}
+
+[[ nodiscard ]]
+constexpr Type divide( Type const lhs, Type const rhs ) noexcept
+{
+    // Divisor is replaced rather than branched on, so that the division compiles into a select
+    auto const isZero{ rhs == 0 };
+    auto const result{ static_cast< __int128 >( lhs ) * scale / ( rhs + static_cast< Type >( isZero ) ) };
+    return isZero ? 0 : static_cast< Type >( result );
+}
+
+} // namespace A1::Utils::FixedPoint
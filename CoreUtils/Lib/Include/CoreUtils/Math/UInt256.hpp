@@ -0,0 +1,237 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <compare>
+#include <cstdint>
+
+/**
+ * Runtime of the 256-bit integer types. Values are passed as four 64-bit limbs, the least
+ * significant limb first, which is the memory layout of LLVM i256 on little-endian targets.
+ * The compiler emits addition, subtraction, multiplication and shifts inline, only the
+ * division is left to the runtime. Division by zero results in zero quotient and remainder.
+ *
+ * The buffer passed to the string conversions has to hold at least 80 characters.
+ */
+extern "C"
+{
+    void u256_divmod( std::uint64_t const * lhs, std::uint64_t const * rhs, std::uint64_t * quotient, std::uint64_t * remainder );
+    void i256_divmod( std::uint64_t const * lhs, std::uint64_t const * rhs, std::uint64_t * quotient, std::uint64_t * remainder );
+
+    char * u256_to_string( std::uint64_t const * value, char * buffer );
+    char * i256_to_string( std::uint64_t const * value, char * buffer );
+}
+
+namespace A1::Utils
+{
+
+/**
+ * Unsigned 256-bit integer of 64-bit limbs, the least significant limb first.
+ * Arithmetic wraps around modulo 2^256, as the arithmetic of the unsigned built-in types.
+ */
+struct UInt256
+{
+    static constexpr std::size_t limbsCount{ 4U };
+
+    std::array< std::uint64_t, limbsCount > limbs{};
+
+    constexpr UInt256() noexcept = default;
+    constexpr UInt256( std::uint64_t const value ) noexcept : limbs{ value, 0U, 0U, 0U } {}
+    constexpr UInt256( std::array< std::uint64_t, limbsCount > const value ) noexcept : limbs{ value } {}
+
+    /** Checks whether the value fits in the least significant limb. */
+    [[ nodiscard ]] constexpr bool isSmall() const noexcept { return ( limbs[ 1U ] | limbs[ 2U ] | limbs[ 3U ] ) == 0U; }
+
+    [[ nodiscard ]] constexpr bool isNegative() const noexcept { return ( limbs[ limbsCount - 1U ] >> 63U ) != 0U; }
+
+    /** Number of significant bits, i.e. 0 for zero. */
+    [[ nodiscard ]]
+    constexpr std::size_t bitWidth() const noexcept
+    {
+        for ( auto i{ limbsCount }; i > 0U; --i )
+        {
+            if ( limbs[ i - 1U ] != 0U ) { return ( i - 1U ) * 64U + std::bit_width( limbs[ i - 1U ] ); }
+        }
+        return 0U;
+    }
+
+    [[ nodiscard ]] friend constexpr bool operator==( UInt256 const &, UInt256 const & ) noexcept = default;
+
+    [[ nodiscard ]]
+    friend constexpr std::strong_ordering operator<=>( UInt256 const & lhs, UInt256 const & rhs ) noexcept
+    {
+        for ( auto i{ limbsCount }; i > 0U; --i )
+        {
+            if ( lhs.limbs[ i - 1U ] != rhs.limbs[ i - 1U ] ) { return lhs.limbs[ i - 1U ] <=> rhs.limbs[ i - 1U ]; }
+        }
+        return std::strong_ordering::equal;
+    }
+
+    [[ nodiscard ]]
+    friend constexpr UInt256 operator+( UInt256 const & lhs, UInt256 const & rhs ) noexcept
+    {
+        if ( lhs.isSmall() && rhs.isSmall() )
+        {
+            auto const sum{ lhs.limbs[ 0U ] + rhs.limbs[ 0U ] };
+            return { { sum, sum < lhs.limbs[ 0U ] ? 1U : 0U, 0U, 0U } };
+        }
+
+        UInt256       result;
+        std::uint64_t carry { 0U };
+        for ( std::size_t i{ 0U }; i < limbsCount; ++i )
+        {
+            auto const sum{ lhs.limbs[ i ] + rhs.limbs[ i ] };
+            result.limbs[ i ] = sum + carry;
+            carry = ( sum < lhs.limbs[ i ] ) | ( result.limbs[ i ] < sum );
+        }
+        return result;
+    }
+
+    [[ nodiscard ]]
+    friend constexpr UInt256 operator-( UInt256 const & lhs, UInt256 const & rhs ) noexcept
+    {
+        UInt256       result;
+        std::uint64_t borrow{ 0U };
+        for ( std::size_t i{ 0U }; i < limbsCount; ++i )
+        {
+            auto const difference{ lhs.limbs[ i ] - rhs.limbs[ i ] };
+            result.limbs[ i ] = difference - borrow;
+            borrow = ( lhs.limbs[ i ] < rhs.limbs[ i ] ) | ( difference < borrow );
+        }
+        return result;
+    }
+
+    [[ nodiscard ]]
+    friend constexpr UInt256 operator*( UInt256 const & lhs, UInt256 const & rhs ) noexcept
+    {
+        if ( lhs.isSmall() && rhs.isSmall() )
+        {
+            auto const [ high, low ]{ multiply( lhs.limbs[ 0U ], rhs.limbs[ 0U ] ) };
+            return { { low, high, 0U, 0U } };
+        }
+
+        // Products of the limbs which end up above 2^256 are not computed at all
+        UInt256 result;
+        for ( std::size_t i{ 0U }; i < limbsCount; ++i )
+        {
+            if ( lhs.limbs[ i ] == 0U ) { continue; }
+
+            std::uint64_t carry{ 0U };
+            for ( std::size_t j{ 0U }; i + j < limbsCount; ++j )
+            {
+                auto [ high, low ]{ multiply( lhs.limbs[ i ], rhs.limbs[ j ] ) };
+
+                low += carry;
+                high += low < carry;
+
+                result.limbs[ i + j ] += low;
+                high += result.limbs[ i + j ] < low;
+
+                carry = high;
+            }
+        }
+        return result;
+    }
+
+    [[ nodiscard ]]
+    friend constexpr UInt256 operator<<( UInt256 const & value, std::size_t const shift ) noexcept
+    {
+        if ( shift >= limbsCount * 64U ) { return {}; }
+
+        auto const limbShift{ shift / 64U };
+        auto const bitShift { shift % 64U };
+
+        UInt256 result;
+        for ( auto i{ limbsCount }; i > limbShift; --i )
+        {
+            auto const index{ i - 1U };
+            result.limbs[ index ] = value.limbs[ index - limbShift ] << bitShift;
+            if ( bitShift != 0U && index > limbShift )
+            {
+                result.limbs[ index ] |= value.limbs[ index - limbShift - 1U ] >> ( 64U - bitShift );
+            }
+        }
+        return result;
+    }
+
+    [[ nodiscard ]]
+    friend constexpr UInt256 operator>>( UInt256 const & value, std::size_t const shift ) noexcept
+    {
+        if ( shift >= limbsCount * 64U ) { return {}; }
+
+        auto const limbShift{ shift / 64U };
+        auto const bitShift { shift % 64U };
+
+        UInt256 result;
+        for ( std::size_t i{ 0U }; i + limbShift < limbsCount; ++i )
+        {
+            result.limbs[ i ] = value.limbs[ i + limbShift ] >> bitShift;
+            if ( bitShift != 0U && i + limbShift + 1U < limbsCount )
+            {
+                result.limbs[ i ] |= value.limbs[ i + limbShift + 1U ] << ( 64U - bitShift );
+            }
+        }
+        return result;
+    }
+
+    /** Two's complement negation, i.e. the value of the signed 256-bit integer of the opposite sign. */
+    [[ nodiscard ]]
+    friend constexpr UInt256 operator-( UInt256 const & value ) noexcept
+    {
+        return UInt256{} - value;
+    }
+
+    struct Product
+    {
+        std::uint64_t high{ 0U };
+        std::uint64_t low { 0U };
+    };
+
+    /** Full 128-bit product of two limbs. */
+    [[ nodiscard ]]
+    static constexpr Product multiply( std::uint64_t const lhs, std::uint64_t const rhs ) noexcept
+    {
+#if defined( __SIZEOF_INT128__ )
+        auto const product{ static_cast< unsigned __int128 >( lhs ) * rhs };
+        return { .high = static_cast< std::uint64_t >( product >> 64U ), .low = static_cast< std::uint64_t >( product ) };
+#else
+        constexpr std::uint64_t mask{ 0xFFFFFFFFU };
+
+        auto const lowLow  { ( lhs & mask ) * ( rhs & mask ) };
+        auto const highLow { ( lhs >> 32U ) * ( rhs & mask ) };
+        auto const lowHigh { ( lhs & mask ) * ( rhs >> 32U ) };
+        auto const highHigh{ ( lhs >> 32U ) * ( rhs >> 32U ) };
+
+        auto const middle{ ( lowLow >> 32U ) + ( highLow & mask ) + lowHigh };
+        return
+        {
+            .high = highHigh + ( highLow >> 32U ) + ( middle >> 32U ),
+            .low  = ( middle << 32U ) | ( lowLow & mask )
+        };
+#endif
+    }
+};
+
+struct DivisionResult
+{
+    UInt256 quotient {};
+    UInt256 remainder{};
+};
+
+/** Unsigned division, division by zero results in zero quotient and remainder. */
+[[ nodiscard ]] DivisionResult divide( UInt256 const & lhs, UInt256 const & rhs ) noexcept;
+
+/**
+ * Signed division of the values in two's complement, truncating the quotient towards zero.
+ * Remainder takes the sign of the dividend, as in C++.
+ */
+[[ nodiscard ]] DivisionResult divideSigned( UInt256 const & lhs, UInt256 const & rhs ) noexcept;
+
+} // namespace A1::Utils
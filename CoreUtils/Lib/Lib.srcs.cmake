@@ -1,6 +1,10 @@
 set( SOURCES
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Containers/Array.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Containers/HashMap.cpp
     ${CMAKE_CURRENT_LIST_DIR}/Source/Crypto/Ripemd160.cpp
     ${CMAKE_CURRENT_LIST_DIR}/Source/Crypto/Sha512.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Math/FixedPoint.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Math/UInt256.cpp
     ${CMAKE_CURRENT_LIST_DIR}/Source/Utf8.cpp
     ${CMAKE_CURRENT_LIST_DIR}/Source/Utils.cpp
 )
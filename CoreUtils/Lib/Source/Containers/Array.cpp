@@ -0,0 +1,54 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreUtils/Containers/Array.hpp>
+
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    constexpr std::uint64_t minCapacity{ 4U };
+
+    [[ nodiscard ]]
+    std::uint8_t * getData( A1::Utils::ArrayHeader * array ) noexcept
+    {
+        return reinterpret_cast< std::uint8_t * >( array ) + A1::Utils::arrayDataOffset;
+    }
+} // namespace
+
+extern "C"
+{
+    void * array_append( A1::Utils::ArrayHeader ** array, std::uint32_t const elementSize )
+    {
+        auto * header{ *array };
+        if ( header == nullptr || header->length == header->capacity )
+        {
+            auto const capacity{ header == nullptr ? minCapacity : header->capacity * 2U };
+
+            // Storage is allocated with malloc, as the runtime is linked into contracts without the C++ library
+            auto * grown{ static_cast< A1::Utils::ArrayHeader * >( std::realloc( header, A1::Utils::arrayDataOffset + capacity * elementSize ) ) };
+            if ( grown == nullptr ) { std::abort(); }
+
+            if ( header == nullptr ) { grown->length = 0U; }
+            grown->capacity = capacity;
+
+            *array = header = grown;
+        }
+
+        auto * element{ getData( header ) + header->length * elementSize };
+        std::memset( element, 0, elementSize );
+
+        ++header->length;
+        return element;
+    }
+
+    std::uint64_t array_length( A1::Utils::ArrayHeader const * array )
+    {
+        return array != nullptr ? array->length : 0U;
+    }
+}
@@ -0,0 +1,379 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreUtils/Containers/HashMap.hpp>
+
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#if defined( __SSE2__ )
+#   include <emmintrin.h>
+#elif defined( __wasm_simd128__ )
+#   include <wasm_simd128.h>
+#endif
+
+namespace
+{
+    /** Control byte of the empty slot, control bytes of the full slots hold 7 bits of the hash. */
+    constexpr std::uint8_t empty{ 0x80U };
+
+    [[ nodiscard ]] constexpr std::uint8_t getControl( std::uint64_t const hash ) noexcept { return static_cast< std::uint8_t >( hash & 0x7FU ); }
+    [[ nodiscard ]] constexpr std::uint64_t getHome  ( std::uint64_t const hash ) noexcept { return hash >> 7U; }
+
+    /** Slots within the group, each slot takes 2^Shift bits of the mask. */
+    template< unsigned Shift >
+    struct BitMask
+    {
+        std::uint64_t bits{ 0U };
+
+        [[ nodiscard ]] explicit operator bool() const noexcept { return bits != 0U; }
+
+        [[ nodiscard ]] std::size_t lowest() const noexcept { return static_cast< std::size_t >( std::countr_zero( bits ) ) >> Shift; }
+
+        void removeLowest() noexcept { bits &= bits - 1U; }
+    };
+
+#if defined( __SSE2__ )
+    struct Group
+    {
+        static constexpr std::size_t width{ 16U };
+
+        explicit Group( std::uint8_t const * control ) noexcept
+        : control_{ _mm_loadu_si128( reinterpret_cast< __m128i const * >( control ) ) }
+        {}
+
+        [[ nodiscard ]]
+        BitMask< 0U > match( std::uint8_t const control ) const noexcept
+        {
+            auto const matches{ _mm_cmpeq_epi8( _mm_set1_epi8( static_cast< char >( control ) ), control_ ) };
+            return { static_cast< std::uint64_t >( _mm_movemask_epi8( matches ) ) };
+        }
+
+        [[ nodiscard ]] BitMask< 0U > matchEmpty() const noexcept { return { static_cast< std::uint64_t >( _mm_movemask_epi8( control_ ) ) }; }
+
+    private:
+        __m128i control_;
+    };
+#elif defined( __wasm_simd128__ )
+    struct Group
+    {
+        static constexpr std::size_t width{ 16U };
+
+        explicit Group( std::uint8_t const * control ) noexcept
+        : control_{ wasm_v128_load( control ) }
+        {}
+
+        [[ nodiscard ]]
+        BitMask< 0U > match( std::uint8_t const control ) const noexcept
+        {
+            return { wasm_i8x16_bitmask( wasm_i8x16_eq( wasm_i8x16_splat( static_cast< std::int8_t >( control ) ), control_ ) ) };
+        }
+
+        [[ nodiscard ]] BitMask< 0U > matchEmpty() const noexcept { return { wasm_i8x16_bitmask( control_ ) }; }
+
+    private:
+        v128_t control_;
+    };
+#else
+    /** Group of 8 slots matched within the 64-bit word, for the targets without SIMD instructions. */
+    struct Group
+    {
+        static constexpr std::size_t width{ 8U };
+
+        explicit Group( std::uint8_t const * control ) noexcept
+        {
+            std::memcpy( &control_, control, sizeof( control_ ) );
+            if constexpr ( std::endian::native == std::endian::big ) { control_ = __builtin_bswap64( control_ ); }
+        }
+
+        /**
+         * Byte-wise comparison may report the byte following the matching one as a match as well,
+         * such false matches are filtered out by comparing the keys. Empty slots never match.
+         */
+        [[ nodiscard ]]
+        BitMask< 3U > match( std::uint8_t const control ) const noexcept
+        {
+            auto const difference{ control_ ^ ( lsbs * control ) };
+            return { ( difference - lsbs ) & ~difference & ~control_ & msbs };
+        }
+
+        [[ nodiscard ]] BitMask< 3U > matchEmpty() const noexcept { return { control_ & msbs }; }
+
+    private:
+        static constexpr std::uint64_t lsbs{ 0x0101010101010101ULL };
+        static constexpr std::uint64_t msbs{ 0x8080808080808080ULL };
+
+        std::uint64_t control_;
+    };
+#endif
+
+    struct Product
+    {
+        std::uint64_t low;
+        std::uint64_t high;
+    };
+
+    [[ nodiscard ]]
+    constexpr Product multiply( std::uint64_t const lhs, std::uint64_t const rhs ) noexcept
+    {
+        auto const product{ static_cast< unsigned __int128 >( lhs ) * rhs };
+        return { static_cast< std::uint64_t >( product ), static_cast< std::uint64_t >( product >> 64U ) };
+    }
+
+    /** Folds the 128-bit product, the mixing step of the wyhash family of hashes. */
+    [[ nodiscard ]]
+    constexpr std::uint64_t mix( std::uint64_t const lhs, std::uint64_t const rhs ) noexcept
+    {
+        auto const [ low, high ]{ multiply( lhs, rhs ) };
+        return low ^ high;
+    }
+
+    [[ nodiscard ]]
+    std::uint64_t load64( std::uint8_t const * data ) noexcept
+    {
+        std::uint64_t value;
+        std::memcpy( &value, data, sizeof( value ) );
+        return value;
+    }
+
+    [[ nodiscard ]]
+    std::uint64_t load32( std::uint8_t const * data ) noexcept
+    {
+        std::uint32_t value;
+        std::memcpy( &value, data, sizeof( value ) );
+        return value;
+    }
+
+    [[ nodiscard ]]
+    constexpr std::uint32_t alignUp( std::uint32_t const size ) noexcept
+    {
+        return ( size + 7U ) & ~7U;
+    }
+
+    void * allocateOrAbort( std::size_t const size ) noexcept
+    {
+        auto * memory{ std::malloc( size ) };
+        if ( memory == nullptr ) { std::abort(); }
+        return memory;
+    }
+
+    /** Hash table never gets full, as the load factor is kept below 3/4, hence every probe sequence ends. */
+    constexpr std::size_t maxLoadNumerator  { 3U };
+    constexpr std::size_t maxLoadDenominator{ 4U };
+} // namespace
+
+extern "C"
+{
+    void * map_get( A1::Utils::HashMap const * map, void const * key )
+    {
+        return map != nullptr ? map->find( key ) : nullptr;
+    }
+
+    void * map_insert( A1::Utils::HashMap ** map, std::uint32_t const keySize, std::uint32_t const valueSize, void const * key )
+    {
+        if ( *map == nullptr )
+        {
+            *map = new ( allocateOrAbort( sizeof( A1::Utils::HashMap ) ) ) A1::Utils::HashMap{ keySize, valueSize };
+        }
+        return ( *map )->insert( key );
+    }
+
+    bool map_erase( A1::Utils::HashMap * map, void const * key )
+    {
+        return map != nullptr && map->erase( key );
+    }
+
+    std::uint64_t map_size( A1::Utils::HashMap const * map )
+    {
+        return map != nullptr ? map->size() : 0U;
+    }
+}
+
+namespace A1::Utils
+{
+
+HashMap::HashMap( std::uint32_t const keySize, std::uint32_t const valueSize ) noexcept
+: keySize_    { keySize                                },
+  valueSize_  { valueSize                              },
+  valueOffset_{ alignUp( keySize )                     },
+  slotSize_   { alignUp( keySize ) + alignUp( valueSize ) }
+{
+    allocate( Group::width );
+}
+
+HashMap::~HashMap()
+{
+    std::free( control_ );
+    std::free( slots_   );
+}
+
+void * HashMap::find( void const * key ) const noexcept
+{
+    auto const index{ findIndex( key, hash( key ) ) };
+    return index != capacity_ ? slot( index ) + valueOffset_ : nullptr;
+}
+
+void * HashMap::insert( void const * key ) noexcept
+{
+    auto const keyHash{ hash( key ) };
+    if ( auto const index{ findIndex( key, keyHash ) }; index != capacity_ )
+    {
+        return slot( index ) + valueOffset_;
+    }
+
+    if ( ( size_ + 1U ) * maxLoadDenominator > capacity_ * maxLoadNumerator ) { grow(); }
+
+    auto const index{ findEmpty( keyHash ) };
+    setControl( index, getControl( keyHash ) );
+
+    auto * entry{ slot( index ) };
+    std::memcpy( entry, key, keySize_ );
+    std::memset( entry + valueOffset_, 0, valueSize_ );
+
+    ++size_;
+    return entry + valueOffset_;
+}
+
+bool HashMap::erase( void const * key ) noexcept
+{
+    auto index{ findIndex( key, hash( key ) ) };
+    if ( index == capacity_ ) { return false; }
+
+    // Following entries of the probe sequence are shifted into the hole, unless they would end up before their home slot
+    auto const mask{ capacity_ - 1U };
+    for ( auto next{ ( index + 1U ) & mask }; control_[ next ] != empty; next = ( next + 1U ) & mask )
+    {
+        auto const home{ getHome( hash( slot( next ) ) ) & mask };
+        if ( ( ( next - home ) & mask ) < ( ( next - index ) & mask ) ) { continue; }
+
+        std::memcpy( slot( index ), slot( next ), slotSize_ );
+        setControl( index, control_[ next ] );
+        index = next;
+    }
+
+    setControl( index, empty );
+    --size_;
+    return true;
+}
+
+std::uint64_t HashMap::hash( void const * key ) const noexcept
+{
+    static constexpr std::uint64_t seeds[]{ 0xa0761d6478bd642fULL, 0xe7037ed1a0b428dbULL };
+
+    auto const * data{ static_cast< std::uint8_t const * >( key ) };
+    auto         seed{ seeds[ 0U ] ^ keySize_ };
+
+    std::uint64_t first { 0U };
+    std::uint64_t second{ 0U };
+    if ( keySize_ <= 16U )
+    {
+        // Words overlap for the keys which are not a multiple of the word size
+        if ( keySize_ >= 8U )
+        {
+            first  = load64( data );
+            second = load64( data + keySize_ - 8U );
+        }
+        else if ( keySize_ >= 4U )
+        {
+            first  = load32( data );
+            second = load32( data + keySize_ - 4U );
+        }
+        else if ( keySize_ > 0U )
+        {
+            first = ( std::uint64_t{ data[ 0U ] } << 16U ) | ( std::uint64_t{ data[ keySize_ / 2U ] } << 8U ) | data[ keySize_ - 1U ];
+        }
+    }
+    else
+    {
+        // Longer keys, e.g. addresses or 256-bit integers, are consumed 16 bytes at a time, the last block overlapping the previous one
+        for ( std::size_t i{ 0U }; i + 16U < keySize_; i += 16U )
+        {
+            seed = mix( load64( data + i ) ^ seeds[ 1U ], load64( data + i + 8U ) ^ seed );
+        }
+        first  = load64( data + keySize_ - 16U );
+        second = load64( data + keySize_ - 8U  );
+    }
+
+    auto const [ low, high ]{ multiply( first ^ seeds[ 1U ], second ^ seed ) };
+    return mix( low ^ seeds[ 0U ] ^ keySize_, high ^ seeds[ 1U ] );
+}
+
+std::size_t HashMap::findIndex( void const * key, std::uint64_t const hash ) const noexcept
+{
+    auto const mask   { capacity_ - 1U };
+    auto const control{ getControl( hash ) };
+
+    // Entries are never stored past an empty slot of their probe sequence
+    for ( auto position{ getHome( hash ) & mask }; ; position = ( position + Group::width ) & mask )
+    {
+        Group const group{ control_ + position };
+        for ( auto match{ group.match( control ) }; match; match.removeLowest() )
+        {
+            auto const index{ ( position + match.lowest() ) & mask };
+            if ( std::memcmp( slot( index ), key, keySize_ ) == 0 ) { return index; }
+        }
+
+        if ( group.matchEmpty() ) { return capacity_; }
+    }
+}
+
+std::size_t HashMap::findEmpty( std::uint64_t const hash ) const noexcept
+{
+    auto const mask{ capacity_ - 1U };
+    for ( auto position{ getHome( hash ) & mask }; ; position = ( position + Group::width ) & mask )
+    {
+        if ( auto const match{ Group{ control_ + position }.matchEmpty() } )
+        {
+            return ( position + match.lowest() ) & mask;
+        }
+    }
+}
+
+void HashMap::setControl( std::size_t const index, std::uint8_t const control ) noexcept
+{
+    // Control bytes of the first slots are mirrored past the end, so that the group starting at the last slots is loaded at once
+    control_[ index ] = control;
+    if ( index < Group::width - 1U ) { control_[ capacity_ + index ] = control; }
+}
+
+void HashMap::allocate( std::size_t const capacity ) noexcept
+{
+    capacity_ = capacity;
+
+    control_ = static_cast< std::uint8_t * >( allocateOrAbort( capacity + Group::width ) );
+    slots_   = static_cast< std::uint8_t * >( allocateOrAbort( capacity * slotSize_ ) );
+
+    std::memset( control_, empty, capacity + Group::width );
+}
+
+void HashMap::grow() noexcept
+{
+    auto * const control { control_  };
+    auto * const slots   { slots_    };
+    auto   const capacity{ capacity_ };
+
+    allocate( capacity * 2U );
+
+    // Keys are unique, thus entries are moved to the first empty slot of their probe sequence without comparing keys
+    for ( std::size_t i{ 0U }; i < capacity; ++i )
+    {
+        if ( control[ i ] == empty ) { continue; }
+
+        auto const * entry{ slots + i * slotSize_ };
+        auto const   index{ findEmpty( hash( entry ) ) };
+
+        setControl( index, control[ i ] );
+        std::memcpy( slot( index ), entry, slotSize_ );
+    }
+
+    std::free( control );
+    std::free( slots   );
+}
+
+} // namespace A1::Utils
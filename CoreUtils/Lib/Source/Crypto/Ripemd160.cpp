@@ -10,6 +10,8 @@
 #include "Utils.hpp"
 
 #include <array>
+#include <cstdlib>
+#include <cstring>
 
 extern "C"
 {
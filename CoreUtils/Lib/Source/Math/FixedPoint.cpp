@@ -0,0 +1,64 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreUtils/Math/FixedPoint.hpp>
+
+extern "C"
+{
+    std::int64_t num_mul( std::int64_t const lhs, std::int64_t const rhs )
+    {
+        return A1::Utils::FixedPoint::multiply( lhs, rhs );
+    }
+
+    std::int64_t num_div( std::int64_t const lhs, std::int64_t const rhs )
+    {
+        return A1::Utils::FixedPoint::divide( lhs, rhs );
+    }
+
+    /** Writes the integral part and the fraction without trailing zeros, if any, e.g. '-1.25' or '3'. */
+    char * num_to_string( std::int64_t const value, char * buffer )
+    {
+        using namespace A1::Utils;
+
+        // Magnitude is unsigned, as the magnitude of the minimal value does not fit in the signed type
+        auto const magnitude{ value < 0 ? 0U - static_cast< std::uint64_t >( value ) : static_cast< std::uint64_t >( value ) };
+
+        auto integral{ magnitude / FixedPoint::scale };
+        auto fraction{ magnitude % FixedPoint::scale };
+
+        char   digits[ 24U ];
+        auto * end  { digits + sizeof( digits ) };
+        auto * begin{ end };
+
+        if ( fraction != 0U )
+        {
+            auto places{ FixedPoint::decimals };
+            for ( ; fraction % 10U == 0U; fraction /= 10U ) { --places; }
+
+            for ( ; places > 0U; --places, fraction /= 10U )
+            {
+                *--begin = static_cast< char >( '0' + fraction % 10U );
+            }
+            *--begin = '.';
+        }
+
+        do
+        {
+            *--begin = static_cast< char >( '0' + integral % 10U );
+            integral /= 10U;
+        }
+        while ( integral != 0U );
+
+        if ( value < 0 ) { *--begin = '-'; }
+
+        auto * out{ buffer };
+        while ( begin != end ) { *out++ = *begin++; }
+        *out = '\0';
+
+        return buffer;
+    }
+}
@@ -0,0 +1,262 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreUtils/Math/UInt256.hpp>
+
+#include <cstring>
+
+namespace
+{
+    using A1::Utils::UInt256;
+
+    [[ nodiscard ]]
+    UInt256 read( std::uint64_t const * limbs ) noexcept
+    {
+        UInt256 value;
+        std::memcpy( std::data( value.limbs ), limbs, sizeof( value.limbs ) );
+        return value;
+    }
+
+    void write( UInt256 const & value, std::uint64_t * limbs ) noexcept
+    {
+        std::memcpy( limbs, std::data( value.limbs ), sizeof( value.limbs ) );
+    }
+
+    /** Writes decimal digits of the value, preceded by the sign if any, and returns the buffer. */
+    char * toString( UInt256 value, bool const isNegative, char * buffer ) noexcept
+    {
+        // 10^19 is the greatest power of 10 which fits in a limb, thus digits are extracted 19 at a time
+        constexpr std::uint64_t chunk      { 10'000'000'000'000'000'000ULL };
+        constexpr std::size_t   chunkDigits{ 19U };
+
+        char   digits[ 80U ];
+        auto * end  { digits + sizeof( digits ) };
+        auto * begin{ end };
+
+        do
+        {
+            auto const [ quotient, remainder ]{ A1::Utils::divide( value, chunk ) };
+
+            // Chunks other than the most significant one are padded with zeros
+            auto const isLast{ quotient == UInt256{} };
+
+            auto part{ remainder.limbs[ 0U ] };
+            for ( std::size_t i{ 0U }; i < chunkDigits; ++i )
+            {
+                *--begin = static_cast< char >( '0' + part % 10U );
+                part /= 10U;
+
+                if ( isLast && part == 0U ) { break; }
+            }
+            value = quotient;
+        }
+        while ( value != UInt256{} );
+
+        auto * out{ buffer };
+        if ( isNegative ) { *out++ = '-'; }
+
+        auto const length{ static_cast< std::size_t >( end - begin ) };
+        std::memcpy( out, begin, length );
+        out[ length ] = '\0';
+        return buffer;
+    }
+} // namespace
+
+extern "C"
+{
+    void u256_divmod( std::uint64_t const * lhs, std::uint64_t const * rhs, std::uint64_t * quotient, std::uint64_t * remainder )
+    {
+        auto const result{ A1::Utils::divide( read( lhs ), read( rhs ) ) };
+        write( result.quotient , quotient  );
+        write( result.remainder, remainder );
+    }
+
+    void i256_divmod( std::uint64_t const * lhs, std::uint64_t const * rhs, std::uint64_t * quotient, std::uint64_t * remainder )
+    {
+        auto const result{ A1::Utils::divideSigned( read( lhs ), read( rhs ) ) };
+        write( result.quotient , quotient  );
+        write( result.remainder, remainder );
+    }
+
+    char * u256_to_string( std::uint64_t const * value, char * buffer )
+    {
+        return toString( read( value ), false, buffer );
+    }
+
+    char * i256_to_string( std::uint64_t const * value, char * buffer )
+    {
+        auto const number{ read( value ) };
+        return number.isNegative() ? toString( -number, true, buffer ) : toString( number, false, buffer );
+    }
+}
+
+namespace A1::Utils
+{
+
+namespace
+{
+#if defined( __SIZEOF_INT128__ )
+    using UInt128 = unsigned __int128;
+
+    /** Division by the single limb, which is the common case, e.g. when converting to decimal. */
+    [[ nodiscard ]]
+    DivisionResult divideByLimb( UInt256 const & lhs, std::uint64_t const rhs ) noexcept
+    {
+        DivisionResult result;
+
+        UInt128 remainder{ 0U };
+        for ( auto i{ UInt256::limbsCount }; i > 0U; --i )
+        {
+            auto const dividend{ ( remainder << 64U ) | lhs.limbs[ i - 1U ] };
+            result.quotient.limbs[ i - 1U ] = static_cast< std::uint64_t >( dividend / rhs );
+            remainder = dividend % rhs;
+        }
+        result.remainder = static_cast< std::uint64_t >( remainder );
+
+        return result;
+    }
+
+    /**
+     * Long division of multi-limb values, i.e. algorithm D from Knuth's TAOCP, vol. 2, 4.3.1.
+     * Digits of the quotient are estimated from the leading limbs of the normalized operands.
+     */
+    [[ nodiscard ]]
+    DivisionResult divideLong( UInt256 const & lhs, UInt256 const & rhs ) noexcept
+    {
+        constexpr auto    limbs{ UInt256::limbsCount };
+        constexpr UInt128 base { UInt128{ 1U } << 64U };
+
+        auto const n{ ( rhs.bitWidth() + 63U ) / 64U };
+        auto const m{ ( lhs.bitWidth() + 63U ) / 64U };
+
+        // Normalize, so that the most significant bit of the divisor is set
+        auto const shift  { static_cast< unsigned >( std::countl_zero( rhs.limbs[ n - 1U ] ) ) };
+        auto const divisor{ rhs << shift };
+
+        std::uint64_t dividend[ limbs + 1U ]{};
+        {
+            auto const shifted{ lhs << shift };
+            for ( std::size_t i{ 0U }; i < limbs; ++i ) { dividend[ i ] = shifted.limbs[ i ]; }
+            dividend[ limbs ] = shift != 0U ? lhs.limbs[ limbs - 1U ] >> ( 64U - shift ) : 0U;
+        }
+
+        DivisionResult result;
+        for ( auto j{ m - n + 1U }; j > 0U; --j )
+        {
+            auto const k{ j - 1U };
+
+            auto const numerator{ ( UInt128{ dividend[ k + n ] } << 64U ) | dividend[ k + n - 1U ] };
+            auto       estimate { numerator / divisor.limbs[ n - 1U ] };
+            auto       rest     { numerator % divisor.limbs[ n - 1U ] };
+
+            while
+            (
+                estimate >= base ||
+                ( n > 1U && estimate * divisor.limbs[ n - 2U ] > ( ( rest << 64U ) | dividend[ k + n - 2U ] ) )
+            )
+            {
+                --estimate;
+                rest += divisor.limbs[ n - 1U ];
+                if ( rest >= base ) { break; }
+            }
+
+            // Multiply and subtract
+            std::uint64_t carry { 0U };
+            std::uint64_t borrow{ 0U };
+            for ( std::size_t i{ 0U }; i <= n; ++i )
+            {
+                auto const product{ i < n ? estimate * divisor.limbs[ i ] + carry : UInt128{ carry } };
+                carry = static_cast< std::uint64_t >( product >> 64U );
+
+                auto const low       { static_cast< std::uint64_t >( product ) };
+                auto const difference{ dividend[ k + i ] - low };
+                auto const newBorrow { ( dividend[ k + i ] < low ) + ( difference < borrow ) };
+
+                dividend[ k + i ] = difference - borrow;
+                borrow = static_cast< std::uint64_t >( newBorrow );
+            }
+
+            auto digit{ static_cast< std::uint64_t >( estimate ) };
+            if ( borrow != 0U )
+            {
+                // Estimate was one too large, add the divisor back
+                --digit;
+
+                std::uint64_t sumCarry{ 0U };
+                for ( std::size_t i{ 0U }; i < n; ++i )
+                {
+                    auto const sum{ UInt128{ dividend[ k + i ] } + divisor.limbs[ i ] + sumCarry };
+                    dividend[ k + i ] = static_cast< std::uint64_t >( sum );
+                    sumCarry = static_cast< std::uint64_t >( sum >> 64U );
+                }
+                dividend[ k + n ] += sumCarry;
+            }
+
+            result.quotient.limbs[ k ] = digit;
+        }
+
+        UInt256 remainder;
+        for ( std::size_t i{ 0U }; i < limbs; ++i ) { remainder.limbs[ i ] = dividend[ i ]; }
+        result.remainder = remainder >> shift;
+
+        return result;
+    }
+#else
+    /** Restoring division, one bit at a time, for the targets without 128-bit arithmetic. */
+    [[ nodiscard ]]
+    DivisionResult divideLong( UInt256 const & lhs, UInt256 const & rhs ) noexcept
+    {
+        DivisionResult result;
+        for ( auto i{ lhs.bitWidth() }; i > 0U; --i )
+        {
+            auto const bit{ i - 1U };
+            result.remainder = ( result.remainder << 1U ) + UInt256{ ( lhs.limbs[ bit / 64U ] >> ( bit % 64U ) ) & 1U };
+            if ( result.remainder >= rhs )
+            {
+                result.remainder = result.remainder - rhs;
+                result.quotient.limbs[ bit / 64U ] |= std::uint64_t{ 1U } << ( bit % 64U );
+            }
+        }
+        return result;
+    }
+
+    [[ nodiscard ]]
+    DivisionResult divideByLimb( UInt256 const & lhs, std::uint64_t const rhs ) noexcept
+    {
+        return divideLong( lhs, rhs );
+    }
+#endif
+} // namespace
+
+DivisionResult divide( UInt256 const & lhs, UInt256 const & rhs ) noexcept
+{
+    if ( rhs == UInt256{} ) { return {}; }
+
+    if ( lhs.isSmall() && rhs.isSmall() )
+    {
+        return { .quotient = lhs.limbs[ 0U ] / rhs.limbs[ 0U ], .remainder = lhs.limbs[ 0U ] % rhs.limbs[ 0U ] };
+    }
+
+    if ( lhs < rhs ) { return { .quotient = {}, .remainder = lhs }; }
+
+    return rhs.isSmall() ? divideByLimb( lhs, rhs.limbs[ 0U ] ) : divideLong( lhs, rhs );
+}
+
+DivisionResult divideSigned( UInt256 const & lhs, UInt256 const & rhs ) noexcept
+{
+    auto const isLhsNegative{ lhs.isNegative() };
+    auto const isRhsNegative{ rhs.isNegative() };
+
+    auto result{ divide( isLhsNegative ? -lhs : lhs, isRhsNegative ? -rhs : rhs ) };
+
+    if ( isLhsNegative != isRhsNegative ) { result.quotient  = -result.quotient;  }
+    if ( isLhsNegative                  ) { result.remainder = -result.remainder; }
+
+    return result;
+}
+
+} // namespace A1::Utils
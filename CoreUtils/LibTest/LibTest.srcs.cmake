@@ -1,5 +1,9 @@
 set( SOURCES
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Containers/ArrayTest.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Containers/HashMapTest.cpp
     ${CMAKE_CURRENT_LIST_DIR}/Source/Crypto/Ripemd160Test.cpp
     ${CMAKE_CURRENT_LIST_DIR}/Source/Crypto/Sha512Test.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Math/FixedPointTest.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Math/UInt256Test.cpp
     ${CMAKE_CURRENT_LIST_DIR}/Source/Utf8Test.cpp
 )
@@ -0,0 +1,69 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreUtils/Containers/Array.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+
+namespace
+{
+    [[ nodiscard ]]
+    std::int64_t * getElements( A1::Utils::ArrayHeader * array )
+    {
+        return reinterpret_cast< std::int64_t * >( reinterpret_cast< std::uint8_t * >( array ) + A1::Utils::arrayDataOffset );
+    }
+} // namespace
+
+TEST( ArrayTest, append )
+{
+    A1::Utils::ArrayHeader * array{ nullptr };
+    EXPECT_EQ( array_length( array ), 0U );
+
+    // Array is created on the first append
+    auto * first{ static_cast< std::int64_t * >( array_append( &array, sizeof( std::int64_t ) ) ) };
+    ASSERT_NE( array, nullptr );
+    EXPECT_EQ( *first, 0 );
+    EXPECT_EQ( first, getElements( array ) );
+
+    for ( std::int64_t i{ 1 }; i < 1'000; ++i )
+    {
+        *static_cast< std::int64_t * >( array_append( &array, sizeof( std::int64_t ) ) ) = i * i;
+    }
+
+    EXPECT_EQ( array_length( array ), 1'000U );
+    EXPECT_EQ( array->length, 1'000U );
+    EXPECT_GE( array->capacity, array->length );
+
+    // Elements are contiguous and they survive the reallocations
+    auto const * elements{ getElements( array ) };
+    for ( std::int64_t i{ 0 }; i < 1'000; ++i )
+    {
+        EXPECT_EQ( elements[ i ], i * i );
+    }
+
+    std::free( array );
+}
+
+TEST( ArrayTest, amortizedGrowth )
+{
+    A1::Utils::ArrayHeader * array{ nullptr };
+
+    auto reallocations{ 0U };
+    for ( auto i{ 0U }; i < 100'000U; ++i )
+    {
+        auto const * previous{ array };
+        [[ maybe_unused ]] auto * element{ array_append( &array, sizeof( std::uint8_t ) ) };
+        if ( array != previous ) { ++reallocations; }
+    }
+
+    EXPECT_EQ( array->length, 100'000U );
+    EXPECT_LE( reallocations, 16U );
+
+    std::free( array );
+}
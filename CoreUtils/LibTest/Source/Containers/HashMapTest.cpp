@@ -0,0 +1,147 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreUtils/Containers/HashMap.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <unordered_map>
+
+namespace
+{
+    using Address = std::array< std::uint8_t, 20U >;
+
+    [[ nodiscard ]]
+    Address makeAddress( std::uint64_t const seed )
+    {
+        Address address{};
+        std::memcpy( std::data( address ) + 4U, &seed, sizeof( seed ) );
+        return address;
+    }
+
+    [[ nodiscard ]]
+    std::int64_t * find( A1::Utils::HashMap const & map, std::uint64_t const key )
+    {
+        return static_cast< std::int64_t * >( map.find( &key ) );
+    }
+
+    [[ nodiscard ]]
+    std::int64_t & insert( A1::Utils::HashMap & map, std::uint64_t const key )
+    {
+        return *static_cast< std::int64_t * >( map.insert( &key ) );
+    }
+} // namespace
+
+TEST( HashMapTest, insertFindErase )
+{
+    A1::Utils::HashMap map{ sizeof( std::uint64_t ), sizeof( std::int64_t ) };
+
+    EXPECT_EQ( find( map, 5U ), nullptr );
+
+    // Inserted value is zero-initialized
+    EXPECT_EQ( insert( map, 5U ), 0 );
+    insert( map, 5U ) = 42;
+    insert( map, 7U ) = -1;
+
+    ASSERT_NE( find( map, 5U ), nullptr );
+    EXPECT_EQ( *find( map, 5U ), 42 );
+    EXPECT_EQ( *find( map, 7U ), -1 );
+    EXPECT_EQ( map.size(), 2U );
+
+    std::uint64_t const erased{ 5U };
+    EXPECT_TRUE ( map.erase( &erased ) );
+    EXPECT_FALSE( map.erase( &erased ) );
+    EXPECT_EQ( find( map, 5U ), nullptr );
+    EXPECT_EQ( *find( map, 7U ), -1 );
+    EXPECT_EQ( map.size(), 1U );
+
+    EXPECT_EQ( insert( map, 5U ), 0 );
+}
+
+TEST( HashMapTest, matchesReference )
+{
+    A1::Utils::HashMap                                map{ sizeof( std::uint64_t ), sizeof( std::int64_t ) };
+    std::unordered_map< std::uint64_t, std::int64_t > reference;
+
+    // Small key range makes insertions of the present keys and erasures in the middle of the probe sequences frequent
+    std::mt19937_64                                 engine{ 42U };
+    std::uniform_int_distribution< std::uint64_t > keys{ 0U, 20'000U };
+
+    for ( std::int64_t i{ 0 }; i < 200'000; ++i )
+    {
+        auto const key{ keys( engine ) };
+        if ( i % 3 == 0 )
+        {
+            EXPECT_EQ( map.erase( &key ), reference.erase( key ) == 1U );
+        }
+        else
+        {
+            insert( map, key ) = i;
+            reference[ key ]   = i;
+        }
+    }
+
+    ASSERT_EQ( map.size(), std::size( reference ) );
+    for ( std::uint64_t key{ 0U }; key <= 20'000U; ++key )
+    {
+        auto const * value{ find( map, key ) };
+        if ( auto const it{ reference.find( key ) }; it != std::end( reference ) )
+        {
+            ASSERT_NE( value, nullptr ) << "Key " << key << " is missing";
+            EXPECT_EQ( *value, it->second );
+        }
+        else
+        {
+            EXPECT_EQ( value, nullptr ) << "Key " << key << " is present";
+        }
+    }
+}
+
+TEST( HashMapTest, addressKeys )
+{
+    A1::Utils::HashMap map{ sizeof( Address ), sizeof( std::int64_t ) };
+
+    for ( std::uint64_t i{ 0U }; i < 10'000U; ++i )
+    {
+        *static_cast< std::int64_t * >( map.insert( std::data( makeAddress( i ) ) ) ) = static_cast< std::int64_t >( i );
+    }
+
+    EXPECT_EQ( map.size(), 10'000U );
+    for ( std::uint64_t i{ 0U }; i < 10'000U; ++i )
+    {
+        auto const * value{ static_cast< std::int64_t * >( map.find( std::data( makeAddress( i ) ) ) ) };
+        ASSERT_NE( value, nullptr );
+        EXPECT_EQ( *value, static_cast< std::int64_t >( i ) );
+    }
+    EXPECT_EQ( map.find( std::data( makeAddress( 10'000U ) ) ), nullptr );
+
+    // Hash depends on all the bytes of the key
+    EXPECT_NE( map.hash( std::data( makeAddress( 1U ) ) ), map.hash( std::data( makeAddress( 1U << 8U ) ) ) );
+}
+
+TEST( HashMapTest, runtime )
+{
+    A1::Utils::HashMap * map{ nullptr };
+
+    std::uint8_t const key{ 3U };
+    EXPECT_EQ( map_get ( map, &key ), nullptr );
+    EXPECT_EQ( map_size( map ), 0U );
+    EXPECT_FALSE( map_erase( map, &key ) );
+
+    // Map is created on the first insertion
+    *static_cast< std::uint8_t * >( map_insert( &map, sizeof( key ), sizeof( std::uint8_t ), &key ) ) = 9U;
+    ASSERT_NE( map, nullptr );
+    EXPECT_EQ( *static_cast< std::uint8_t * >( map_get( map, &key ) ), 9U );
+    EXPECT_EQ( map_size( map ), 1U );
+
+    map->~HashMap();
+    std::free( map );
+}
@@ -0,0 +1,60 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreUtils/Math/FixedPoint.hpp>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <string>
+
+namespace
+{
+    [[ nodiscard ]]
+    std::string toString( std::int64_t const value )
+    {
+        char buffer[ 24U ];
+        return num_to_string( value, buffer );
+    }
+
+    constexpr std::int64_t min{ std::numeric_limits< std::int64_t >::min() };
+    constexpr std::int64_t max{ std::numeric_limits< std::int64_t >::max() };
+} // namespace
+
+TEST( FixedPointTest, toString )
+{
+    EXPECT_EQ( toString( 0         ), "0"     );
+    EXPECT_EQ( toString( 45000000  ), "45"    );
+    EXPECT_EQ( toString( 1250000   ), "1.25"  );
+    EXPECT_EQ( toString( -1250000  ), "-1.25" );
+    EXPECT_EQ( toString( 50000     ), "0.05"  );
+    EXPECT_EQ( toString( -1        ), "-0.000001" );
+
+    EXPECT_EQ( toString( max ), "9223372036854.775807"  );
+    EXPECT_EQ( toString( min ), "-9223372036854.775808" );
+}
+
+TEST( FixedPointTest, arithmetic )
+{
+    using namespace A1::Utils;
+
+    EXPECT_EQ( FixedPoint::add( 1250000, 2500000 ), 3750000 );
+    EXPECT_EQ( FixedPoint::add( max, 1 ), min );
+
+    EXPECT_EQ( num_mul( 1250000 , 2500000  ), 3125000  );
+    EXPECT_EQ( num_mul( -1500000, 1500000  ), -2250000 );
+    EXPECT_EQ( num_mul( 1       , 1        ), 0        );
+
+    // Product exceeds 64 bits before it is rescaled
+    EXPECT_EQ( num_mul( 9000000000000000000, 1000000 ), 9000000000000000000 );
+
+    EXPECT_EQ( num_div( 1000000 , 3000000 ), 333333   );
+    EXPECT_EQ( num_div( -1000000, 3000000 ), -333333  );
+    EXPECT_EQ( num_div( 7000000 , 2000000 ), 3500000  );
+    EXPECT_EQ( num_div( max     , 1000000 ), max      );
+    EXPECT_EQ( num_div( 1000000 , 0       ), 0        );
+}
@@ -0,0 +1,112 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreUtils/Math/UInt256.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace
+{
+    using A1::Utils::UInt256;
+
+    [[ nodiscard ]]
+    std::string toString( UInt256 const & value )
+    {
+        char buffer[ 80U ];
+        return u256_to_string( std::data( value.limbs ), buffer );
+    }
+
+    [[ nodiscard ]]
+    std::string toSignedString( UInt256 const & value )
+    {
+        char buffer[ 80U ];
+        return i256_to_string( std::data( value.limbs ), buffer );
+    }
+
+    constexpr UInt256 a{ { 0x9E8F7A6B5C4D3E2FU, 0x7C6D5E4F3A2B1C0DU, 0x8A5BC3D2E1F09A8BU, 0xF3A19C2B7E4D1F06U } };
+    constexpr UInt256 b{ { 0x6789ABCDEF012345U, 0x6789ABCDEF012345U, 0x0000000000012345U, 0x0000000000000000U } };
+
+    constexpr UInt256 max{ { ~0ULL, ~0ULL, ~0ULL, ~0ULL } };
+} // namespace
+
+TEST( UInt256Test, toString )
+{
+    EXPECT_EQ( toString( 0U  ), "0"  );
+    EXPECT_EQ( toString( 42U ), "42" );
+
+    EXPECT_EQ( toString( a   ), "110197562428171932836310193486686555205545465853959483687175472080653422247471"  );
+    EXPECT_EQ( toString( b   ), "25373292314772619777585517869667395766920005"                                    );
+    EXPECT_EQ( toString( max ), "115792089237316195423570985008687907853269984665640564039457584007913129639935" );
+
+    EXPECT_EQ( toSignedString( max ), "-1" );
+    EXPECT_EQ( toSignedString( a   ), "-5594526809144262587260791522001352647724518811681080352282111927259707392465" );
+}
+
+TEST( UInt256Test, arithmetic )
+{
+    EXPECT_EQ( toString( a + b ), "110197562428171932836310193486686580578837780626579261272693341748049189167476" );
+    EXPECT_EQ( toString( a - b ), "110197562428171932836310193486686529832253151081339706101657602413257655327466" );
+    EXPECT_EQ( toString( b - a ), "5594526809144262587260791522001378021016833584300857937799981594655474312470"   );
+    EXPECT_EQ( toString( a * b ), "78341698785102424573399012302353239869777002579307832409044980604130583195563"  );
+
+    EXPECT_EQ( toString( a << 77U ), "54493733806109961856611017495677731625622359681872667385808900123169342357504" );
+    EXPECT_EQ( toString( a >> 77U ), "729226297529486137367286332028288252007997176425337176"                        );
+
+    // Carries and borrows propagate through all the limbs
+    EXPECT_EQ( max + 1U, UInt256{} );
+    EXPECT_EQ( UInt256{} - 1U, max );
+    EXPECT_EQ( toString( UInt256{ ~0ULL } * UInt256{ ~0ULL } ), "340282366920938463426481119284349108225" );
+}
+
+TEST( UInt256Test, divide )
+{
+    using namespace A1::Utils;
+
+    {
+        auto const [ quotient, remainder ]{ divide( a, b ) };
+        EXPECT_EQ( toString( quotient  ), "4343053359457560692006776237898304"           );
+        EXPECT_EQ( toString( remainder ), "24309364467443926118061448865079724929075951" );
+    }
+    {
+        auto const [ quotient, remainder ]{ divide( a, ~0ULL ) };
+        EXPECT_EQ( toString( quotient  ), "5973821829361550437636651162247493527644450547677813855648" );
+        EXPECT_EQ( toString( remainder ), "11023185405006975951"                                       );
+    }
+    {
+        auto const [ quotient, remainder ]{ divideSigned( a, b ) };
+        EXPECT_EQ( toSignedString( quotient  ), "-220488801364065212754983201359295"           );
+        EXPECT_EQ( toSignedString( remainder ), "-20745859951881473661240490789679348179195990" );
+    }
+    {
+        auto const [ quotient, remainder ]{ divide( max, max ) };
+        EXPECT_EQ( quotient , UInt256{ 1U } );
+        EXPECT_EQ( remainder, UInt256{}     );
+    }
+    {
+        auto const [ quotient, remainder ]{ divide( b, a ) };
+        EXPECT_EQ( quotient , UInt256{} );
+        EXPECT_EQ( remainder, b         );
+    }
+    {
+        auto const [ quotient, remainder ]{ divide( a, UInt256{} ) };
+        EXPECT_EQ( quotient , UInt256{} );
+        EXPECT_EQ( remainder, UInt256{} );
+    }
+
+    // Every quotient and remainder reconstructs the dividend
+    for ( std::size_t shift{ 0U }; shift < 256U; shift += 7U )
+    {
+        auto const divisor{ ( b << shift ) + 3U };
+        if ( divisor == UInt256{} ) { continue; }
+
+        auto const [ quotient, remainder ]{ divide( a, divisor ) };
+        EXPECT_LT( remainder, divisor );
+        EXPECT_EQ( quotient * divisor + remainder, a );
+    }
+}
@@ -16,6 +16,7 @@ namespace A1::CLI
 void App::parse( int const argc, char * argv[] )
 {
     setArguments_          .clear();
+    setVariadicArguments_  .clear();
     implicitlySetArguments_.clear();
 
     auto setPositionalArgumentsCount{ 0U };
@@ -47,7 +48,27 @@ void App::parse( int const argc, char * argv[] )
 
             if ( it == std::end( optionalArguments_ ) )
             {
-                throw Exception( fmt::format( "Unknown argument: {}", argv[ i ] ), help() );
+                // Value may be attached to the short version of an argument, e.g. '-O2'
+                auto const attached
+                {
+                    std::find_if
+                    (
+                        std::begin( optionalArguments_ ),
+                        std::end  ( optionalArguments_ ),
+                        [ value = std::string_view{ argv[ i ] } ]( auto && arg ) noexcept
+                        {
+                            return !arg.implicit && !arg.short_.empty() && value.starts_with( arg.short_ );
+                        }
+                    )
+                };
+
+                if ( attached == std::end( optionalArguments_ ) )
+                {
+                    throw Exception( fmt::format( "Unknown argument: {}", argv[ i ] ), help() );
+                }
+
+                setArguments_[ attached->long_ ] = argv[ i ] + std::size( attached->short_ );
+                continue;
             }
 
             if ( it->implicit )
@@ -67,7 +88,11 @@ void App::parse( int const argc, char * argv[] )
         }
         else
         {
-            if ( setPositionalArgumentsCount < std::size( positionalArguments_ ) )
+            if ( setPositionalArgumentsCount < std::size( positionalArguments_ ) && positionalArguments_[ setPositionalArgumentsCount ].variadic )
+            {
+                setVariadicArguments_[ positionalArguments_[ setPositionalArgumentsCount ].long_ ].push_back( argv[ i ] );
+            }
+            else if ( setPositionalArgumentsCount < std::size( positionalArguments_ ) )
             {
                 setArguments_[ positionalArguments_[ setPositionalArgumentsCount ].long_ ] = argv[ i ];
                 setPositionalArgumentsCount++;
@@ -79,6 +104,12 @@ void App::parse( int const argc, char * argv[] )
         }
     }
 
+    // Variadic argument may be left without any value
+    if ( setPositionalArgumentsCount < std::size( positionalArguments_ ) && positionalArguments_[ setPositionalArgumentsCount ].variadic )
+    {
+        ++setPositionalArgumentsCount;
+    }
+
     if ( setPositionalArgumentsCount != std::size( positionalArguments_ ) )
     {
         throw Exception
@@ -95,15 +126,15 @@ void App::parse( int const argc, char * argv[] )
 
 std::string App::help() const
 {
-    std::vector< std::string_view > positionalArgumentNames;
+    std::vector< std::string > positionalArgumentNames;
     std::transform
     (
         std::begin( positionalArguments_ ),
         std::end  ( positionalArguments_ ),
         std::back_inserter( positionalArgumentNames ),
-        []( auto && arg ) noexcept
+        []( auto && arg )
         {
-            return arg.long_;
+            return arg.variadic ? fmt::format( "[{}...]", arg.long_ ) : std::string{ arg.long_ };
         }
     );
 
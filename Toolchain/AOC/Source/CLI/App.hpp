@@ -76,6 +76,19 @@ struct App final
         ) != std::end( implicitlySetArguments_ );
     }
 
+    /**
+     * Returns all the values of the argument in the order they are specified, e.g. of the variadic argument.
+     */
+    [[ nodiscard ]] std::vector< std::string > getAll( std::string_view const argument ) const
+    {
+        if ( auto it{ setVariadicArguments_.find( argument ) }; it != std::end( setVariadicArguments_ ) )
+        {
+            return it->second;
+        }
+        if ( auto value{ get< std::string >( argument ) } ) { return { std::move( *value ) }; }
+        return {};
+    }
+
     [[ nodiscard ]] std::string help   () const;
     [[ nodiscard ]] std::string version() const;
 
@@ -86,6 +99,8 @@ private:
     std::vector< std::string_view > implicitlySetArguments_;
     std::map< std::string_view, std::string > setArguments_;
 
+    std::map< std::string_view, std::vector< std::string > > setVariadicArguments_;
+
     Title       title_;
     Description description_;
     Version     version_;
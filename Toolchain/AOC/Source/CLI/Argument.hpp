@@ -24,6 +24,7 @@ struct Argument
     /**
      * A short version of an optional argument in the CLI application.
      * NOTE: Short optional argument must be prefixed with a single dash, e.g. '-o'.
+     *       Value of a non-implicit argument may be attached to its short version, e.g. '-O2'.
      */
     std::string_view short_{};
 
@@ -56,6 +57,12 @@ struct Argument
      */
     bool exit{ false };
 
+    /**
+     * If set to true, positional argument takes all the remaining positional values, if any.
+     * E.g. 'aoc a.ao b.ao' sets both files. Only the last positional argument may be variadic.
+     */
+    bool variadic{ false };
+
     [[ nodiscard ]] bool isOptional() const noexcept
     {
         return ( short_.empty() || short_.starts_with( "-" ) ) && long_.starts_with( "--" );
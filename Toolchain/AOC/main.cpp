@@ -8,10 +8,89 @@
 #include "CLI/App.hpp"
 #include "CLI/Exception.hpp"
 
+#include <CoreLib/Compiler/Cache.hpp>
 #include <CoreLib/Compiler/Settings.hpp>
 #include <CoreLib/Module.hpp>
 
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <charconv>
 #include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /**
+     * Reads the paths of the files listed in the manifest, one per line. Empty lines and lines
+     * starting with '#' are skipped, relative paths are relative to the directory of the manifest.
+     */
+    [[ nodiscard ]] std::vector< std::filesystem::path > readManifest( std::filesystem::path const & manifest )
+    {
+        std::ifstream stream{ manifest };
+        if ( !stream )
+        {
+            throw std::runtime_error( fmt::format( "Could not open the manifest: {}", manifest.string() ) );
+        }
+
+        std::vector< std::filesystem::path > files;
+        for ( std::string line; std::getline( stream, line ); )
+        {
+            auto const begin{ line.find_first_not_of( " \t\r" ) };
+            if ( begin == std::string::npos || line[ begin ] == '#' ) { continue; }
+
+            std::filesystem::path file{ line.substr( begin, line.find_last_not_of( " \t\r" ) - begin + 1U ) };
+            files.push_back( file.is_relative() ? manifest.parent_path() / file : file );
+        }
+        return files;
+    }
+
+    /**
+     * Directory of the compilation cache, i.e. 'AOC_CACHE_DIR' if set, otherwise 'aoc' in the user cache directory.
+     */
+    [[ nodiscard ]] std::optional< std::filesystem::path > cacheDirectory()
+    {
+        if ( auto const * directory{ std::getenv( "AOC_CACHE_DIR" ) }; directory != nullptr && *directory != '\0' )
+        {
+            return directory;
+        }
+        if ( auto const * directory{ std::getenv( "XDG_CACHE_HOME" ) }; directory != nullptr && *directory != '\0' )
+        {
+            return std::filesystem::path{ directory } / "aoc";
+        }
+        if ( auto const * home{ std::getenv( "HOME" ) }; home != nullptr && *home != '\0' )
+        {
+            return std::filesystem::path{ home } / ".cache" / "aoc";
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * Identifies the build of the compiler by its version, along with the size and the modification time of its executable,
+     * so that the executables compiled by the previous build are not reused, even if the version has not been bumped.
+     */
+    [[ nodiscard ]] std::string compilerVersion( char const * const argv0 )
+    {
+#if __linux__
+        std::filesystem::path const executable{ "/proc/self/exe" };
+#else
+        std::filesystem::path const executable{ argv0 };
+#endif // __linux__
+        static_cast< void >( argv0 );
+
+        std::error_code errorCode;
+        auto const size         { std::filesystem::file_size      ( executable, errorCode ) };
+        auto const lastWriteTime{ std::filesystem::last_write_time( executable, errorCode ) };
+        return fmt::format( "{} {} {}", AOC_VERSION, size, lastWriteTime.time_since_epoch().count() );
+    }
+} // namespace
 
 int main( int argc, char * argv[] )
 {
@@ -28,11 +107,17 @@ int main( int argc, char * argv[] )
     app.addArgument( { .short_ = "-h", .long_ = "--help"   , .description  = "Print help"   , .implicit = true, .exit = true } );
     app.addArgument( { .short_ = "-v", .long_ = "--version", .description  = "Print version", .implicit = true, .exit = true } );
 
-    app.addArgument( {                 .long_ = "file"    , .metaName = "FILE", .description = "File to be compiled"           } );
-    app.addArgument( { .short_ = "-o", .long_ = "--output", .metaName = "FILE", .description = "Write output to specific file" } );
+    app.addArgument( {                 .long_ = "file"      , .metaName = "FILE", .description = "Files to be compiled", .variadic = true                   } );
+    app.addArgument( { .short_ = "-o", .long_ = "--output"  , .metaName = "FILE", .description = "Write output to specific file, or directory if many files are compiled" } );
+    app.addArgument( {                 .long_ = "--manifest", .metaName = "FILE", .description = "Compile the files listed in the file, one per line"                   } );
+    app.addArgument( { .short_ = "-j", .long_ = "--jobs"    , .metaName = "N"   , .description = "Number of files compiled at once (default: number of CPU threads)"    } );
+    app.addArgument( { .short_ = "-O", .long_ = "--optimize", .metaName = "LEVEL", .description = "Optimization level: 0 (default), 1, 2, 3, s or z" } );
 
-    app.addArgument( { .long_ = "--ast"    , .description = "Write Abstract Syntax Tree (AST) to standard output", .implicit = true } );
-    app.addArgument( { .long_ = "--llvm-ir", .description = "Write generated LLVM IR code to standard output"    , .implicit = true } );
+    app.addArgument( { .long_ = "--ast"       ,                     .description = "Write Abstract Syntax Tree (AST) to standard output"     , .implicit = true } );
+    app.addArgument( { .long_ = "--ast-format", .metaName = "FORMAT", .description = "Format of the AST output: text (default), json or binary"                    } );
+    app.addArgument( { .long_ = "--llvm-ir"   ,                     .description = "Write generated LLVM IR code to standard output"         , .implicit = true } );
+    app.addArgument( { .long_ = "--stats"     ,                     .description = "Write compilation statistics to standard output"         , .implicit = true } );
+    app.addArgument( { .long_ = "--no-cache"  ,                     .description = "Neither reuse nor store the cached compilation outputs"  , .implicit = true } );
 
     try
     {
@@ -42,28 +127,133 @@ int main( int argc, char * argv[] )
         else if ( app.get< bool >( "--version" ) ) { std::printf( "%s\n", app.version().c_str() ); }
         else
         {
+            auto const astFormatName{ app.get< std::string >( "--ast-format" ).value_or( "text" ) };
+            auto const astFormat    { A1::AST::toPrintFormat( astFormatName ) };
+            if ( !astFormat )
+            {
+                throw Exception( fmt::format( "Unknown AST format: {}", astFormatName ), app.help() );
+            }
+
+            auto const optimizationLevelName{ app.get< std::string >( "--optimize" ).value_or( "0" ) };
+            auto const optimizationLevel    { A1::Compiler::toOptimizationLevel( optimizationLevelName ) };
+            if ( !optimizationLevel )
+            {
+                throw Exception( fmt::format( "Unknown optimization level: {}", optimizationLevelName ), app.help() );
+            }
+
+            std::size_t jobsCount{ std::max( std::thread::hardware_concurrency(), 1U ) };
+            if ( auto const jobs{ app.get< std::string >( "--jobs" ) } )
+            {
+                auto const [ end, error ]{ std::from_chars( jobs->data(), jobs->data() + std::size( *jobs ), jobsCount ) };
+                if ( error != std::errc{} || end != jobs->data() + std::size( *jobs ) || jobsCount == 0U )
+                {
+                    throw Exception( fmt::format( "Invalid number of jobs: {}", *jobs ), app.help() );
+                }
+            }
+
+            std::vector< std::filesystem::path > files;
+            for ( auto & file : app.getAll( "file" ) ) { files.emplace_back( std::move( file ) ); }
+            if ( auto const manifest{ app.get< std::string >( "--manifest" ) } )
+            {
+                for ( auto & file : readManifest( *manifest ) ) { files.push_back( std::move( file ) ); }
+            }
+
+            if ( files.empty() )
+            {
+                throw Exception( "Missing files to be compiled", app.help() );
+            }
+
+            /**
+             * Single file is compiled into the output file, whereas each file of the batch is compiled
+             * next to its source, or into the output directory, e.g. 'contracts/Token.ao' into 'contracts/Token'.
+             */
+            auto const batch { std::size( files ) > 1U };
+            auto const output{ app.get< std::string >( "--output" ) };
+
+            std::vector< A1::LoadJob > jobs;
+            std::set< std::string >    executableFilenames;
+            for ( auto const & file : files )
+            {
+                auto executableFilename
+                {
+                    !batch ? output.value_or( "out" )
+                           : output ? ( std::filesystem::path{ *output } / file.stem() ).string()
+                                    : std::filesystem::path{ file }.replace_extension().string()
+                };
+
+                if ( !executableFilenames.insert( executableFilename ).second )
+                {
+                    throw Exception( fmt::format( "Multiple files are compiled into: {}", executableFilename ), app.help() );
+                }
+                jobs.push_back( { .inputFile = file, .executableFilename = std::move( executableFilename ) } );
+            }
+
+            if ( batch && output ) { std::filesystem::create_directories( *output ); }
+
+            A1::Compiler::Statistics statistics;
+            auto const outputStatistics{ app.get< bool >( "--stats" ) };
+
+            std::optional< A1::Compiler::Cache > cache;
+            if ( auto directory{ cacheDirectory() }; directory && !app.get< bool >( "--no-cache" ) )
+            {
+                cache.emplace( std::move( *directory ), compilerVersion( argv[ 0 ] ) );
+            }
+
             A1::Compiler::Settings settings
             {
-                .executableFilename = app.get< std::string >( "--output"  ).value_or( "out" ),
+                .executableFilename = {},
                 .outputAST          = app.get< bool        >( "--ast"     ),
-                .outputIR           = app.get< bool        >( "--llvm-ir" )
+                .astFormat          = *astFormat,
+                .outputIR           = app.get< bool        >( "--llvm-ir" ),
+                .optimizationLevel  = *optimizationLevel,
+                // Workers compile the files of the batch, while a single file is compiled on all of them
+                .threadsCount       = batch ? 1U : jobsCount,
+                .statistics         = outputStatistics ? &statistics : nullptr,
+                .cache              = cache ? &*cache : nullptr
             };
 
-            if
-            (
-                auto filePath{ app.get< std::string >( "file" ) };
-                filePath && A1::load( std::move( settings ), *filePath )
-            )
+            // AST and LLVM IR of the files compiled at once would be interleaved
+            if ( settings.outputAST || settings.outputIR ) { jobsCount = 1U; }
+
+            auto succeeded{ true };
+            for ( auto const & result : A1::loadAll( settings, jobs, jobsCount ) )
             {
-                std::printf( "Compilation successful!\n" );
+                succeeded = succeeded && result.succeeded();
+
+                if ( !result.succeeded() )
+                {
+                    std::fprintf( stderr, "%s: %s\n", result.inputFile.string().c_str(), result.error.c_str() );
+                }
+                else if ( batch )
+                {
+                    std::printf( "%s: Compilation successful!\n", result.inputFile.string().c_str() );
+                }
+                else
+                {
+                    std::printf( "Compilation successful!\n" );
+                }
+
+                if ( outputStatistics && result.succeeded() )
+                {
+                    if ( batch ) { std::printf( "\n%s:", result.inputFile.string().c_str() ); }
+                    A1::Compiler::print( result.statistics );
+                }
             }
+
+            return succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
         }
     }
     catch ( Exception const & ex )
     {
         std::printf( "%s\n\n", ex.what() );
         std::printf( "%s\n\n", ex.help() );
+        return EXIT_FAILURE;
+    }
+    catch ( std::exception const & ex )
+    {
+        std::fprintf( stderr, "%s\n", ex.what() );
+        return EXIT_FAILURE;
     }
 
-    return 0;
+    return EXIT_SUCCESS;
 }
\ No newline at end of file
@@ -32,10 +32,27 @@ target_include_directories(
     PRIVATE ${CMAKE_CURRENT_LIST_DIR}/Source
 )
 
-target_link_libraries( CoreLib PRIVATE fmt::fmt )
+find_package( Threads REQUIRED )
+
+target_link_libraries( CoreLib PRIVATE fmt::fmt Threads::Threads )
 
 if( ENABLE_TESTS )
-    target_compile_definitions( CoreLib PRIVATE TESTS_ENABLED=1 )
+    # Runtime of the num, 256-bit integer, array and map types, linked natively into the test executables
+    add_library( CoreUtilsRuntime STATIC
+        ${CMAKE_CURRENT_LIST_DIR}/../../CoreUtils/Lib/Source/Containers/Array.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/../../CoreUtils/Lib/Source/Containers/HashMap.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/../../CoreUtils/Lib/Source/Math/FixedPoint.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/../../CoreUtils/Lib/Source/Math/UInt256.cpp
+    )
+    target_include_directories( CoreUtilsRuntime PUBLIC ${CMAKE_CURRENT_LIST_DIR}/../../CoreUtils/Lib/Include )
+    # Contracts are linked without the C++ library, hence no unwinding tables referring to its personality routine
+    target_compile_options( CoreUtilsRuntime PRIVATE -fno-exceptions )
+
+    add_dependencies( CoreLib CoreUtilsRuntime )
+    target_compile_definitions( CoreLib PRIVATE
+        TESTS_ENABLED=1
+        TESTS_RUNTIME_LIBRARY_PATH=\"$<TARGET_FILE:CoreUtilsRuntime>\"
+    )
 else()
     target_compile_definitions( CoreLib PRIVATE
         WASM_WASI_LIB_PATH=\"${WASM_SYSROOT_PATH}/lib/wasm32-wasi\"
@@ -55,6 +72,18 @@ if( ENABLE_LLVM )
     target_link_libraries( CoreLib PRIVATE ${LLVM_AVAILABLE_LIBS} )
     target_compile_definitions( CoreLib PRIVATE LLVM_ENABLED=1 )
 
+    if( NOT ENABLE_TESTS )
+        # Contracts are linked within the process if lld is installed as a library, otherwise by wasm-ld
+        find_package( LLD CONFIG QUIET HINTS ${LLVM_DIR}/../lld )
+        message( STATUS "LLD enabled: ${LLD_FOUND}" )
+
+        if( LLD_FOUND )
+            target_include_directories( CoreLib AFTER PRIVATE ${LLD_INCLUDE_DIRS} )
+            target_link_libraries( CoreLib PRIVATE lldWasm lldCommon )
+            target_compile_definitions( CoreLib PRIVATE LLD_ENABLED=1 )
+        endif()
+    endif()
+
     if( APPLE AND ENABLE_TESTS )
         target_compile_definitions( CoreLib PRIVATE SYSROOT_PATH=\"${CMAKE_OSX_SYSROOT}\" )
     endif()
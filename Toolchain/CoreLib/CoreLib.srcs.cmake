@@ -1,15 +1,27 @@
 set( SOURCES
     ${CMAKE_CURRENT_LIST_DIR}/Source/AST/AST.cpp
     ${CMAKE_CURRENT_LIST_DIR}/Source/AST/ASTHelper.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/Source/AST/ASTInterner.cpp
     ${CMAKE_CURRENT_LIST_DIR}/Source/AST/ASTNode.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/Source/AST/ASTOptimizer.cpp
     ${CMAKE_CURRENT_LIST_DIR}/Source/AST/ASTPrinter.cpp
 
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Compiler/Cache.cpp
     ${CMAKE_CURRENT_LIST_DIR}/Source/Compiler/Compiler.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Compiler/Statistics.cpp
+
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Lint/Linter.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Lint/Rules.cpp
+
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Semantic/Analyzer.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Semantic/BoundsAnalysis.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Semantic/WidthInference.cpp
 
     ${CMAKE_CURRENT_LIST_DIR}/Source/Tokenizer/ReservedToken.cpp
     ${CMAKE_CURRENT_LIST_DIR}/Source/Tokenizer/Token.cpp
     ${CMAKE_CURRENT_LIST_DIR}/Source/Tokenizer/Tokenizer.cpp
 
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Utils/SHA256.cpp
     ${CMAKE_CURRENT_LIST_DIR}/Source/Utils/Stream.cpp
 
     ${CMAKE_CURRENT_LIST_DIR}/Source/Module.cpp
@@ -20,8 +32,15 @@ if( ENABLE_LLVM )
     list( APPEND SOURCES
         ${CMAKE_CURRENT_LIST_DIR}/Source/Compiler/LLVM/Compiler.cpp
         ${CMAKE_CURRENT_LIST_DIR}/Source/Compiler/LLVM/IRCodegen/Codegen.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/Source/Compiler/LLVM/IRCodegen/CodegenArray.cpp
         ${CMAKE_CURRENT_LIST_DIR}/Source/Compiler/LLVM/IRCodegen/CodegenBuiltin.cpp
         ${CMAKE_CURRENT_LIST_DIR}/Source/Compiler/LLVM/IRCodegen/CodegenExpression.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/Source/Compiler/LLVM/IRCodegen/CodegenFixedPoint.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/Source/Compiler/LLVM/IRCodegen/CodegenMap.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/Source/Compiler/LLVM/IRCodegen/CodegenString.cpp
         ${CMAKE_CURRENT_LIST_DIR}/Source/Compiler/LLVM/IRCodegen/CodegenVisitor.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/Source/Compiler/LLVM/IRCodegen/CodegenWideInteger.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/Source/Compiler/LLVM/Linker.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/Source/Compiler/LLVM/Target.cpp
     )
 endif()
@@ -8,11 +8,17 @@
 #pragma once
 
 #include <CoreLib/AST/ASTNode.hpp>
+#include <CoreLib/AST/ASTNodeIndex.hpp>
 #include <CoreLib/Tokenizer/Tokenizer.hpp>
 
 namespace A1::AST
 {
 
-[[ nodiscard ]] Node::Pointer parse( TokenIterator & token );
+/**
+ * Parses the tokens into the tree. If index is provided, all the non-leaf nodes
+ * are added to it as they get created, so that no extra traversal is needed.
+ * In case of a parsing error, the index is cleared.
+ */
+[[ nodiscard ]] Node::Pointer parse( TokenIterator & token, NodeIndex * index = nullptr );
 
 } // namespace A1::AST
\ No newline at end of file
@@ -0,0 +1,67 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <CoreLib/AST/ASTNode.hpp>
+
+#include <unordered_map>
+#include <cstddef>
+
+namespace A1::AST
+{
+
+/**
+ * class Interner
+ *
+ * Hash-consing table of AST subtrees. All structurally equal subtrees are
+ * mapped to a single canonical node, so that the identity of the canonical
+ * node can be used instead of the deep comparison, e.g. for common
+ * subexpression detection or for caching keyed by function bodies.
+ *
+ * Subtrees are interned bottom-up, thus two nodes are equal if their values
+ * are equal and their children have the same canonical nodes, i.e. interning
+ * costs O(1) per node on top of already computed node hashes.
+ *
+ * Interning is identity-only: duplicates are not freed nor replaced by the
+ * canonical node, as every node is uniquely owned by its parent and refers
+ * back to it, thus a subtree cannot be physically shared by several parents.
+ *
+ * CAUTION: Class does not own the nodes, interned trees must outlive it.
+ */
+class Interner
+{
+public:
+    /**
+     * Interns the subtree rooted at the node, including all of its subtrees.
+     * Returns the canonical node structurally equal to the given one.
+     */
+    Node const * intern( Node const & node );
+
+    /**
+     * Returns the canonical node of an already interned subtree,
+     * or nullptr if the subtree has not been interned yet.
+     */
+    [[ nodiscard ]] Node const * canonical( Node const & node ) const noexcept;
+
+    /** Number of unique subtrees interned so far. */
+    [[ nodiscard ]] std::size_t uniqueCount() const noexcept { return std::size( buckets_ ); }
+
+    /** Number of interned subtrees that are shared with an equal, previously interned subtree. */
+    [[ nodiscard ]] std::size_t sharedCount() const noexcept { return std::size( canonical_ ) - std::size( buckets_ ); }
+
+private:
+    [[ nodiscard ]] bool isCanonicalEqual( Node const & node, Node const & candidate ) const noexcept;
+
+    /** Canonical nodes grouped by their structural hash. */
+    std::unordered_multimap< std::size_t, Node const * > buckets_;
+
+    /** Maps every interned node to its canonical node. */
+    std::unordered_map< Node const *, Node const * > canonical_;
+};
+
+} // namespace A1::AST
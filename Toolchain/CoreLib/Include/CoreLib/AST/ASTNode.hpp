@@ -15,6 +15,7 @@
 #include <variant>
 #include <cstdint>
 #include <memory>
+#include <string_view>
 #include <vector>
 
 namespace A1::AST
@@ -101,10 +102,18 @@ enum class NodeType : std::uint8_t
     ModuleDefinition,
     VariableDefinition,
 
+    // Appended, so that the binary AST keeps the encoding of the other node types
+    Slice,                   // [ <operand> : <operand> ]
+
     // Number of possible node operations
     Count
 };
 
+/**
+ * Gets the name of the node type, e.g. 'Addition' for NodeType::Addition.
+ */
+[[ nodiscard ]] std::string_view toString( NodeType const type ) noexcept;
+
 using Boolean = bool;
 
 class Node
@@ -124,6 +133,12 @@ public:
     Node( ValueType value, ErrorInfo errorInfo = {} );
     Node( ValueType value, std::vector< Pointer > children, ErrorInfo errorInfo = {} );
 
+    // Children refer back to their parent, thus the node must stay at the same address
+    Node( Node const & ) = delete;
+    Node( Node && ) = delete;
+    Node & operator=( Node const & ) = delete;
+    Node & operator=( Node && ) = delete;
+
     template< typename T >
     [[ nodiscard ]] bool is() const noexcept
     {
@@ -148,11 +163,58 @@ public:
 
     [[ nodiscard ]] ErrorInfo errorInfo() const noexcept { return errorInfo_; }
 
+    /**
+     * Node whose child this node is, null for the root node and for the
+     * nodes which are not yet, or no longer, part of a tree.
+     */
+    [[ nodiscard ]] Node const * parent() const noexcept { return parent_; }
+
+    /**
+     * Closest non-null siblings of the node, null if there are none.
+     */
+    [[ nodiscard ]] Node const * previousSibling() const noexcept;
+    [[ nodiscard ]] Node const * nextSibling    () const noexcept;
+
+    /**
+     * Type of the expression represented by the node, as resolved by the semantic analysis.
+     * Null for statements, for expressions of unknown type and before the analysis has run.
+     */
+    [[ nodiscard ]] TypeID typeID() const noexcept { return typeID_; }
+
+    void typeID( TypeID const id ) noexcept { typeID_ = id; }
+
+    /**
+     * Structural hash of the subtree rooted at this node. It covers the node's
+     * value and its children's hashes, but not the error info, thus identical
+     * subtrees found at different places in the source have the same hash.
+     * Computed on construction, i.e. bottom-up while the tree is being parsed.
+     */
+    [[ nodiscard ]] std::size_t hash() const noexcept { return hash_; }
+
+    /**
+     * Moves children out of the node, leaving it as a leaf node, and detaches
+     * them from it. Used by the passes which rebuild the tree out of existing subtrees.
+     */
+    [[ nodiscard ]] std::vector< Pointer > releaseChildren() noexcept;
+
 private:
     ValueType              value_;
     std::vector< Pointer > children_;
 
     ErrorInfo errorInfo_;
+
+    Node        * parent_       { nullptr };
+    std::size_t   indexInParent_{ 0U };
+
+    TypeID typeID_{ nullptr };
+
+    std::size_t hash_{ 0U };
 };
 
+/**
+ * Checks whether two subtrees are structurally equal, i.e. whether they have
+ * the same values and the same children, regardless of their error info.
+ */
+[[ nodiscard ]] bool equal( Node const & lhs, Node const & rhs ) noexcept;
+
 } // namespace A1::AST
\ No newline at end of file
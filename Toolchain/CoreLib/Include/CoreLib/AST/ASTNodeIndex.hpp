@@ -0,0 +1,55 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <CoreLib/AST/ASTNode.hpp>
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace A1::AST
+{
+
+/**
+ * Side index from the node type to the nodes of that type, built by the parser
+ * while the tree is being parsed. Nodes of each type are kept in the order they
+ * have been created in, i.e. children come before their parents.
+ *
+ * CAUTION: Index does not own the nodes, it is valid only as long as the
+ *          indexed tree is alive and is not transformed, e.g. optimized.
+ */
+class NodeIndex
+{
+public:
+    [[ nodiscard ]] std::span< Node const * const > find( NodeType const type ) const noexcept
+    {
+        return nodes_[ static_cast< std::size_t >( type ) ];
+    }
+
+    [[ nodiscard ]] std::size_t count( NodeType const type ) const noexcept
+    {
+        return std::size( nodes_[ static_cast< std::size_t >( type ) ] );
+    }
+
+    void add( Node const & node )
+    {
+        ASSERT( node.is< NodeType >() );
+        nodes_[ static_cast< std::size_t >( node.get< NodeType >() ) ].push_back( &node );
+    }
+
+    void clear() noexcept
+    {
+        for ( auto & nodes : nodes_ ) { nodes.clear(); }
+    }
+
+private:
+    std::array< std::vector< Node const * >, static_cast< std::size_t >( NodeType::Count ) > nodes_;
+};
+
+} // namespace A1::AST
@@ -0,0 +1,27 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <CoreLib/AST/ASTNode.hpp>
+
+namespace A1::AST
+{
+
+/**
+ * Optimizes the AST before it gets compiled:
+ *  - folds constant arithmetic, bitwise, comparison and logical expressions,
+ *  - propagates variables initialized with a constant and never reassigned,
+ *  - prunes if, elif and while statements with constant conditions.
+ *
+ * Folding follows the semantics of the generated code, i.e. arithmetic wraps
+ * around on overflow and expressions which trap at run-time, like division
+ * by zero, are left intact.
+ */
+[[ nodiscard ]] Node::Pointer optimize( Node::Pointer root );
+
+} // namespace A1::AST
@@ -9,11 +9,59 @@
 
 #include <CoreLib/AST/ASTNode.hpp>
 
+#include <cstdint>
 #include <cstdio>
+#include <optional>
+#include <string>
+#include <string_view>
 
 namespace A1::AST
 {
 
-void print( Node::Pointer const & node, std::FILE * stream = stdout, std::size_t const indentationLevel = 0 );
+enum class PrintFormat : std::uint8_t
+{
+    /**
+     * Human-readable tree, one node per line, indented by the node depth.
+     */
+    Text,
+
+    /**
+     * Nested JSON objects, each one holding node's kind, value or children
+     * and its position in the source file, e.g.:
+     * { "kind": "Addition", "line": 1, "column": 3, "children": [ ... ] }
+     */
+    JSON,
+
+    /**
+     * Compact pre-order encoding of the tree. Each node is written as a single
+     * byte tag, followed by its payload:
+     *  - 0 (operator)       - node type (1 byte), children count (4 bytes), followed by children,
+     *  - 1 (identifier)     - length (4 bytes) and characters of the name,
+     *  - 2 (type)           - length (4 bytes) and characters of the type name,
+     *  - 3 (boolean)        - value (1 byte),
+     *  - 4 (number)         - value (8 bytes),
+     *  - 5 (string literal) - length (4 bytes) and characters of the string,
+     *  - 6 (decimal number) - value (8 bytes) and count of the digits after the decimal point (1 byte).
+     * Multi-byte values are little-endian. Stream starts with "A1AST" and a version byte.
+     */
+    Binary
+};
+
+/**
+ * Parses print format from its name, i.e. 'text', 'json' or 'binary'.
+ */
+[[ nodiscard ]] std::optional< PrintFormat > toPrintFormat( std::string_view const name ) noexcept;
+
+/**
+ * Writes the tree into the stream. Output is formatted into a large in-memory
+ * buffer, which is flushed only when it gets full, and the tree is traversed
+ * iteratively, so dumping even very deep trees does not exhaust the stack.
+ */
+void print( Node::Pointer const & node, std::FILE * stream = stdout, PrintFormat const format = PrintFormat::Text );
+
+/**
+ * Writes the tree into the string.
+ */
+void print( Node::Pointer const & node, std::string & output, PrintFormat const format = PrintFormat::Text );
 
-} // namespace A1::AST
\ No newline at end of file
+} // namespace A1::AST
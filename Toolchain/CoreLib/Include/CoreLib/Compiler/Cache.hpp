@@ -0,0 +1,78 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <CoreLib/Compiler/Settings.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace A1::Compiler
+{
+
+/**
+ * On-disk cache of the compiled executables, which may be shared by any number of threads and processes.
+ * Entry is addressed by the hash of the source file, the compiler version and the settings the executable
+ * depends on. Entry records the hashes of the imported source files as well, along with the paths the other
+ * imports have been looked up at, thus a hit is validated without the source being parsed. Entries are
+ * written into temporary files, which are renamed once complete, so that readers never see a partially
+ * written entry. Least recently used entries are evicted to keep the size bound.
+ */
+class Cache final
+{
+public:
+    static constexpr std::uintmax_t defaultMaxBytes{ 256U * 1024U * 1024U };
+
+    /**
+     * Version has to identify the compiler build, as the executables compiled by other builds are never reused.
+     */
+    Cache( std::filesystem::path directory, std::string version, std::uintmax_t const maxBytes = defaultMaxBytes );
+
+    /**
+     * Returns the key of the entry of the source file compiled with the settings,
+     * none if the source file cannot be read.
+     */
+    [[ nodiscard ]] std::optional< std::string > key( Settings const & settings, std::filesystem::path const & inputFile ) const;
+
+    /**
+     * Writes the cached executable into the executable file, unless there is no entry, any of the
+     * imported files has changed or any of the unresolved imports resolves since the entry has been stored.
+     */
+    [[ nodiscard ]] bool restore
+    (
+        std::string           const & key,
+        std::filesystem::path const & inputFile,
+        std::filesystem::path const & executableFile
+    ) const;
+
+    /**
+     * Stores the executable compiled from the source file and the imported files, then evicts the least
+     * recently used entries, if the cache has exceeded its size. Unresolved imports are the paths the imports
+     * not found have been looked up at. Errors are ignored, the cache is an optimization.
+     */
+    void store
+    (
+        std::string                          const & key,
+        std::filesystem::path                const & inputFile,
+        std::vector< std::filesystem::path > const & importedFiles,
+        std::vector< std::filesystem::path > const & unresolvedImports,
+        std::filesystem::path                const & executableFile
+    ) const;
+
+private:
+    void evict() const;
+
+    std::filesystem::path directory_;
+    std::string           version_;
+    std::uintmax_t        maxBytes_;
+};
+
+} // namespace A1::Compiler
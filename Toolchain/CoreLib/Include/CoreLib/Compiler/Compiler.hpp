@@ -8,11 +8,24 @@
 #pragma once
 
 #include <CoreLib/AST/ASTNode.hpp>
+#include <CoreLib/Compiler/Output.hpp>
 #include <CoreLib/Compiler/Settings.hpp>
 
+#include <string_view>
+
 namespace A1
 {
 
 [[ nodiscard ]] bool compile( Compiler::Settings settings, AST::Node::Pointer const & node );
 
+/**
+ * Compiles the source code held in memory, e.g. the contract received over the network, into
+ * the linked module. Nothing is written to the standard output, errors are returned as the
+ * diagnostics instead. Source files of the imported modules are not looked up, the module is
+ * linked with the libraries of the toolchain only. The linker reads the object code from and
+ * writes the module into the scratch files, which are removed once the module is read back.
+ * Compilations of different sources may run on multiple threads at once.
+ */
+[[ nodiscard ]] Compiler::Output compile( std::string_view const source, Compiler::Options const & options = {} );
+
 } // namespace A1
\ No newline at end of file
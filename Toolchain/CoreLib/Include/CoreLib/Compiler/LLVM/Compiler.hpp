@@ -8,6 +8,7 @@
 #pragma once
 
 #include <CoreLib/AST/ASTNode.hpp>
+#include <CoreLib/Compiler/Output.hpp>
 #include <CoreLib/Compiler/Settings.hpp>
 
 namespace A1::LLVM
@@ -15,4 +16,11 @@ namespace A1::LLVM
 
 [[ nodiscard ]] bool compile( Compiler::Settings settings, AST::Node::Pointer const & node );
 
+/**
+ * Compiles and links the module in memory, the linked module is returned instead of being written
+ * into the executable file. Returns false if the target is not supported, failure of the linker
+ * is reported as the diagnostic of the output.
+ */
+[[ nodiscard ]] bool compile( Compiler::Settings const & settings, AST::Node::Pointer const & node, Compiler::Output & output );
+
 } // namespace A1::LLVM
\ No newline at end of file
@@ -0,0 +1,51 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <CoreLib/Errors/ErrorInfo.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace A1::Compiler
+{
+
+/**
+ * Error which has stopped the compilation, e.g. the syntax or the type error.
+ */
+struct Diagnostic
+{
+    /** Position of the error, unless the error is not related to the source code. */
+    std::optional< ErrorInfo > errorInfo;
+
+    std::string message;
+};
+
+/**
+ * Result of the compilation of the source code held in memory.
+ */
+struct Output
+{
+    /**
+     * Linked module, i.e. the same bytes the compilation into the executable file writes, which is
+     * the WASM module in production and the executable of the host in tests. Empty if the compilation
+     * has failed.
+     */
+    std::vector< std::uint8_t > objectCode;
+
+    /** Names of the modules imported by the source code, e.g. 'core', which the module is linked with. */
+    std::vector< std::string > importedModules;
+
+    std::vector< Diagnostic > diagnostics;
+
+    [[ nodiscard ]] bool succeeded() const noexcept { return diagnostics.empty(); }
+};
+
+} // namespace A1::Compiler
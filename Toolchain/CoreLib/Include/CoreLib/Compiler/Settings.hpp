@@ -7,11 +7,48 @@
 
 #pragma once
 
+#include <CoreLib/AST/ASTPrinter.hpp>
+#include <CoreLib/Compiler/Statistics.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
 
 namespace A1::Compiler
 {
 
+// fwd
+class Cache;
+
+/**
+ * Level of the LLVM IR optimization, i.e. the pipeline of the -O option.
+ */
+enum class OptimizationLevel : std::uint8_t
+{
+    O0, // no optimization
+    O1,
+    O2,
+    O3,
+    Os, // optimize for size
+    Oz  // optimize aggressively for size
+};
+
+/**
+ * Parses optimization level from its name, i.e. '0', '1', '2', '3', 's' or 'z'.
+ */
+[[ nodiscard ]] constexpr std::optional< OptimizationLevel > toOptimizationLevel( std::string_view const name ) noexcept
+{
+    if ( name == "0" ) { return OptimizationLevel::O0; }
+    if ( name == "1" ) { return OptimizationLevel::O1; }
+    if ( name == "2" ) { return OptimizationLevel::O2; }
+    if ( name == "3" ) { return OptimizationLevel::O3; }
+    if ( name == "s" ) { return OptimizationLevel::Os; }
+    if ( name == "z" ) { return OptimizationLevel::Oz; }
+    return std::nullopt;
+}
+
 struct Settings
 {
     /** Name of the compiled executable file. */
@@ -20,8 +57,42 @@ struct Settings
     /** Write AST to standard output. */
     bool outputAST{ false };
 
+    /** Format in which AST is written to standard output. */
+    AST::PrintFormat astFormat{ AST::PrintFormat::Text };
+
     /** Write generated LLVM IR code to standard output. */
     bool outputIR{ false };
+
+    /** Level of the LLVM IR optimization, contract functions are never optimized away. */
+    OptimizationLevel optimizationLevel{ OptimizationLevel::O0 };
+
+    /**
+     * Number of threads the contracts and functions of the module are compiled on. Object code
+     * does not depend on the number of threads, as the module is partitioned the same way anyway.
+     */
+    std::size_t threadsCount{ 1U };
+
+    /** If set, statistics of each compilation phase are collected into it. */
+    Statistics * statistics{ nullptr };
+
+    /**
+     * If set, the executable is restored from the cache when the sources have not changed, and stored
+     * into the cache otherwise. Cache is bypassed if the AST or LLVM IR is written to standard output.
+     */
+    Cache * cache{ nullptr };
+};
+
+/**
+ * Options of the compilation of the source code held in memory, which neither writes
+ * any file nor writes to the standard output.
+ */
+struct Options
+{
+    /** Level of the LLVM IR optimization, contract functions are never optimized away. */
+    OptimizationLevel optimizationLevel{ OptimizationLevel::O0 };
+
+    /** Number of threads the contracts and functions of the module are compiled on. */
+    std::size_t threadsCount{ 1U };
 };
 
 } // namespace A1::Compiler
\ No newline at end of file
@@ -0,0 +1,89 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <CoreLib/AST/ASTNode.hpp>
+#include <CoreLib/Tokenizer/Token.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <string_view>
+#include <vector>
+
+namespace A1::Compiler
+{
+
+/**
+ * Statistics collected while compiling a module. Collecting is enabled by
+ * pointing Settings::statistics to an instance of this struct.
+ */
+struct Statistics
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Phase
+    {
+        /** Name of the phase, e.g. 'parsing'. */
+        std::string_view name;
+
+        Clock::duration duration{};
+
+        /** Number of items processed in the phase, e.g. tokens or AST nodes. */
+        std::size_t items{ 0U };
+
+        /** Name of the items processed in the phase, empty if phase does not have any. */
+        std::string_view unit;
+    };
+
+    /** Number of tokens per token kind, e.g. 'identifier' or 'keyword'. */
+    std::map< std::string_view, std::size_t > tokens;
+
+    /** Number of AST nodes per node type, leaf nodes are counted per kind of value. */
+    std::map< std::string_view, std::size_t > nodes;
+
+    /** Total number of AST nodes. */
+    std::size_t nodesCount{ 0U };
+
+    /** Approximate number of bytes held by the AST, including the heap allocated names and strings. */
+    std::size_t astBytes{ 0U };
+
+    /** Number of LLVM functions defined in the generated module. */
+    std::size_t llvmFunctions{ 0U };
+
+    /** Number of LLVM instructions in the generated module. */
+    std::size_t llvmInstructions{ 0U };
+
+    /** Compilation phases in the order they have run. */
+    std::vector< Phase > phases;
+
+    void countToken( Token const & token );
+
+    /**
+     * Recounts the nodes of the AST rooted at the node, i.e. the previous
+     * node statistics are discarded. Returns the total number of nodes.
+     */
+    std::size_t countNodes( AST::Node const & root );
+
+    /**
+     * Records a phase which has started at the specific point in time and has just finished.
+     */
+    void record( std::string_view const name, Clock::time_point const start, std::size_t const items = 0U, std::string_view const unit = {} );
+
+    /**
+     * Records a phase of the specific duration, e.g. the total time of a phase which has run on multiple threads.
+     */
+    void record( std::string_view const name, Clock::duration const duration, std::size_t const items = 0U, std::string_view const unit = {} );
+};
+
+/**
+ * Writes the statistics into the stream, including the throughput of each phase.
+ */
+void print( Statistics const & statistics, std::FILE * stream = stdout );
+
+} // namespace A1::Compiler
@@ -18,7 +18,10 @@ namespace A1
 
 struct ParsingError : std::runtime_error
 {
-    explicit ParsingError( ErrorInfo errorInfo, std::string_view const additionalMsg ) : std::runtime_error( "" )
+    explicit ParsingError( ErrorInfo errorInfo, std::string_view const additionalMsg )
+    : std::runtime_error( "" )
+    , errorInfo_{ errorInfo }
+    , message_  { additionalMsg }
     {
         msg_ = fmt::format
         (
@@ -31,7 +34,15 @@ struct ParsingError : std::runtime_error
 
     char const * what() const noexcept override { return msg_.data(); }
 
+    /** Position of the error in the source code. */
+    [[ nodiscard ]] ErrorInfo errorInfo() const noexcept { return errorInfo_; }
+
+    /** Message of the error, without the position. */
+    [[ nodiscard ]] std::string_view message() const noexcept { return message_; }
+
 private:
+    ErrorInfo   errorInfo_;
+    std::string message_;
     std::string msg_;
 };
 
@@ -0,0 +1,49 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <CoreLib/Errors/ErrorInfo.hpp>
+
+#include <fmt/format.h>
+
+#include <stdexcept>
+
+namespace A1
+{
+
+struct SemanticError : std::runtime_error
+{
+    explicit SemanticError( ErrorInfo errorInfo, std::string_view const additionalMsg )
+    : std::runtime_error( "" )
+    , errorInfo_{ errorInfo }
+    , message_  { additionalMsg }
+    {
+        msg_ = fmt::format
+        (
+            "{}:{}: error: {}",
+            errorInfo.lineNumber,
+            errorInfo.columnNumber,
+            additionalMsg
+        );
+    }
+
+    char const * what() const noexcept override { return msg_.data(); }
+
+    /** Position of the error in the source code. */
+    [[ nodiscard ]] ErrorInfo errorInfo() const noexcept { return errorInfo_; }
+
+    /** Message of the error, without the position. */
+    [[ nodiscard ]] std::string_view message() const noexcept { return message_; }
+
+private:
+    ErrorInfo   errorInfo_;
+    std::string message_;
+    std::string msg_;
+};
+
+} // namespace A1
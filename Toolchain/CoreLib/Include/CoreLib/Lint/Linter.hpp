@@ -0,0 +1,114 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <CoreLib/AST/ASTNode.hpp>
+#include <CoreLib/AST/ASTNodeIndex.hpp>
+#include <CoreLib/Errors/ErrorInfo.hpp>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace A1::Lint
+{
+
+struct Diagnostic
+{
+    /** Name of the rule which has reported the diagnostic. */
+    std::string_view rule;
+
+    ErrorInfo   errorInfo;
+    std::string message;
+
+    [[ nodiscard ]] bool operator==( Diagnostic const & ) const = default;
+};
+
+/**
+ * Collects diagnostics reported by the rules, on behalf of the rule being run.
+ */
+class Reporter
+{
+public:
+    explicit Reporter( std::vector< Diagnostic > & diagnostics ) noexcept
+    : diagnostics_{ diagnostics }
+    {}
+
+    void report( AST::Node const & node, std::string message )
+    {
+        diagnostics_.push_back( { .rule = rule_, .errorInfo = node.errorInfo(), .message = std::move( message ) } );
+    }
+
+private:
+    friend class Linter;
+
+    std::vector< Diagnostic > & diagnostics_;
+    std::string_view            rule_;
+};
+
+/**
+ * Static analysis rule, invoked only for the nodes of the types it is interested in.
+ * Rules are invoked concurrently for different top-level definitions, hence
+ * they must not modify any state while checking a node.
+ */
+class Rule
+{
+public:
+    virtual ~Rule() = default;
+
+    [[ nodiscard ]] virtual std::string_view name() const noexcept = 0;
+
+    [[ nodiscard ]] virtual std::vector< AST::NodeType > nodeTypes() const = 0;
+
+    virtual void check( AST::Node const & node, Reporter & reporter ) const = 0;
+};
+
+/**
+ * Runs all the registered rules in a single traversal of the tree, dispatching
+ * each node only to the rules interested in its type.
+ */
+class Linter
+{
+public:
+    void addRule( std::unique_ptr< Rule > rule );
+
+    /**
+     * Runs the rules over the module. If the node index of the module is provided,
+     * the tree is not traversed at all and only the nodes of interest are visited.
+     * Otherwise, top-level definitions are traversed in parallel, using up to the
+     * specified number of threads. Diagnostics are ordered by their position.
+     */
+    [[ nodiscard ]] std::vector< Diagnostic > run
+    (
+        AST::Node      const & root,
+        AST::NodeIndex const * index        = nullptr,
+        std::size_t            threadsCount = 1U
+    ) const;
+
+private:
+    void dispatch( AST::Node const & node, Reporter & reporter ) const;
+
+    std::vector< std::unique_ptr< Rule > > rules_;
+
+    /** Rules interested in each of the node types. */
+    std::array< std::vector< Rule const * >, static_cast< std::size_t >( AST::NodeType::Count ) > dispatchTable_;
+};
+
+/**
+ * Built-in rules:
+ *  - 'unused-variable' - variable defined within a function is never referenced,
+ *  - 'shadowed-name'   - variable defined within a function hides a function parameter
+ *                        or a module-level definition with the same name,
+ *  - 'missing-init'    - contract declares data members without initial values,
+ *                        yet it does not define the '__init__' function.
+ */
+[[ nodiscard ]] std::vector< std::unique_ptr< Rule > > builtinRules();
+
+} // namespace A1::Lint
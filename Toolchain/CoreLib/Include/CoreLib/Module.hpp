@@ -7,13 +7,70 @@
 
 #pragma once
 
+#include <CoreLib/AST/ASTNode.hpp>
 #include <CoreLib/Compiler/Settings.hpp>
 
 #include <filesystem>
+#include <string>
+#include <vector>
 
 namespace A1
 {
 
+/**
+ * Parses the source file along with all the modules it imports, recursively.
+ * Module 'name' is looked up as 'name.ao' in the directory of the importing file,
+ * imports which are not found there, e.g. 'core', are left to the linker.
+ * Imported modules are merged into the returned module, preceding the
+ * statements of the modules which import them. If requested, paths of
+ * the imported source files are written into importedFiles, and the paths
+ * the other imports have been looked up at are written into unresolvedImports.
+ */
+[[ nodiscard ]] AST::Node::Pointer parseModule
+(
+    std::filesystem::path const inputFile,
+    Compiler::Statistics * statistics = nullptr,
+    std::vector< std::filesystem::path > * importedFiles = nullptr,
+    std::vector< std::filesystem::path > * unresolvedImports = nullptr
+);
+
 [[ nodiscard ]] bool load( Compiler::Settings settings, std::filesystem::path const inputFile );
 
+/**
+ * Source file of the batch, along with the executable file it is compiled into.
+ */
+struct LoadJob
+{
+    std::filesystem::path inputFile;
+    std::string           executableFilename;
+};
+
+/**
+ * Result of the compilation of a single file of the batch.
+ */
+struct LoadResult
+{
+    std::filesystem::path inputFile;
+
+    /** Error which has stopped the compilation, empty if the file has been compiled. */
+    std::string error;
+
+    /** Statistics of the compilation, collected only if the settings point to statistics. */
+    Compiler::Statistics statistics;
+
+    [[ nodiscard ]] bool succeeded() const noexcept { return error.empty(); }
+};
+
+/**
+ * Compiles the source files on the pool of workers, each one into its own executable file, within
+ * a single process. An error in one file does not stop the others. LLVM backend is initialized once,
+ * each worker reuses its target for all the files it compiles. Results are in the order of the jobs.
+ */
+[[ nodiscard ]] std::vector< LoadResult > loadAll
+(
+    Compiler::Settings      const & settings,
+    std::vector< LoadJob >  const & jobs,
+    std::size_t             const   workersCount
+);
+
 } // namespace A1
\ No newline at end of file
@@ -0,0 +1,26 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <CoreLib/AST/ASTNode.hpp>
+#include <CoreLib/Semantic/SymbolTable.hpp>
+
+namespace A1::Semantic
+{
+
+/**
+ * Resolves names within their scopes and annotates every expression node
+ * of the module with its type, so that later phases do not need to deduce it.
+ * Expressions which have no value, e.g. calls of functions returning nothing,
+ * are left with null type. Code generation relies on the types resolved here.
+ *
+ * Throws SemanticError if the types of the operands are incompatible.
+ */
+[[ nodiscard ]] SymbolTable analyze( AST::Node & moduleNode );
+
+} // namespace A1::Semantic
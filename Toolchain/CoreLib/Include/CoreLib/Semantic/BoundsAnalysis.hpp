@@ -0,0 +1,28 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <CoreLib/AST/ASTNode.hpp>
+
+#include <unordered_set>
+
+namespace A1::Semantic
+{
+
+/**
+ * Finds the array and string subscripts which cannot be out of bounds, thus the code generator omits
+ * their bounds checks. Subscript 'A[i]' within the loop 'while i < len(A)' is in bounds if
+ * 'i' is a local variable which is never negative, i.e. it is only initialized, assigned and
+ * incremented with non-negative integer literals, and if the statements of the loop body
+ * preceding the subscript neither write 'i' nor replace 'A'. Arrays never shrink, hence
+ * appending to 'A' keeps the subscript in bounds, whereas the calls of user-defined
+ * functions are assumed to replace it.
+ */
+[[ nodiscard ]] std::unordered_set< AST::Node const * > findInBoundsSubscripts( AST::Node const & moduleNode );
+
+} // namespace A1::Semantic
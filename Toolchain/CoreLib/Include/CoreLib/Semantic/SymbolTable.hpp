@@ -0,0 +1,65 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <CoreLib/Types.hpp>
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace A1::Semantic
+{
+
+/**
+ * Functions and contracts defined in the module, gathered once
+ * by the semantic analysis before any of the bodies is analyzed.
+ */
+struct SymbolTable final
+{
+    template< typename T >
+    using Table = std::map< std::string, T, std::less<> >;
+
+    struct Variable
+    {
+        std::string name;
+        TypeID      typeID{ nullptr };
+    };
+
+    struct Function
+    {
+        /** Parameters in the order of declaration, including 'self' parameter of the contract's functions. */
+        std::vector< Variable > parameters;
+
+        /** Null if the function does not return a value. */
+        TypeID returnTypeID{ nullptr };
+    };
+
+    struct DataMember
+    {
+        TypeID      typeID{ nullptr };
+        std::size_t index { 0U };
+    };
+
+    struct Contract
+    {
+        TypeID typeID{ nullptr };
+
+        Table< DataMember > dataMembers;
+        Table< Function   > functions;
+    };
+
+    /** Stores all functions defined at the module's top level. */
+    Table< Function > functions;
+
+    /** Stores all user-defined contract and class types. */
+    Table< Contract > contracts;
+};
+
+} // namespace A1::Semantic
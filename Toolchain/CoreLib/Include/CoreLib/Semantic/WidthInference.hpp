@@ -0,0 +1,27 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <CoreLib/AST/ASTNode.hpp>
+
+namespace A1::Semantic
+{
+
+/**
+ * Narrows the type of local variables defined without type annotation and initialized
+ * with an integer literal, e.g. 'let i = 0', to the narrowest of i8, i16 and i32 which
+ * holds every value the variable may take. Values are bounded by the literals assigned
+ * to the variable and by the conditions of the loops incrementing or decrementing it.
+ * Variables whose values cannot be bounded keep num type.
+ *
+ * Inferred type is set on the identifier node of the variable definition, thus the
+ * pass is meant to run after the semantic analysis, whose expression types are kept.
+ */
+void inferIntegerWidths( AST::Node & moduleNode );
+
+} // namespace A1::Semantic
@@ -105,6 +105,7 @@ enum class ReservedToken : std::uint8_t
     KwI16,
     KwI32,
     KwI64,
+    KwI256,
     KwLambda,
     KwLet,
     KwMap,
@@ -124,6 +125,7 @@ enum class ReservedToken : std::uint8_t
     KwU16,
     KwU32,
     KwU64,
+    KwU256,
     KwWhile,
     KwWith,
     KwYield,
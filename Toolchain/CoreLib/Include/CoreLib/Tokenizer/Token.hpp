@@ -11,6 +11,7 @@
 #include <CoreLib/Errors/ErrorInfo.hpp>
 #include <CoreLib/Utils/Macros.hpp>
 
+#include <cstdint>
 #include <variant>
 #include <string>
 
@@ -27,14 +28,24 @@ struct Identifier
     static constexpr auto toString() noexcept { return "identifier"; }
 };
 
+/**
+ * Numbers are fixed-point decimals with up to 'maxDecimals' digits after the decimal point.
+ * Literal keeps the digits as written, i.e. 1.25 is the value of 125 with 2 decimals.
+ */
 struct Number
 {
     using Type = std::int64_t;
 
-    Type value{ 0 };
+    static constexpr std::uint8_t maxDecimals{ 6U };
+
+    Type         value   { 0 };
+    std::uint8_t decimals{ 0U };
 
     [[ nodiscard ]] bool operator==( Number const & ) const = default;
 
+    /** Literal as written in the source code, e.g. '1.25'. */
+    [[ nodiscard ]] std::string toDecimalString() const;
+
     [[ nodiscard ]]
     static constexpr auto toString() noexcept { return "number"; }
 };
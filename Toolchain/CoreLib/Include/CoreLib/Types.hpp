@@ -7,7 +7,10 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -28,11 +31,13 @@ enum class PrimitiveType : std::uint8_t
     I16,
     I32,
     I64,
+    I256,
 
     U8,
     U16,
     U32,
     U64,
+    U256,
 
     // Number of possible primitive types
     Count
@@ -41,15 +46,42 @@ enum class PrimitiveType : std::uint8_t
 // Forward declarations
 
 struct ArrayType;
+struct ContractType;
 struct FunctionType;
 struct MapType;
 
-using Type   = std::variant< PrimitiveType, ArrayType, FunctionType, MapType >;
+using Type   = std::variant< PrimitiveType, ArrayType, ContractType, FunctionType, MapType >;
 using TypeID = Type const *;
 
+/**
+ * Compound types refer to their component types by handle, thus two compound
+ * types are structurally equal if their components are the same handles.
+ */
+
+/**
+ * Array of class instances stores them inline, one after another, unless it opts
+ * in for the struct-of-arrays layout, e.g. 'array[Proposal, soa]', which stores
+ * each data member in its own column.
+ */
+enum class ArrayLayout : std::uint8_t
+{
+    ArrayOfStructs,
+    StructOfArrays
+};
+
 struct ArrayType
 {
-    TypeID innerTypeID{ nullptr };
+    TypeID      innerTypeID{ nullptr };
+    ArrayLayout layout     { ArrayLayout::ArrayOfStructs };
+
+    [[ nodiscard ]] bool operator==( ArrayType const & ) const = default;
+};
+
+struct ContractType
+{
+    std::string name;
+
+    [[ nodiscard ]] bool operator==( ContractType const & ) const = default;
 };
 
 struct FunctionType
@@ -57,25 +89,47 @@ struct FunctionType
     struct ParameterType
     {
         TypeID typeID{ nullptr };
+
+        [[ nodiscard ]] bool operator==( ParameterType const & ) const = default;
     };
 
     TypeID                       returnTypeID{ nullptr };
     std::vector< ParameterType > parameterTypeIDs{};
+
+    [[ nodiscard ]] bool operator==( FunctionType const & ) const = default;
 };
 
 struct MapType
 {
     TypeID keyTypeID{ nullptr };
     TypeID valueTypeID{ nullptr };
+
+    [[ nodiscard ]] bool operator==( MapType const & ) const = default;
 };
 
+/**
+ * Type handles are unique, i.e. structurally equal types always have the same
+ * handle, hence types are compared by comparing their handles. Compound types
+ * are interned on first use into a table which is shared by all the threads,
+ * their handles stay valid until the program exits.
+ */
 namespace Registry
 {
 
 [[ nodiscard ]] TypeID getHandle( Type const & type ) noexcept;
 
-[[ nodiscard ]] TypeID getArrayHandle( TypeID const inner ) noexcept;
-[[ nodiscard ]] TypeID getMapHandle  ( TypeID const key, TypeID const value ) noexcept;
+/**
+ * Compound type handles are null if any of the component type handles is null,
+ * except for the return type of the function, which is null if function returns nothing.
+ */
+[[ nodiscard ]] TypeID getArrayHandle   ( TypeID const inner, ArrayLayout const layout = ArrayLayout::ArrayOfStructs ) noexcept;
+[[ nodiscard ]] TypeID getMapHandle     ( TypeID const key, TypeID const value ) noexcept;
+[[ nodiscard ]] TypeID getFunctionHandle( TypeID const returnType, std::vector< TypeID > const & parameterTypes ) noexcept;
+
+/**
+ * Contract types are nominal, i.e. contracts with the same name share the handle.
+ */
+[[ nodiscard ]] TypeID getContractHandle( std::string_view const name );
 
 [[ nodiscard ]] TypeID getAddressHandle() noexcept;
 
@@ -88,11 +142,37 @@ namespace Registry
 [[ nodiscard ]] TypeID getI32Handle() noexcept;
 [[ nodiscard ]] TypeID getI64Handle() noexcept;
 
+[[ nodiscard ]] TypeID getI256Handle() noexcept;
+
 [[ nodiscard ]] TypeID getU8Handle () noexcept;
 [[ nodiscard ]] TypeID getU16Handle() noexcept;
 [[ nodiscard ]] TypeID getU32Handle() noexcept;
 [[ nodiscard ]] TypeID getU64Handle() noexcept;
 
+[[ nodiscard ]] TypeID getU256Handle() noexcept;
+
+/**
+ * Dense index of the type, meant for the tables indexed by type. Primitive types take
+ * the indices below PrimitiveType::Count in the order of their declaration, with 0 being
+ * the index of the null handle. Compound types are numbered in the order of interning.
+ */
+[[ nodiscard ]] std::size_t getIndex( TypeID const id ) noexcept;
+
+/** Checks whether values of the type are represented as integers, i.e. num, bool and sized integers. */
+[[ nodiscard ]] bool isNumeric( TypeID const id ) noexcept;
+
+/** Checks whether values of the type are signed integers, i.e. num and signed sized integers. */
+[[ nodiscard ]] bool isSigned( TypeID const id ) noexcept;
+
+/**
+ * Checks whether values of the type are 256-bit integers, which are wider than num.
+ * Operations involving such values are performed on 256 bits, not to lose the precision.
+ */
+[[ nodiscard ]] bool isWide( TypeID const id ) noexcept;
+
+/** Name of the type as it is written in the source code, e.g. 'map[str, num]'. */
+[[ nodiscard ]] std::string_view toStringView( TypeID const id ) noexcept;
+
 } // namespace Registry
 
 } // namespace A1
\ No newline at end of file
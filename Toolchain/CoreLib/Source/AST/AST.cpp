@@ -15,6 +15,7 @@
 #include <fmt/format.h>
 
 #include <stdexcept>
+#include <utility>
 #include <cstdint>
 #include <vector>
 
@@ -126,11 +127,15 @@ namespace
             case ReservedToken::KwI32: return Registry::getI32Handle();
             case ReservedToken::KwI64: return Registry::getI64Handle();
 
+            case ReservedToken::KwI256: return Registry::getI256Handle();
+
             case ReservedToken::KwU8 : return Registry::getU8Handle ();
             case ReservedToken::KwU16: return Registry::getU16Handle();
             case ReservedToken::KwU32: return Registry::getU32Handle();
             case ReservedToken::KwU64: return Registry::getU64Handle();
 
+            case ReservedToken::KwU256: return Registry::getU256Handle();
+
             default:
                 return nullptr;
         }
@@ -288,11 +293,15 @@ namespace
             IGNORE_TOKEN( KwI32 );
             IGNORE_TOKEN( KwI64 );
 
+            IGNORE_TOKEN( KwI256 );
+
             IGNORE_TOKEN( KwU8  );
             IGNORE_TOKEN( KwU16 );
             IGNORE_TOKEN( KwU32 );
             IGNORE_TOKEN( KwU64 );
 
+            IGNORE_TOKEN( KwU256 );
+
 #undef IGNORE_TOKEN
 
             default:
@@ -304,6 +313,65 @@ namespace
 #undef MAP_TOKEN_TO_NODE
     }
 
+    /**
+     * Parses the type, i.e. either the primitive type, the compound type or the name of the
+     * contract or class. Returns null if the token does not start the type.
+     */
+    [[ nodiscard ]] TypeID parseTypeID( TokenIterator & token )
+    {
+        if ( token->is< Identifier >() )
+        {
+            auto const typeID{ Registry::getContractHandle( token->get< Identifier >().name ) };
+            ++token;
+            return typeID;
+        }
+        else if ( !token->is< ReservedToken >() ) { return nullptr; }
+
+        switch ( token->get< ReservedToken >() )
+        {
+            case ReservedToken::KwArray:
+            {
+                skip< ReservedToken::KwArray         >( token );
+                skip< ReservedToken::OpSubscriptOpen >( token );
+
+                auto const innerTypeID{ parseTypeID( token ) };
+                auto       layout     { ArrayLayout::ArrayOfStructs };
+
+                if ( token->is< ReservedToken >() && token->get< ReservedToken >() == ReservedToken::OpComma )
+                {
+                    ++token;
+                    if ( !token->is< Identifier >() || token->get< Identifier >().name != "soa" )
+                    {
+                        throw ParsingError{ token->errorInfo(), "Expecting array layout 'soa'" };
+                    }
+                    ++token;
+                    layout = ArrayLayout::StructOfArrays;
+                }
+
+                skip< ReservedToken::OpSubscriptClose >( token );
+                return Registry::getArrayHandle( innerTypeID, layout );
+            }
+            case ReservedToken::KwMap:
+            {
+                skip< ReservedToken::KwMap           >( token );
+                skip< ReservedToken::OpSubscriptOpen >( token );
+
+                auto const keyTypeID{ parseTypeID( token ) };
+                skip< ReservedToken::OpComma >( token );
+                auto const valueTypeID{ parseTypeID( token ) };
+
+                skip< ReservedToken::OpSubscriptClose >( token );
+                return Registry::getMapHandle( keyTypeID, valueTypeID );
+            }
+            default:
+            {
+                auto const typeID{ getPrimitiveTypeID( token->get< ReservedToken >() ) };
+                if ( typeID != nullptr ) { ++token; }
+                return typeID;
+            }
+        }
+    }
+
     struct Any {};
 
     template< typename T >
@@ -319,47 +387,22 @@ namespace
                     case ReservedToken::KwFalse: ++token; return std::make_unique< Node >( false, errorInfo );
                     case ReservedToken::KwTrue : ++token; return std::make_unique< Node >( true , errorInfo );
 
-                    case ReservedToken::KwArray:
-                    {
-                        skip< ReservedToken::KwArray         >( token );
-                        skip< ReservedToken::OpSubscriptOpen >( token );
-
-                        if ( !token->is< ReservedToken >() ) { break; }
-                        auto const innerTypeID{ getPrimitiveTypeID( token->get< ReservedToken >() ) };
-                        ++token;
-
-                        skip< ReservedToken::OpSubscriptClose >( token );
-                        return std::make_unique< Node >( Registry::getArrayHandle( innerTypeID ), errorInfo );
-                    }
-                    case ReservedToken::KwMap:
-                    {
-                        skip< ReservedToken::KwMap           >( token );
-                        skip< ReservedToken::OpSubscriptOpen >( token );
-
-                        if ( !token->is< ReservedToken >() ) { break; }
-                        auto const keyTypeID{ getPrimitiveTypeID( token->get< ReservedToken >() ) };
-                        ++token;
-
-                        skip< ReservedToken::OpComma >( token );
-
-                        if ( !token->is< ReservedToken >() ) { break; }
-                        auto const valueTypeID{ getPrimitiveTypeID( token->get< ReservedToken >() ) };
-                        ++token;
-
-                        skip< ReservedToken::OpSubscriptClose >( token );
-                        return std::make_unique< Node >( Registry::getMapHandle( keyTypeID, valueTypeID ), errorInfo );
-                    }
                     default:
                     {
-                        if ( auto const typeID{ getPrimitiveTypeID( token->get< ReservedToken >() ) }; typeID != nullptr )
+                        if ( auto const typeID{ parseTypeID( token ) }; typeID != nullptr )
                         {
-                            ++token;
                             return std::make_unique< Node >( typeID, errorInfo );
                         }
                         break;
                     }
                 }
             }
+            else if ( token->is< Identifier >() )
+            {
+                // Contract or class name
+                auto const errorInfo{ token->errorInfo() };
+                return std::make_unique< Node >( parseTypeID( token ), errorInfo );
+            }
 
             throw ParsingError{ token->errorInfo(), "Expecting type identifier" };
         }
@@ -393,6 +436,14 @@ namespace
         }
     }
 
+    /**
+     * Index filled while parsing, if requested. All the non-leaf nodes are created
+     * in popOperator, which is deeply nested in the recursive descent, thus the index
+     * is made available to it here rather than passed through every parsing function.
+     * Thread local, so that modules can be parsed in parallel.
+     */
+    thread_local NodeIndex * activeIndex{ nullptr };
+
     void popOperator
     (
         std::stack< Node::Pointer > & operands,
@@ -430,6 +481,8 @@ namespace
             )
         );
 
+        if ( activeIndex != nullptr ) { activeIndex->add( *operands.top() ); }
+
         operators.pop();
     }
 
@@ -598,6 +651,16 @@ namespace
                 {
                     skip< ReservedToken::OpSubscriptOpen >( token );
                     operands.push( parseImpl( token ) );
+
+                    if ( token->is< ReservedToken >() && token->get< ReservedToken >() == ReservedToken::OpColon )
+                    {
+                        // Subscript of the range, e.g. 's[1:4]', is the slice
+                        skip< ReservedToken::OpColon >( token );
+                        operands.push( parseImpl( token ) );
+
+                        nodeInfo.type          = NodeType::Slice;
+                        nodeInfo.operandsCount = getOperandsCount( NodeType::Slice );
+                    }
                 }
                 else if ( nodeInfo.type == NodeType::StatementIf || nodeInfo.type == NodeType::StatementElif )
                 {
@@ -778,7 +841,12 @@ namespace
 
                 operators.push( nodeInfo );
 
-                expectingOperand = nodeInfo.operandsCount != 0;
+                // Parenthesized expression, subscript and slice are complete operands, thus '-' following them is binary
+                expectingOperand =
+                    nodeInfo.operandsCount != 0 &&
+                    nodeInfo.type != NodeType::Parentheses &&
+                    nodeInfo.type != NodeType::Index &&
+                    nodeInfo.type != NodeType::Slice;
             }
             else
             {
@@ -887,9 +955,31 @@ namespace
     }
 } // namespace
 
-Node::Pointer parse( TokenIterator & token )
+Node::Pointer parse( TokenIterator & token, NodeIndex * index )
 {
-    return parseImpl( token, 0U, false );
+    struct ActiveIndexGuard
+    {
+        explicit ActiveIndexGuard( NodeIndex * index ) noexcept
+        : previous_{ std::exchange( activeIndex, index ) }
+        {}
+
+        ~ActiveIndexGuard() { activeIndex = previous_; }
+
+    private:
+        NodeIndex * previous_;
+    };
+
+    ActiveIndexGuard const guard{ index };
+    try
+    {
+        return parseImpl( token, 0U, false );
+    }
+    catch ( ... )
+    {
+        // Indexed nodes have been destroyed while unwinding
+        if ( index != nullptr ) { index->clear(); }
+        throw;
+    }
 }
 
 } // namespace A1::AST
\ No newline at end of file
@@ -16,13 +16,13 @@ NodePrecedence getPrecedence( NodeType const type ) noexcept
 {
     switch ( type )
     {
+        // Subscript binds as the call and the member access do, e.g. 'a[i].b' is '(a[i]).b'
         case NodeType::Call:
         case NodeType::MemberCall:
         case NodeType::Parentheses:
-            return NodePrecedence::Group1;
-
         case NodeType::Index:
-            return NodePrecedence::Group2;
+        case NodeType::Slice:
+            return NodePrecedence::Group1;
 
         case NodeType::Exponent:
             return NodePrecedence::Group3;
@@ -188,6 +188,9 @@ std::size_t getOperandsCount( NodeType const type ) noexcept
         case NodeType::FunctionParameterDefinition:
             return 2U;
 
+        case NodeType::Slice:
+            return 3U;
+
         /**
          * Since the number of operands of the following constructs is
          * variable, it is detected by the parser itself.
@@ -0,0 +1,77 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/AST/ASTInterner.hpp>
+
+namespace A1::AST
+{
+
+Node const * Interner::intern( Node const & node )
+{
+    if ( auto const it{ canonical_.find( &node ) }; it != std::end( canonical_ ) )
+    {
+        return it->second;
+    }
+
+    for ( auto const & child : node.children() )
+    {
+        if ( child != nullptr ) { intern( *child ); }
+    }
+
+    auto const [ begin, end ]{ buckets_.equal_range( node.hash() ) };
+    for ( auto it{ begin }; it != end; ++it )
+    {
+        if ( isCanonicalEqual( node, *it->second ) )
+        {
+            canonical_.emplace( &node, it->second );
+            return it->second;
+        }
+    }
+
+    buckets_  .emplace( node.hash(), &node );
+    canonical_.emplace( &node, &node );
+    return &node;
+}
+
+Node const * Interner::canonical( Node const & node ) const noexcept
+{
+    auto const it{ canonical_.find( &node ) };
+    return it != std::end( canonical_ ) ? it->second : nullptr;
+}
+
+bool Interner::isCanonicalEqual( Node const & node, Node const & candidate ) const noexcept
+{
+    if
+    (
+        node.value() != candidate.value() ||
+        std::size( node.children() ) != std::size( candidate.children() )
+    )
+    {
+        return false;
+    }
+
+    /**
+     * Children of both nodes are already interned, thus it is enough
+     * to compare their canonical nodes instead of whole subtrees.
+     */
+    for ( std::size_t i{ 0U }; i < std::size( node.children() ); ++i )
+    {
+        auto const & child         { node     .children()[ i ] };
+        auto const & candidateChild{ candidate.children()[ i ] };
+
+        if ( child == nullptr || candidateChild == nullptr )
+        {
+            if ( child != candidateChild ) { return false; }
+            continue;
+        }
+
+        if ( canonical( *child ) != canonical( *candidateChild ) ) { return false; }
+    }
+    return true;
+}
+
+} // namespace A1::AST
@@ -10,18 +10,211 @@
 
 #include "Utils/Utils.hpp"
 
+#include <functional>
+#include <string_view>
+#include <utility>
+
 namespace A1::AST
 {
 
+namespace
+{
+    [[ nodiscard ]]
+    std::size_t hashValue( Node::ValueType const & value ) noexcept
+    {
+        auto const payload
+        {
+            std::visit
+            (
+                Overload
+                {
+                    []( NodeType      const   type       ) noexcept { return static_cast< std::size_t >( type ); },
+                    []( Identifier    const & identifier ) noexcept { return std::hash< std::string_view >{}( identifier.name ); },
+                    []( TypeID        const   typeID     ) noexcept { return std::hash< TypeID >{}( typeID ); },
+                    []( Boolean       const   boolean    ) noexcept { return static_cast< std::size_t >( boolean ); },
+                    []( Number        const   number     ) noexcept { return hashCombine( static_cast< std::size_t >( number.value ), number.decimals ); },
+                    []( StringLiteral const & str        ) noexcept { return std::hash< std::string_view >{}( str.value ); }
+                },
+                value
+            )
+        };
+
+        return hashCombine( value.index(), payload );
+    }
+} // namespace
+
+std::string_view toString( NodeType const type ) noexcept
+{
+    switch ( type )
+    {
+#define STR_CASE( x ) case NodeType::x: return #x
+        STR_CASE( Unknown                     );
+        STR_CASE( Call                        );
+        STR_CASE( Parentheses                 );
+        STR_CASE( Index                       );
+        STR_CASE( MemberCall                  );
+        STR_CASE( Exponent                    );
+        STR_CASE( UnaryPlus                   );
+        STR_CASE( UnaryMinus                  );
+        STR_CASE( Multiplication              );
+        STR_CASE( Division                    );
+        STR_CASE( FloorDivision               );
+        STR_CASE( Modulus                     );
+        STR_CASE( Addition                    );
+        STR_CASE( Subtraction                 );
+        STR_CASE( BitwiseLeftShift            );
+        STR_CASE( BitwiseRightShift           );
+        STR_CASE( BitwiseAnd                  );
+        STR_CASE( BitwiseOr                   );
+        STR_CASE( BitwiseXor                  );
+        STR_CASE( BitwiseNot                  );
+        STR_CASE( Equality                    );
+        STR_CASE( Inequality                  );
+        STR_CASE( GreaterThan                 );
+        STR_CASE( GreaterThanEqual            );
+        STR_CASE( LessThan                    );
+        STR_CASE( LessThanEqual               );
+        STR_CASE( IsIdentical                 );
+        STR_CASE( IsNotIdentical              );
+        STR_CASE( IsMemberOf                  );
+        STR_CASE( IsNotMemberOf               );
+        STR_CASE( LogicalNot                  );
+        STR_CASE( LogicalAnd                  );
+        STR_CASE( LogicalOr                   );
+        STR_CASE( Assign                      );
+        STR_CASE( AssignExponent              );
+        STR_CASE( AssignAddition              );
+        STR_CASE( AssignSubtraction           );
+        STR_CASE( AssignMultiplication        );
+        STR_CASE( AssignDivision              );
+        STR_CASE( AssignFloorDivision         );
+        STR_CASE( AssignModulus               );
+        STR_CASE( AssignBitwiseLeftShift      );
+        STR_CASE( AssignBitwiseRightShift     );
+        STR_CASE( AssignBitwiseAnd            );
+        STR_CASE( AssignBitwiseOr             );
+        STR_CASE( AssignBitwiseXor            );
+        STR_CASE( StatementIf                 );
+        STR_CASE( StatementElif               );
+        STR_CASE( StatementElse               );
+        STR_CASE( StatementWhile              );
+        STR_CASE( StatementPass               );
+        STR_CASE( StatementReturn             );
+        STR_CASE( StatementImport             );
+        STR_CASE( StatementAssert             );
+        STR_CASE( ArrayDefinition             );
+        STR_CASE( ClassDefinition             );
+        STR_CASE( ContractDefinition          );
+        STR_CASE( FunctionDefinition          );
+        STR_CASE( FunctionParameterDefinition );
+        STR_CASE( MapDefinition               );
+        STR_CASE( ModuleDefinition            );
+        STR_CASE( VariableDefinition          );
+        STR_CASE( Slice                       );
+#undef STR_CASE
+
+        case NodeType::Count:
+            break;
+    }
+
+    ASSERT( false );
+    return "";
+}
+
 Node::Node( ValueType value, ErrorInfo errorInfo )
 : value_    { std::move( value     ) }
 , errorInfo_{ std::move( errorInfo ) }
+, hash_     { hashValue( value_ ) }
 {}
 
 Node::Node ( ValueType value, std::vector< Pointer > children, ErrorInfo errorInfo )
 : value_    { std::move( value     ) }
 , children_ { std::move( children  ) }
 , errorInfo_{ std::move( errorInfo ) }
-{}
+, hash_     { hashValue( value_ ) }
+{
+    for ( std::size_t i{ 0U }; i < std::size( children_ ); ++i )
+    {
+        auto const & child{ children_[ i ] };
+
+        // Missing child nodes contribute to the hash as well, so that their position is preserved
+        hash_ = hashCombine( hash_, child != nullptr ? child->hash() : 0U );
+
+        if ( child != nullptr )
+        {
+            child->parent_        = this;
+            child->indexInParent_ = i;
+        }
+    }
+}
+
+Node const * Node::previousSibling() const noexcept
+{
+    if ( parent_ == nullptr ) { return nullptr; }
+
+    auto const & siblings{ parent_->children_ };
+    for ( auto i{ indexInParent_ }; i > 0U; --i )
+    {
+        if ( siblings[ i - 1U ] != nullptr ) { return siblings[ i - 1U ].get(); }
+    }
+    return nullptr;
+}
+
+Node const * Node::nextSibling() const noexcept
+{
+    if ( parent_ == nullptr ) { return nullptr; }
+
+    auto const & siblings{ parent_->children_ };
+    for ( auto i{ indexInParent_ + 1U }; i < std::size( siblings ); ++i )
+    {
+        if ( siblings[ i ] != nullptr ) { return siblings[ i ].get(); }
+    }
+    return nullptr;
+}
+
+std::vector< Node::Pointer > Node::releaseChildren() noexcept
+{
+    for ( auto const & child : children_ )
+    {
+        if ( child != nullptr )
+        {
+            child->parent_        = nullptr;
+            child->indexInParent_ = 0U;
+        }
+    }
+
+    hash_ = hashValue( value_ );
+    return std::exchange( children_, {} );
+}
+
+bool equal( Node const & lhs, Node const & rhs ) noexcept
+{
+    if ( &lhs == &rhs ) { return true; }
+
+    if
+    (
+        lhs.hash () != rhs.hash () ||
+        lhs.value() != rhs.value() ||
+        std::size( lhs.children() ) != std::size( rhs.children() )
+    )
+    {
+        return false;
+    }
+
+    for ( std::size_t i{ 0U }; i < std::size( lhs.children() ); ++i )
+    {
+        auto const & l{ lhs.children()[ i ] };
+        auto const & r{ rhs.children()[ i ] };
+
+        if ( l == nullptr || r == nullptr )
+        {
+            if ( l != r ) { return false; }
+            continue;
+        }
+
+        if ( !equal( *l, *r ) ) { return false; }
+    }
+    return true;
+}
 
-} // namespace A1::AST
\ No newline at end of file
+} // namespace A1::AST
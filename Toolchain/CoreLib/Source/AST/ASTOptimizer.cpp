@@ -0,0 +1,571 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/AST/ASTOptimizer.hpp>
+#include <CoreLib/Types.hpp>
+
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace A1::AST
+{
+
+namespace
+{
+    using Statements = std::vector< Node::Pointer >;
+
+    /**
+     * Variables are either defined at the module's top level or in the function's body,
+     * since A1 has no block scope, i.e. variables defined in if and while bodies belong
+     * to the enclosing function.
+     */
+    struct Scope
+    {
+        /** Number of definitions of each variable in the scope. */
+        std::unordered_map< std::string, std::size_t > definitionsCount;
+
+        /** Variables which are assigned to anywhere in the scope. */
+        std::unordered_set< std::string > mutated;
+
+        /** Values of variables which are known to be constant. */
+        std::unordered_map< std::string, Node::ValueType > constants;
+    };
+
+    [[ nodiscard ]]
+    bool is( Node::Pointer const & node, NodeType const type ) noexcept
+    {
+        return node != nullptr && node->is< NodeType >() && node->get< NodeType >() == type;
+    }
+
+    [[ nodiscard ]]
+    bool isAssignment( NodeType const type ) noexcept
+    {
+        return type >= NodeType::Assign && type <= NodeType::AssignBitwiseXor;
+    }
+
+    [[ nodiscard ]]
+    bool opensScope( NodeType const type ) noexcept
+    {
+        return type == NodeType::FunctionDefinition || type == NodeType::ContractDefinition || type == NodeType::ClassDefinition;
+    }
+
+    /**
+     * Checks whether the operand at the index names an entity, e.g. a called function,
+     * an accessed data member or an assigned variable, rather than denoting its value.
+     */
+    [[ nodiscard ]]
+    bool isNameOperand( NodeType const type, std::size_t const index ) noexcept
+    {
+        switch ( type )
+        {
+            case NodeType::MemberCall:
+                return index <= 1U;
+
+            case NodeType::Call:
+            case NodeType::Index:
+            case NodeType::Slice:
+            case NodeType::StatementImport:
+            case NodeType::VariableDefinition:
+            case NodeType::FunctionParameterDefinition:
+                return index == 0U;
+
+            default:
+                return isAssignment( type ) && index == 0U;
+        }
+    }
+
+    /**
+     * Booleans take part in the integer expressions as 0 or 1,
+     * the same way as they do in the generated code.
+     * Decimal literals are left to the fixed-point arithmetic of the generated code.
+     */
+    [[ nodiscard ]]
+    std::optional< Number::Type > getConstant( Node::Pointer const & node ) noexcept
+    {
+        if ( node == nullptr ) { return std::nullopt; }
+
+        if ( node->is< Number  >() && node->get< Number >().decimals == 0U ) { return node->get< Number >().value; }
+        if ( node->is< Boolean >() ) { return node->get< Boolean >() ? 1 : 0; }
+
+        return std::nullopt;
+    }
+
+    /**
+     * Evaluates the operation with constant operands, if possible.
+     *
+     * Arithmetic wraps around on overflow, matching the code generator. Constant operands are
+     * nums or bools, i.e. of signed types, thus comparisons are signed, as the generated ones are.
+     * Operations which trap or are undefined at run-time, i.e. division by zero, signed division
+     * overflow and shifts by more than the number's width, are left intact.
+     */
+    [[ nodiscard ]]
+    std::optional< Node::ValueType > evaluate( NodeType const type, Statements const & operands ) noexcept
+    {
+        using Unsigned = std::make_unsigned_t< Number::Type >;
+
+        auto const number{ []( Unsigned const value ) -> Node::ValueType { return Number{ .value = static_cast< Number::Type >( value ) }; } };
+
+        if ( std::size( operands ) == 1U )
+        {
+            auto const value{ getConstant( operands[ 0U ] ) };
+            if ( !value ) { return std::nullopt; }
+
+            auto const u{ static_cast< Unsigned >( *value ) };
+            switch ( type )
+            {
+                case NodeType::Parentheses: return operands[ 0U ]->value();
+                case NodeType::UnaryPlus  : return number( u );
+                case NodeType::UnaryMinus : return number( Unsigned{ 0U } - u );
+                case NodeType::BitwiseNot : return number( ~u );
+                case NodeType::LogicalNot : return Boolean{ *value == 0 };
+                default                   : return std::nullopt;
+            }
+        }
+        else if ( std::size( operands ) == 2U )
+        {
+            auto const lhs{ getConstant( operands[ 0U ] ) };
+            auto const rhs{ getConstant( operands[ 1U ] ) };
+            if ( !lhs || !rhs ) { return std::nullopt; }
+
+            auto const ul{ static_cast< Unsigned >( *lhs ) };
+            auto const ur{ static_cast< Unsigned >( *rhs ) };
+
+            auto const isDivisionTrapping{ *rhs == 0 || ( *lhs == std::numeric_limits< Number::Type >::min() && *rhs == -1 ) };
+            auto const isShiftUndefined  { *rhs < 0 || *rhs >= std::numeric_limits< Unsigned >::digits };
+
+            switch ( type )
+            {
+                case NodeType::Addition         : return number( ul + ur );
+                case NodeType::Subtraction      : return number( ul - ur );
+                case NodeType::Multiplication   : return number( ul * ur );
+                case NodeType::BitwiseAnd       : return number( ul & ur );
+                case NodeType::BitwiseOr        : return number( ul | ur );
+                case NodeType::BitwiseXor       : return number( ul ^ ur );
+                case NodeType::Equality         : return Boolean{ *lhs == *rhs };
+                case NodeType::Inequality       : return Boolean{ *lhs != *rhs };
+                case NodeType::IsIdentical      : return Boolean{ *lhs == *rhs };
+                case NodeType::IsNotIdentical   : return Boolean{ *lhs != *rhs };
+                case NodeType::GreaterThan      : return Boolean{ *lhs >  *rhs };
+                case NodeType::GreaterThanEqual : return Boolean{ *lhs >= *rhs };
+                case NodeType::LessThan         : return Boolean{ *lhs <  *rhs };
+                case NodeType::LessThanEqual    : return Boolean{ *lhs <= *rhs };
+                case NodeType::LogicalAnd       : return Boolean{ *lhs != 0 && *rhs != 0 };
+                case NodeType::LogicalOr        : return Boolean{ *lhs != 0 || *rhs != 0 };
+
+                // Floor division is generated as signed division which truncates towards zero, while
+                // division of nums results in a decimal, thus only its exact quotient is folded
+                case NodeType::Division         : if ( isDivisionTrapping || *lhs % *rhs != 0 ) { break; } return Number{ .value = *lhs / *rhs };
+                case NodeType::FloorDivision    : if ( isDivisionTrapping ) { break; } return Number{ .value = *lhs / *rhs };
+                case NodeType::Modulus          : if ( isDivisionTrapping ) { break; } return Number{ .value = *lhs % *rhs };
+                case NodeType::BitwiseLeftShift : if ( isShiftUndefined   ) { break; } return number( ul << ur );
+                case NodeType::BitwiseRightShift: if ( isShiftUndefined   ) { break; } return Number{ .value = *lhs >> *rhs };
+
+                default: break;
+            }
+        }
+        return std::nullopt;
+    }
+
+    [[ nodiscard ]]
+    Statements single( Node::Pointer node )
+    {
+        Statements statements;
+        statements.push_back( std::move( node ) );
+        return statements;
+    }
+
+    [[ nodiscard ]]
+    Node::Pointer retag( Node::Pointer node, NodeType const type )
+    {
+        auto const errorInfo{ node->errorInfo() };
+        return std::make_unique< Node >( type, node->releaseChildren(), errorInfo );
+    }
+
+    void append( Statements & statements, Statements appended )
+    {
+        statements.insert( std::end( statements ), std::make_move_iterator( std::begin( appended ) ), std::make_move_iterator( std::end( appended ) ) );
+    }
+
+    [[ nodiscard ]]
+    Node::Pointer fold( Node::Pointer node, Scope const & scope )
+    {
+        if ( node == nullptr ) { return node; }
+
+        if ( node->is< Identifier >() )
+        {
+            if ( auto const it{ scope.constants.find( node->get< Identifier >().name ) }; it != std::end( scope.constants ) )
+            {
+                return std::make_unique< Node >( it->second, node->errorInfo() );
+            }
+            return node;
+        }
+        else if ( node->is_not< NodeType >() )
+        {
+            return node;
+        }
+
+        auto const type{ node->get< NodeType >() };
+        auto children  { node->releaseChildren() };
+
+        for ( std::size_t i{ 0U }; i < std::size( children ); ++i )
+        {
+            if ( isNameOperand( type, i ) && children[ i ] != nullptr && children[ i ]->is< Identifier >() ) { continue; }
+            children[ i ] = fold( std::move( children[ i ] ), scope );
+        }
+
+        if ( auto value{ evaluate( type, children ) } )
+        {
+            return std::make_unique< Node >( std::move( *value ), node->errorInfo() );
+        }
+        return std::make_unique< Node >( type, std::move( children ), node->errorInfo() );
+    }
+
+    /**
+     * Gathers definitions and assignments of the variables in the scope.
+     */
+    void collect( Node const & node, Scope & scope )
+    {
+        if ( node.is_not< NodeType >() ) { return; }
+
+        auto const   type    { node.get< NodeType >() };
+        auto const & children{ node.children() };
+
+        if ( !children.empty() && children[ 0U ] != nullptr && children[ 0U ]->is< Identifier >() )
+        {
+            auto const & name{ children[ 0U ]->get< Identifier >().name };
+
+                 if ( type == NodeType::VariableDefinition ) { ++scope.definitionsCount[ name ]; }
+            else if ( isAssignment( type )                 ) { scope.mutated.insert( name );     }
+        }
+
+        for ( auto const & child : children )
+        {
+            if ( child != nullptr && !( child->is< NodeType >() && opensScope( child->get< NodeType >() ) ) )
+            {
+                collect( *child, scope );
+            }
+        }
+    }
+
+    /**
+     * Counts references of the variables in the scope, except their definitions.
+     */
+    void countReferences( Node const & node, std::unordered_map< std::string, std::size_t > & references )
+    {
+        if ( node.is< Identifier >() )
+        {
+            ++references[ node.get< Identifier >().name ];
+            return;
+        }
+        else if ( node.is_not< NodeType >() || opensScope( node.get< NodeType >() ) )
+        {
+            return;
+        }
+
+        auto const & children{ node.children() };
+        for ( std::size_t i{ 0U }; i < std::size( children ); ++i )
+        {
+            if ( children[ i ] == nullptr || ( i == 0U && node.get< NodeType >() == NodeType::VariableDefinition ) ) { continue; }
+            countReferences( *children[ i ], references );
+        }
+    }
+
+    [[ nodiscard ]]
+    bool isConstantDefinition( Statements const & children, Scope const & scope )
+    {
+        auto const & name{ children[ 0U ]->get< Identifier >().name };
+        if ( scope.definitionsCount.at( name ) != 1U || scope.mutated.contains( name ) ) { return false; }
+
+        auto const & initialization{ children.back() };
+        if ( initialization == nullptr || ( initialization->is_not< Number >() && initialization->is_not< Boolean >() ) ) { return false; }
+
+        // Types other than num and bool can't hold the value as is, thus the definition requires a conversion
+        return
+            std::size( children ) == 2U ||
+            (
+                children[ 1U ]->is< TypeID >() &&
+                (
+                    children[ 1U ]->get< TypeID >() == Registry::getNumHandle () ||
+                    children[ 1U ]->get< TypeID >() == Registry::getBoolHandle()
+                )
+            );
+    }
+
+    [[ nodiscard ]] Statements optimizeStatement( Node::Pointer node, Scope & scope, bool const isTopLevel );
+
+    [[ nodiscard ]]
+    Statements optimizeBody( Statements body, Scope & scope, bool const isTopLevel )
+    {
+        Statements optimized;
+        optimized.reserve( std::size( body ) );
+
+        for ( auto & statement : body )
+        {
+            // Empty statements, e.g. trailing new lines, are dropped
+            if ( statement == nullptr ) { continue; }
+            append( optimized, optimizeStatement( std::move( statement ), scope, isTopLevel ) );
+        }
+        return optimized;
+    }
+
+    /**
+     * Bodies of the statements like if or while require at least one statement,
+     * so the pruned body is replaced with pass statement.
+     */
+    [[ nodiscard ]]
+    Statements optimizeBlock( Statements body, Scope & scope )
+    {
+        auto optimized{ optimizeBody( std::move( body ), scope, false /* isTopLevel */ ) };
+        if ( optimized.empty() )
+        {
+            optimized.push_back( std::make_unique< Node >( NodeType::StatementPass ) );
+        }
+        return optimized;
+    }
+
+    [[ nodiscard ]]
+    Statements optimizeScope( Statements body, bool const requiresStatement )
+    {
+        Scope scope;
+        for ( auto const & statement : body )
+        {
+            if ( statement != nullptr ) { collect( *statement, scope ); }
+        }
+
+        body = optimizeBody( std::move( body ), scope, true /* isTopLevel */ );
+
+        /**
+         * Definitions of the constants are no longer needed
+         * once all the references have been substituted.
+         */
+        if ( !scope.constants.empty() )
+        {
+            std::unordered_map< std::string, std::size_t > references;
+            for ( auto const & statement : body )
+            {
+                countReferences( *statement, references );
+            }
+
+            std::erase_if
+            (
+                body,
+                [ & ]( Node::Pointer const & statement )
+                {
+                    if ( !is( statement, NodeType::VariableDefinition ) ) { return false; }
+
+                    auto const & name{ statement->children()[ 0U ]->get< Identifier >().name };
+                    return scope.constants.contains( name ) && !references.contains( name );
+                }
+            );
+        }
+
+        if ( requiresStatement && body.empty() )
+        {
+            body.push_back( std::make_unique< Node >( NodeType::StatementPass ) );
+        }
+        return body;
+    }
+
+    [[ nodiscard ]]
+    Node::Pointer optimizeFunction( Node::Pointer node )
+    {
+        auto const errorInfo{ node->errorInfo() };
+        auto       children { node->releaseChildren() };
+
+        // Function body follows the function's identifier, parameters and return type
+        auto bodyBegin{ std::begin( children ) + 1 };
+        while ( bodyBegin != std::end( children ) && ( is( *bodyBegin, NodeType::FunctionParameterDefinition ) || ( *bodyBegin != nullptr && ( *bodyBegin )->is< TypeID >() ) ) )
+        {
+            ++bodyBegin;
+        }
+
+        Statements body{ std::make_move_iterator( bodyBegin ), std::make_move_iterator( std::end( children ) ) };
+        children.erase( bodyBegin, std::end( children ) );
+
+        append( children, optimizeScope( std::move( body ), true /* requiresStatement */ ) );
+        return std::make_unique< Node >( NodeType::FunctionDefinition, std::move( children ), errorInfo );
+    }
+
+    [[ nodiscard ]]
+    Node::Pointer optimizeContract( Node::Pointer node )
+    {
+        static Scope const noConstants;
+
+        auto const type     { node->get< NodeType >() };
+        auto const errorInfo{ node->errorInfo() };
+        auto       children { node->releaseChildren() };
+
+        for ( auto & child : children )
+        {
+            if ( is( child, NodeType::FunctionDefinition ) )
+            {
+                child = optimizeFunction( std::move( child ) );
+            }
+            else if ( is( child, NodeType::VariableDefinition ) )
+            {
+                // Data members are not propagated since they are accessed through the contract instance
+                child = fold( std::move( child ), noConstants );
+            }
+        }
+        return std::make_unique< Node >( type, std::move( children ), errorInfo );
+    }
+
+    [[ nodiscard ]]
+    Statements optimizeIf( Node::Pointer node, Scope & scope );
+
+    /**
+     * Optimizes elif or else statement, which follows the if statement's body.
+     */
+    [[ nodiscard ]]
+    Statements optimizeElifOrElse( Node::Pointer node, Scope & scope )
+    {
+        if ( is( node, NodeType::StatementElse ) )
+        {
+            return optimizeBody( node->releaseChildren(), scope, false /* isTopLevel */ );
+        }
+        return optimizeIf( retag( std::move( node ), NodeType::StatementIf ), scope );
+    }
+
+    Statements optimizeIf( Node::Pointer node, Scope & scope )
+    {
+        auto const errorInfo{ node->errorInfo() };
+        auto       children { node->releaseChildren() };
+
+        children[ 0U ] = fold( std::move( children[ 0U ] ), scope );
+
+        Node::Pointer elifOrElse;
+        if ( is( children.back(), NodeType::StatementElif ) || is( children.back(), NodeType::StatementElse ) )
+        {
+            elifOrElse = std::move( children.back() );
+            children.pop_back();
+        }
+
+        Statements body{ std::make_move_iterator( std::begin( children ) + 1 ), std::make_move_iterator( std::end( children ) ) };
+        children.resize( 1U );
+
+        if ( auto const condition{ getConstant( children[ 0U ] ) } )
+        {
+            if ( *condition != 0 )
+            {
+                return optimizeBody( std::move( body ), scope, false /* isTopLevel */ );
+            }
+            return elifOrElse != nullptr ? optimizeElifOrElse( std::move( elifOrElse ), scope ) : Statements{};
+        }
+
+        append( children, optimizeBlock( std::move( body ), scope ) );
+
+        if ( elifOrElse != nullptr )
+        {
+            auto const elifOrElseErrorInfo{ elifOrElse->errorInfo() };
+            auto       optimized          { optimizeElifOrElse( std::move( elifOrElse ), scope ) };
+
+            if ( std::size( optimized ) == 1U && is( optimized[ 0U ], NodeType::StatementIf ) )
+            {
+                children.push_back( retag( std::move( optimized[ 0U ] ), NodeType::StatementElif ) );
+            }
+            else if ( !optimized.empty() )
+            {
+                children.push_back( std::make_unique< Node >( NodeType::StatementElse, std::move( optimized ), elifOrElseErrorInfo ) );
+            }
+        }
+
+        return single( std::make_unique< Node >( NodeType::StatementIf, std::move( children ), errorInfo ) );
+    }
+
+    [[ nodiscard ]]
+    Statements optimizeWhile( Node::Pointer node, Scope & scope )
+    {
+        auto const errorInfo{ node->errorInfo() };
+        auto       children { node->releaseChildren() };
+
+        children[ 0U ] = fold( std::move( children[ 0U ] ), scope );
+
+        if ( auto const condition{ getConstant( children[ 0U ] ) }; condition && *condition == 0 )
+        {
+            return {};
+        }
+
+        Statements body{ std::make_move_iterator( std::begin( children ) + 1 ), std::make_move_iterator( std::end( children ) ) };
+        children.resize( 1U );
+
+        append( children, optimizeBlock( std::move( body ), scope ) );
+        return single( std::make_unique< Node >( NodeType::StatementWhile, std::move( children ), errorInfo ) );
+    }
+
+    [[ nodiscard ]]
+    Statements optimizeVariableDefinition( Node::Pointer node, Scope & scope, bool const isTopLevel )
+    {
+        auto const errorInfo{ node->errorInfo() };
+        auto       children { node->releaseChildren() };
+
+        if ( std::size( children ) >= 2U && children.back() != nullptr && children.back()->is_not< TypeID >() )
+        {
+            children.back() = fold( std::move( children.back() ), scope );
+
+            /**
+             * Only the definitions at the top level of the scope are propagated,
+             * since the ones in if and while bodies may not be executed.
+             */
+            if ( isTopLevel && isConstantDefinition( children, scope ) )
+            {
+                scope.constants[ children[ 0U ]->get< Identifier >().name ] = children.back()->value();
+            }
+        }
+        return single( std::make_unique< Node >( NodeType::VariableDefinition, std::move( children ), errorInfo ) );
+    }
+
+    Statements optimizeStatement( Node::Pointer node, Scope & scope, bool const isTopLevel )
+    {
+        if ( node->is_not< NodeType >() )
+        {
+            return single( fold( std::move( node ), scope ) );
+        }
+
+        switch ( node->get< NodeType >() )
+        {
+            case NodeType::FunctionDefinition: return single( optimizeFunction( std::move( node ) ) );
+            case NodeType::ContractDefinition:
+            case NodeType::ClassDefinition   : return single( optimizeContract( std::move( node ) ) );
+            case NodeType::VariableDefinition: return optimizeVariableDefinition( std::move( node ), scope, isTopLevel );
+            case NodeType::StatementIf       : return optimizeIf   ( std::move( node ), scope );
+            case NodeType::StatementWhile    : return optimizeWhile( std::move( node ), scope );
+            case NodeType::StatementAssert   :
+            {
+                auto assertion{ fold( std::move( node ), scope ) };
+                if ( auto const condition{ getConstant( assertion->children()[ 0U ] ) }; condition && *condition != 0 )
+                {
+                    return {};
+                }
+                return single( std::move( assertion ) );
+            }
+
+            default:
+                return single( fold( std::move( node ), scope ) );
+        }
+    }
+} // namespace
+
+Node::Pointer optimize( Node::Pointer root )
+{
+    if ( !is( root, NodeType::ModuleDefinition ) ) { return root; }
+
+    auto const errorInfo{ root->errorInfo() };
+    return std::make_unique< Node >
+    (
+        NodeType::ModuleDefinition,
+        optimizeScope( root->releaseChildren(), false /* requiresStatement */ ),
+        errorInfo
+    );
+}
+
+} // namespace A1::AST
@@ -11,164 +11,365 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <iterator>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 namespace A1::AST
 {
 
 namespace
 {
-    [[ nodiscard ]]
-    std::string_view toString( TypeID const id ) noexcept
+    /**
+     * Collects the output in a large buffer, either the output string itself or an
+     * internal one which gets written to the stream only once it exceeds the threshold.
+     */
+    class Writer
+    {
+    public:
+        explicit Writer( std::FILE * stream )
+        : stream_{ stream }
+        , buffer_{ &ownBuffer_ }
+        {
+            ownBuffer_.reserve( flushThreshold + flushThreshold / 8U );
+        }
+
+        explicit Writer( std::string & output ) noexcept
+        : buffer_{ &output }
+        {}
+
+        Writer( Writer const & ) = delete;
+        Writer & operator=( Writer const & ) = delete;
+
+        ~Writer() { flush(); }
+
+        void write( std::string_view const str ) { buffer_->append( str ); }
+        void write( char const c )               { buffer_->push_back( c ); }
+
+        template< typename ... Args >
+        void format( fmt::format_string< Args ... > formatString, Args && ... args )
+        {
+            fmt::format_to( std::back_inserter( *buffer_ ), formatString, std::forward< Args >( args ) ... );
+        }
+
+        template< typename T >
+        void writeLittleEndian( T const value )
+        {
+            auto bytes{ std::bit_cast< std::array< char, sizeof( T ) > >( value ) };
+            if constexpr ( std::endian::native == std::endian::big )
+            {
+                std::reverse( std::begin( bytes ), std::end( bytes ) );
+            }
+            buffer_->append( std::data( bytes ), std::size( bytes ) );
+        }
+
+        /**
+         * Writes buffered output to the stream if the buffer is full enough.
+         * Called once per node, which keeps the number of stream writes low.
+         */
+        void checkpoint()
+        {
+            if ( ownBuffer_.size() >= flushThreshold ) { flush(); }
+        }
+
+    private:
+        void flush()
+        {
+            if ( stream_ != nullptr && !ownBuffer_.empty() )
+            {
+                std::fwrite( ownBuffer_.data(), 1U, ownBuffer_.size(), stream_ );
+                ownBuffer_.clear();
+            }
+        }
+
+        static constexpr std::size_t flushThreshold{ 256U * 1024U };
+
+        std::FILE  * stream_{ nullptr };
+        std::string  ownBuffer_;
+        std::string * buffer_;
+    };
+
+    void writeJSONString( Writer & writer, std::string_view const str )
+    {
+        writer.write( '"' );
+        for ( auto const c : str )
+        {
+            switch ( c )
+            {
+                case '"' : writer.write( "\\\"" ); break;
+                case '\\': writer.write( "\\\\" ); break;
+                case '\n': writer.write( "\\n"  ); break;
+                case '\r': writer.write( "\\r"  ); break;
+                case '\t': writer.write( "\\t"  ); break;
+                default:
+                    if ( static_cast< unsigned char >( c ) < 0x20 )
+                    {
+                        writer.format( "\\u{:04x}", static_cast< unsigned >( c ) );
+                    }
+                    else
+                    {
+                        writer.write( c );
+                    }
+                    break;
+            }
+        }
+        writer.write( '"' );
+    }
+
+    void writeBinaryString( Writer & writer, std::string_view const str )
     {
-             if ( id == Registry::getAddressHandle() ) { return "address"; }
-        else if ( id == Registry::getBoolHandle   () ) { return "bool";    }
-        else if ( id == Registry::getNumHandle    () ) { return "num";     }
-        else if ( id == Registry::getStrHandle    () ) { return "str";     }
-        else if ( id == Registry::getI8Handle     () ) { return "i8";      }
-        else if ( id == Registry::getI16Handle    () ) { return "i16";     }
-        else if ( id == Registry::getI32Handle    () ) { return "i32";     }
-        else if ( id == Registry::getI64Handle    () ) { return "i64";     }
-        else if ( id == Registry::getU8Handle     () ) { return "u8";      }
-        else if ( id == Registry::getU16Handle    () ) { return "u16";     }
-        else if ( id == Registry::getU32Handle    () ) { return "u32";     }
-        else if ( id == Registry::getU64Handle    () ) { return "u64";     }
-
-        return "null";
+        writer.writeLittleEndian( static_cast< std::uint32_t >( str.size() ) );
+        writer.write( str );
     }
 
     [[ nodiscard ]]
-    constexpr std::string_view toString( NodeType const type ) noexcept
+    std::uint32_t countChildren( Node const & node ) noexcept
     {
-        switch ( type )
+        std::uint32_t count{ 0U };
+        for ( auto const & child : node.children() )
         {
-#define STR_CASE( x ) case NodeType::x: return #x
-            STR_CASE( Unknown                     );
-            STR_CASE( Call                        );
-            STR_CASE( Parentheses                 );
-            STR_CASE( Index                       );
-            STR_CASE( MemberCall                  );
-            STR_CASE( Exponent                    );
-            STR_CASE( UnaryPlus                   );
-            STR_CASE( UnaryMinus                  );
-            STR_CASE( Multiplication              );
-            STR_CASE( Division                    );
-            STR_CASE( FloorDivision               );
-            STR_CASE( Modulus                     );
-            STR_CASE( Addition                    );
-            STR_CASE( Subtraction                 );
-            STR_CASE( BitwiseLeftShift            );
-            STR_CASE( BitwiseRightShift           );
-            STR_CASE( BitwiseAnd                  );
-            STR_CASE( BitwiseOr                   );
-            STR_CASE( BitwiseXor                  );
-            STR_CASE( BitwiseNot                  );
-            STR_CASE( Equality                    );
-            STR_CASE( Inequality                  );
-            STR_CASE( GreaterThan                 );
-            STR_CASE( GreaterThanEqual            );
-            STR_CASE( LessThan                    );
-            STR_CASE( LessThanEqual               );
-            STR_CASE( IsIdentical                 );
-            STR_CASE( IsNotIdentical              );
-            STR_CASE( IsMemberOf                  );
-            STR_CASE( IsNotMemberOf               );
-            STR_CASE( LogicalNot                  );
-            STR_CASE( LogicalAnd                  );
-            STR_CASE( LogicalOr                   );
-            STR_CASE( Assign                      );
-            STR_CASE( AssignExponent              );
-            STR_CASE( AssignAddition              );
-            STR_CASE( AssignSubtraction           );
-            STR_CASE( AssignMultiplication        );
-            STR_CASE( AssignDivision              );
-            STR_CASE( AssignFloorDivision         );
-            STR_CASE( AssignModulus               );
-            STR_CASE( AssignBitwiseLeftShift      );
-            STR_CASE( AssignBitwiseRightShift     );
-            STR_CASE( AssignBitwiseAnd            );
-            STR_CASE( AssignBitwiseOr             );
-            STR_CASE( AssignBitwiseXor            );
-            STR_CASE( StatementIf                 );
-            STR_CASE( StatementElif               );
-            STR_CASE( StatementElse               );
-            STR_CASE( StatementWhile              );
-            STR_CASE( StatementPass               );
-            STR_CASE( StatementReturn             );
-            STR_CASE( StatementImport             );
-            STR_CASE( StatementAssert             );
-            STR_CASE( ArrayDefinition             );
-            STR_CASE( ClassDefinition             );
-            STR_CASE( ContractDefinition          );
-            STR_CASE( FunctionDefinition          );
-            STR_CASE( FunctionParameterDefinition );
-            STR_CASE( MapDefinition               );
-            STR_CASE( ModuleDefinition            );
-            STR_CASE( VariableDefinition          );
-#undef STR_CASE
-
-            case NodeType::Count:
-                break;
+            if ( child != nullptr ) { ++count; }
         }
-
-        ASSERT( false );
-        return "";
+        return count;
     }
-} // namespace
 
-void print( Node::Pointer const & node, std::FILE * stream, std::size_t const indentationLevel )
-{
-    static auto printIndentation
+    void printText( Node const & root, Writer & writer )
     {
-        []( std::FILE * stream, std::size_t const level )
+        std::vector< std::pair< Node const *, std::size_t > > stack{ { &root, 0U } };
+
+        while ( !stack.empty() )
         {
-            fmt::print( stream, "{:{}}", "", level );
+            auto const [ node, indentationLevel ]{ stack.back() };
+            stack.pop_back();
+
+            writer.format( "{:{}}", "", indentationLevel );
+            std::visit
+            (
+                Overload
+                {
+                    [ & ]( NodeType const type )
+                    {
+                        writer.format( "{}\n", toString( type ) );
+
+                        auto const & children{ node->children() };
+                        for ( auto it{ std::rbegin( children ) }; it != std::rend( children ); ++it )
+                        {
+                            if ( *it != nullptr ) { stack.emplace_back( it->get(), indentationLevel + 2U ); }
+                        }
+                    },
+                    [ & ]( Identifier    const & identifier ) { writer.format( "Identifier = '{}'\n"   , identifier.name                 ); },
+                    [ & ]( Boolean       const   boolean    ) { writer.format( "Boolean = '{}'\n"      , boolean ? "true" : "false"      ); },
+                    [ & ]( Number        const   number     ) { writer.format( "Number = '{}'\n"       , number.toDecimalString()        ); },
+                    [ & ]( StringLiteral const & str        ) { writer.format( "StringLiteral = '{}'\n", str.value                       ); },
+                    [ & ]( TypeID        const   typeID     ) { writer.format( "TypeID = {}\n"         , Registry::toStringView( typeID ) ); }
+                },
+                node->value()
+            );
+            writer.checkpoint();
         }
-    };
+    }
 
-    if ( node == nullptr ) { return; }
+    void printJSON( Node const & root, Writer & writer )
+    {
+        struct Frame
+        {
+            Node const * node;
+            std::size_t  nextChild{ 0U };
+            bool         first    { true };
+        };
+
+        std::vector< Frame > stack;
 
-    std::visit
-    (
-        Overload
+        auto open
         {
-            [ =, &node ]( NodeType const type )
+            [ & ]( Node const & node )
             {
-                printIndentation( stream, indentationLevel );
-                fmt::print( stream, "{}\n", toString( type ) );
-                for ( auto const & n : node->children() )
+                auto const errorInfo{ node.errorInfo() };
+                writer.write( "{\"kind\":" );
+                std::visit
+                (
+                    Overload
+                    {
+                        [ & ]( NodeType      const   type ) { writeJSONString( writer, toString( type ) ); },
+                        [ & ]( Identifier    const &      ) { writer.write( "\"Identifier\""    ); },
+                        [ & ]( Boolean       const        ) { writer.write( "\"Boolean\""       ); },
+                        [ & ]( Number        const        ) { writer.write( "\"Number\""        ); },
+                        [ & ]( StringLiteral const &      ) { writer.write( "\"StringLiteral\"" ); },
+                        [ & ]( TypeID        const        ) { writer.write( "\"TypeID\""        ); }
+                    },
+                    node.value()
+                );
+                writer.format( ",\"line\":{},\"column\":{}", errorInfo.lineNumber, errorInfo.columnNumber );
+
+                if ( node.typeID() != nullptr )
                 {
-                    print( n, stream, indentationLevel + 2U );
+                    writer.write( ",\"type\":" );
+                    writeJSONString( writer, Registry::toStringView( node.typeID() ) );
                 }
-            },
-            [ = ]( Identifier const & identifier )
-            {
-                printIndentation( stream, indentationLevel );
-                fmt::print( stream, "Identifier = '{}'\n", identifier.name );
-            },
-            [ = ]( Boolean const boolean )
-            {
-                printIndentation( stream, indentationLevel );
-                fmt::print( stream, "Boolean = '{}'\n", boolean ? "true" : "false" );
-            },
-            [ = ]( Number const number )
-            {
-                printIndentation( stream, indentationLevel );
-                fmt::print( stream, "Number = '{}'\n", number.value );
-            },
-            [ = ]( StringLiteral const & str )
+
+                std::visit
+                (
+                    Overload
+                    {
+                        [ & ]( NodeType const )
+                        {
+                            writer.write( ",\"children\":[" );
+                            stack.push_back( { .node = &node } );
+                        },
+                        [ & ]( Identifier const & identifier )
+                        {
+                            writer.write( ",\"value\":" );
+                            writeJSONString( writer, identifier.name );
+                            writer.write( '}' );
+                        },
+                        [ & ]( Boolean const boolean ) { writer.format( ",\"value\":{}}}", boolean      ); },
+                        [ & ]( Number  const number  ) { writer.format( ",\"value\":{}}}", number.toDecimalString() ); },
+                        [ & ]( StringLiteral const & str )
+                        {
+                            writer.write( ",\"value\":" );
+                            writeJSONString( writer, str.value );
+                            writer.write( '}' );
+                        },
+                        [ & ]( TypeID const typeID )
+                        {
+                            writer.write( ",\"value\":" );
+                            writeJSONString( writer, Registry::toStringView( typeID ) );
+                            writer.write( '}' );
+                        }
+                    },
+                    node.value()
+                );
+                writer.checkpoint();
+            }
+        };
+
+        open( root );
+        while ( !stack.empty() )
+        {
+            auto & frame{ stack.back() };
+            auto const & children{ frame.node->children() };
+
+            while ( frame.nextChild < children.size() && children[ frame.nextChild ] == nullptr )
             {
-                printIndentation( stream, indentationLevel );
-                fmt::print( stream, "StringLiteral = '{}'\n", str.value );
-            },
-            [ = ]( TypeID const typeID )
+                ++frame.nextChild;
+            }
+
+            if ( frame.nextChild == children.size() )
             {
-                printIndentation( stream, indentationLevel );
-                fmt::print( stream, "TypeID = {}\n", toString( typeID ) );
+                writer.write( "]}" );
+                stack.pop_back();
+                continue;
             }
-        },
-        node->value()
-    );
+
+            if ( !frame.first ) { writer.write( ',' ); }
+            frame.first = false;
+
+            // Opening the child may reallocate the stack, thus frame must not be used afterwards
+            open( *children[ frame.nextChild++ ] );
+        }
+        writer.write( '\n' );
+    }
+
+    void printBinary( Node const & root, Writer & writer )
+    {
+        static constexpr std::uint8_t version{ 1U };
+
+        writer.write( "A1AST" );
+        writer.writeLittleEndian( version );
+
+        std::vector< Node const * > stack{ &root };
+        while ( !stack.empty() )
+        {
+            auto const * node{ stack.back() };
+            stack.pop_back();
+
+            std::visit
+            (
+                Overload
+                {
+                    [ & ]( NodeType const type )
+                    {
+                        writer.writeLittleEndian( std::uint8_t{ 0U } );
+                        writer.writeLittleEndian( static_cast< std::uint8_t >( type ) );
+                        writer.writeLittleEndian( countChildren( *node ) );
+
+                        auto const & children{ node->children() };
+                        for ( auto it{ std::rbegin( children ) }; it != std::rend( children ); ++it )
+                        {
+                            if ( *it != nullptr ) { stack.push_back( it->get() ); }
+                        }
+                    },
+                    [ & ]( Identifier const & identifier )
+                    {
+                        writer.writeLittleEndian( std::uint8_t{ 1U } );
+                        writeBinaryString( writer, identifier.name );
+                    },
+                    [ & ]( TypeID const typeID )
+                    {
+                        writer.writeLittleEndian( std::uint8_t{ 2U } );
+                        writeBinaryString( writer, Registry::toStringView( typeID ) );
+                    },
+                    [ & ]( Boolean const boolean )
+                    {
+                        writer.writeLittleEndian( std::uint8_t{ 3U } );
+                        writer.writeLittleEndian( static_cast< std::uint8_t >( boolean ) );
+                    },
+                    [ & ]( Number const number )
+                    {
+                        // Decimals follow the value of the decimal literals only, integer literals keep their encoding
+                        writer.writeLittleEndian( static_cast< std::uint8_t >( number.decimals == 0U ? 4U : 6U ) );
+                        writer.writeLittleEndian( number.value );
+                        if ( number.decimals != 0U ) { writer.writeLittleEndian( number.decimals ); }
+                    },
+                    [ & ]( StringLiteral const & str )
+                    {
+                        writer.writeLittleEndian( std::uint8_t{ 5U } );
+                        writeBinaryString( writer, str.value );
+                    }
+                },
+                node->value()
+            );
+            writer.checkpoint();
+        }
+    }
+
+    void print( Node const & root, Writer & writer, PrintFormat const format )
+    {
+        switch ( format )
+        {
+            case PrintFormat::Text  : printText  ( root, writer ); break;
+            case PrintFormat::JSON  : printJSON  ( root, writer ); break;
+            case PrintFormat::Binary: printBinary( root, writer ); break;
+        }
+    }
+} // namespace
+
+std::optional< PrintFormat > toPrintFormat( std::string_view const name ) noexcept
+{
+    if ( name == "text"   ) { return PrintFormat::Text;   }
+    if ( name == "json"   ) { return PrintFormat::JSON;   }
+    if ( name == "binary" ) { return PrintFormat::Binary; }
+    return std::nullopt;
+}
+
+void print( Node::Pointer const & node, std::FILE * stream, PrintFormat const format )
+{
+    if ( node == nullptr ) { return; }
+
+    Writer writer{ stream };
+    print( *node, writer, format );
+}
+
+void print( Node::Pointer const & node, std::string & output, PrintFormat const format )
+{
+    if ( node == nullptr ) { return; }
+
+    Writer writer{ output };
+    print( *node, writer, format );
 }
 
-} // namespace A1::AST
\ No newline at end of file
+} // namespace A1::AST
@@ -0,0 +1,305 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/Compiler/Cache.hpp>
+
+#include "Utils/SHA256.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string_view>
+#include <thread>
+
+namespace A1::Compiler
+{
+
+namespace
+{
+    using Path = std::filesystem::path;
+
+    /**
+     * First line of each entry, entries of other formats are never hit.
+     */
+    constexpr std::string_view entryFormat{ "a1-cache 2" };
+
+    /**
+     * Suffix of the files being written, see writeAtomically.
+     */
+    constexpr std::string_view temporarySuffix{ ".tmp-" };
+
+    /**
+     * Temporary files are left behind only by the writers which have crashed,
+     * thus the ones older than that are removed by the eviction.
+     */
+    constexpr std::chrono::hours staleTemporaryFileAge{ 1 };
+
+    [[ nodiscard ]] std::optional< std::string > readFile( Path const & path )
+    {
+        std::ifstream stream{ path, std::ios::binary };
+        if ( !stream ) { return std::nullopt; }
+
+        std::string contents{ std::istreambuf_iterator< char >{ stream }, std::istreambuf_iterator< char >{} };
+        if ( stream.bad() ) { return std::nullopt; }
+        return contents;
+    }
+
+    /**
+     * Writes the file as a whole or not at all. Contents are written into the temporary file next to the
+     * target, which is unique per process and thread, and renamed over the target, which is atomic.
+     */
+    [[ nodiscard ]] bool writeAtomically( Path const & path, std::string_view const contents )
+    {
+        static auto const               processTag{ std::random_device{}() };
+        static std::atomic< std::size_t > counter   { 0U };
+
+        auto temporaryPath{ path };
+        temporaryPath += fmt::format
+        (
+            "{}{:x}-{:x}-{}",
+            temporarySuffix,
+            processTag,
+            std::hash< std::thread::id >{}( std::this_thread::get_id() ),
+            counter++
+        );
+
+        {
+            std::ofstream stream{ temporaryPath, std::ios::binary | std::ios::trunc };
+            stream.write( contents.data(), static_cast< std::streamsize >( std::size( contents ) ) );
+            stream.close();
+
+            if ( !stream )
+            {
+                std::error_code errorCode;
+                std::filesystem::remove( temporaryPath, errorCode );
+                return false;
+            }
+        }
+
+        std::error_code errorCode;
+        std::filesystem::rename( temporaryPath, path, errorCode );
+        if ( errorCode )
+        {
+            std::filesystem::remove( temporaryPath, errorCode );
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Imported files are recorded relative to the directory of the source file, as imports are resolved
+     * relative to it, thus the entry is valid for the copy of the source tree in another directory too.
+     */
+    [[ nodiscard ]] Path baseDirectory( Path const & inputFile )
+    {
+        std::error_code errorCode;
+        auto canonical{ std::filesystem::weakly_canonical( inputFile, errorCode ) };
+        return ( errorCode ? inputFile.lexically_normal() : canonical ).parent_path();
+    }
+
+    [[ nodiscard ]] bool readCount( std::istream & stream, std::size_t & count )
+    {
+        std::string line;
+        return
+            std::getline( stream, line ) &&
+            std::from_chars( line.data(), line.data() + std::size( line ), count ).ec == std::errc{};
+    }
+} // namespace
+
+Cache::Cache( std::filesystem::path directory, std::string version, std::uintmax_t const maxBytes )
+: directory_{ std::move( directory ) }
+, version_  { std::move( version   ) }
+, maxBytes_ { maxBytes }
+{}
+
+std::optional< std::string > Cache::key( Settings const & settings, std::filesystem::path const & inputFile ) const
+{
+    auto const source{ readFile( inputFile ) };
+    if ( !source ) { return std::nullopt; }
+
+#ifdef TESTS_ENABLED
+    static constexpr std::string_view target{ "native" };
+#else
+    static constexpr std::string_view target{ "wasm32-unknown-wasi" };
+#endif // TESTS_ENABLED
+
+    // Settings which only write to the standard output, e.g. statistics, do not affect the executable
+    return SHA256{}
+        .update( entryFormat )
+        .update( fmt::format( "\n{}\n{}\nO{}\n", version_, target, static_cast< unsigned >( settings.optimizationLevel ) ) )
+        .update( *source )
+        .hex();
+}
+
+bool Cache::restore
+(
+    std::string           const & key,
+    std::filesystem::path const & inputFile,
+    std::filesystem::path const & executableFile
+) const
+{
+    auto const entryPath{ directory_ / key };
+
+    std::ifstream stream{ entryPath, std::ios::binary };
+    if ( !stream ) { return false; }
+
+    std::string line;
+    if ( !std::getline( stream, line ) || line != entryFormat ) { return false; }
+
+    std::size_t importedFilesCount{ 0U };
+    if ( !readCount( stream, importedFilesCount ) ) { return false; }
+
+    // Each imported file is recorded as its hash followed by its path, e.g. '<hash> lib/math.ao'
+    auto const directory{ baseDirectory( inputFile ) };
+    for ( std::size_t i{ 0U }; i < importedFilesCount; ++i )
+    {
+        if ( !std::getline( stream, line ) ) { return false; }
+
+        auto const separator{ line.find( ' ' ) };
+        if ( separator == std::string::npos ) { return false; }
+
+        auto const contents{ readFile( directory / line.substr( separator + 1U ) ) };
+        if ( !contents || SHA256{}.update( *contents ).hex() != std::string_view{ line }.substr( 0U, separator ) )
+        {
+            return false;
+        }
+    }
+
+    // Each unresolved import is recorded as the path it has been looked up at, the file created there since shadows the entry
+    std::size_t unresolvedImportsCount{ 0U };
+    if ( !readCount( stream, unresolvedImportsCount ) ) { return false; }
+
+    for ( std::size_t i{ 0U }; i < unresolvedImportsCount; ++i )
+    {
+        std::error_code errorCode;
+        if ( !std::getline( stream, line ) || std::filesystem::is_regular_file( directory / line, errorCode ) )
+        {
+            return false;
+        }
+    }
+
+    std::string const executable{ std::istreambuf_iterator< char >{ stream }, std::istreambuf_iterator< char >{} };
+    if ( stream.bad() || !writeAtomically( executableFile, executable ) ) { return false; }
+
+    std::error_code errorCode;
+    std::filesystem::permissions
+    (
+        executableFile,
+        std::filesystem::perms::owner_all | std::filesystem::perms::group_read | std::filesystem::perms::group_exec |
+        std::filesystem::perms::others_read | std::filesystem::perms::others_exec,
+        errorCode
+    );
+
+    // Entry is touched, so that it is evicted as the least recently used one rather than the least recently stored
+    std::filesystem::last_write_time( entryPath, std::filesystem::file_time_type::clock::now(), errorCode );
+    return true;
+}
+
+void Cache::store
+(
+    std::string                          const & key,
+    std::filesystem::path                const & inputFile,
+    std::vector< std::filesystem::path > const & importedFiles,
+    std::vector< std::filesystem::path > const & unresolvedImports,
+    std::filesystem::path                const & executableFile
+) const
+{
+    auto const executable{ readFile( executableFile ) };
+    if ( !executable ) { return; }
+
+    auto entry{ fmt::format( "{}\n{}\n", entryFormat, std::size( importedFiles ) ) };
+
+    auto const directory{ baseDirectory( inputFile ) };
+    for ( auto const & importedFile : importedFiles )
+    {
+        auto const contents{ readFile( importedFile ) };
+        if ( !contents ) { return; }
+
+        entry += fmt::format( "{} {}\n", SHA256{}.update( *contents ).hex(), importedFile.lexically_relative( directory ).generic_string() );
+    }
+
+    entry += fmt::format( "{}\n", std::size( unresolvedImports ) );
+    for ( auto const & unresolvedImport : unresolvedImports )
+    {
+        entry += fmt::format( "{}\n", unresolvedImport.lexically_relative( directory ).generic_string() );
+    }
+    entry += *executable;
+
+    std::error_code errorCode;
+    std::filesystem::create_directories( directory_, errorCode );
+    if ( errorCode || !writeAtomically( directory_ / key, entry ) ) { return; }
+
+    evict();
+}
+
+void Cache::evict() const
+{
+    struct Entry
+    {
+        Path                              path;
+        std::uintmax_t                    size{ 0U };
+        std::filesystem::file_time_type   lastWriteTime;
+    };
+
+    /**
+     * Other processes may add and remove entries at the same time, thus entries which are gone
+     * in the meantime are skipped. Temporary files are not entries yet, they are being written
+     * by other writers, which rename them once complete, thus only the stale ones are removed.
+     */
+    std::vector< Entry > entries;
+    std::uintmax_t       totalSize{ 0U };
+
+    auto const now{ std::filesystem::file_time_type::clock::now() };
+
+    std::error_code errorCode;
+    for ( std::filesystem::directory_iterator it{ directory_, errorCode }, end; !errorCode && it != end; it.increment( errorCode ) )
+    {
+        std::error_code entryErrorCode;
+        if ( !it->is_regular_file( entryErrorCode ) ) { continue; }
+
+        Entry entry{ .path = it->path(), .size = it->file_size( entryErrorCode ), .lastWriteTime = it->last_write_time( entryErrorCode ) };
+        if ( entryErrorCode ) { continue; }
+
+        if ( entry.path.filename().string().find( temporarySuffix ) != std::string::npos )
+        {
+            if ( now - entry.lastWriteTime > staleTemporaryFileAge )
+            {
+                std::filesystem::remove( entry.path, entryErrorCode );
+            }
+            continue;
+        }
+
+        totalSize += entry.size;
+        entries.push_back( std::move( entry ) );
+    }
+
+    if ( totalSize <= maxBytes_ ) { return; }
+
+    std::sort
+    (
+        std::begin( entries ),
+        std::end  ( entries ),
+        []( Entry const & lhs, Entry const & rhs ) { return lhs.lastWriteTime < rhs.lastWriteTime; }
+    );
+
+    for ( auto const & entry : entries )
+    {
+        if ( totalSize <= maxBytes_ ) { break; }
+
+        std::filesystem::remove( entry.path, errorCode );
+        totalSize -= entry.size;
+    }
+}
+
+} // namespace A1::Compiler
@@ -5,12 +5,20 @@
  * This code is open-sourced under the MIT license.
  */
 
+#include <CoreLib/AST/AST.hpp>
+#include <CoreLib/AST/ASTOptimizer.hpp>
 #include <CoreLib/Compiler/Compiler.hpp>
+#include <CoreLib/Errors/ParsingError.hpp>
+#include <CoreLib/Errors/SemanticError.hpp>
+#include <CoreLib/Tokenizer/Tokenizer.hpp>
+#include <CoreLib/Utils/Stream.hpp>
 
 #ifdef LLVM_ENABLED
 #   include <CoreLib/Compiler/LLVM/Compiler.hpp>
 #endif // LLVM_ENABLED
 
+#include <exception>
+
 namespace A1
 {
 
@@ -23,4 +31,45 @@ bool compile( [[ maybe_unused ]] Compiler::Settings settings, [[ maybe_unused ]]
 #endif // LLVM_ENABLED
 }
 
+Compiler::Output compile( std::string_view const source, [[ maybe_unused ]] Compiler::Options const & options )
+{
+    Compiler::Output output;
+    try
+    {
+        auto token   { tokenize( Stream{ source } ) };
+        auto rootNode{ AST::optimize( AST::parse( token ) ) };
+
+#ifdef LLVM_ENABLED
+        Compiler::Settings settings;
+        settings.optimizationLevel = options.optimizationLevel;
+        settings.threadsCount      = options.threadsCount;
+        if ( !LLVM::compile( settings, rootNode, output ) )
+        {
+            output.diagnostics.push_back( { .errorInfo = std::nullopt, .message = "Target is not supported by LLVM" } );
+        }
+#else
+        output.diagnostics.push_back( { .errorInfo = std::nullopt, .message = "Compiler is built without LLVM" } );
+#endif // LLVM_ENABLED
+    }
+    catch ( ParsingError const & ex )
+    {
+        output.diagnostics.push_back( { .errorInfo = ex.errorInfo(), .message = std::string{ ex.message() } } );
+    }
+    catch ( SemanticError const & ex )
+    {
+        output.diagnostics.push_back( { .errorInfo = ex.errorInfo(), .message = std::string{ ex.message() } } );
+    }
+    catch ( std::exception const & ex )
+    {
+        output.diagnostics.push_back( { .errorInfo = std::nullopt, .message = ex.what() } );
+    }
+
+    if ( !output.succeeded() )
+    {
+        output.objectCode     .clear();
+        output.importedModules.clear();
+    }
+    return output;
+}
+
 } // namespace A1
\ No newline at end of file
@@ -6,9 +6,16 @@
  */
 
 #include "IRCodegen/Codegen.hpp"
+#include "Linker.hpp"
+#include "Target.hpp"
+#include "Utils/ThreadPool.hpp"
 #include "Utils/Utils.hpp"
 
 #include <CoreLib/Compiler/LLVM/Compiler.hpp>
+#include <CoreLib/Compiler/Statistics.hpp>
+#include <CoreLib/Semantic/Analyzer.hpp>
+#include <CoreLib/Semantic/BoundsAnalysis.hpp>
+#include <CoreLib/Semantic/WidthInference.hpp>
 
 #if defined (__clang__)
 #   pragma clang diagnostic push
@@ -21,18 +28,11 @@
 
 #include <llvm/ADT/APInt.h>
 #include <llvm/ADT/IntrusiveRefCntPtr.h>
+#include <llvm/ADT/SmallVector.h>
 #include <llvm/IR/LegacyPassManager.h>
-#include <llvm/MC/TargetRegistry.h>
-#include <llvm/Passes/OptimizationLevel.h>
-#include <llvm/Passes/PassBuilder.h>
-#include <llvm/Support/FileSystem.h>
-#include <llvm/Support/Host.h>
-#include <llvm/Support/Program.h>
 #include <llvm/Support/raw_ostream.h>
-#include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/VirtualFileSystem.h>
 #include <llvm/Target/TargetMachine.h>
-#include <llvm/Target/TargetOptions.h>
 
 #if defined(__clang__)
 #   pragma clang diagnostic pop
@@ -40,194 +40,332 @@
 #   pragma GCC diagnostic pop
 #endif
 
-#include <unordered_map>
+#include <algorithm>
+#include <future>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
 namespace A1::LLVM
 {
 
 namespace
 {
-    std::unordered_map< std::string_view, char const * > externalModulePaths
-    {
-        {
-#ifndef TESTS_ENABLED
-            { "core", WASM_UTILS_LIBRARY_PATH }
-#endif // TESTS_ENABLED
-        }
-    };
-} // namespace
+    using Clock = Compiler::Statistics::Clock;
 
-bool compile( Compiler::Settings settings, AST::Node::Pointer const & node )
-{
     /**
-     * Initialize the target registry, ASM parser, ASM printers, etc.
+     * Object code of a single unit of the module, along with the statistics of its phases,
+     * which are merged into the statistics of the module once all the units are compiled.
      */
-    llvm::InitializeAllTargetInfos();
-    llvm::InitializeAllTargets    ();
-    llvm::InitializeAllTargetMCs  ();
-    llvm::InitializeAllAsmParsers ();
-    llvm::InitializeAllAsmPrinters();
+    struct Unit
+    {
+        llvm::SmallVector< char, 0U > objectCode;
+        std::vector< std::string >    importedModules;
 
-    /**
-     * In order to specify the architecture we want to target, we need the
-     * target triple which has the form: '<arch><sub>-<vendor>-<sys>-<abi>'.
-     * An example of such target triple is: 'x86_64-unknown-linux-gnu'.
-     */
-#ifdef TESTS_ENABLED
-    auto const targetTriple{ llvm::sys::getDefaultTargetTriple() };
-#else
-    auto const targetTriple{ "wasm32-unknown-wasi" };
-#endif // TESTS_ENABLED
+        /** LLVM IR of the unit, written out only if requested. */
+        std::string ir;
 
-    std::string error;
-    auto const * target{ llvm::TargetRegistry::lookupTarget( targetTriple, error ) };
+        std::size_t functions            { 0U };
+        std::size_t instructions         { 0U };
+        std::size_t optimizedInstructions{ 0U };
 
-    if ( target == nullptr )
-    {
-        /**
-         * The requested target could not be found.
-         * This occurs if the TargetRegistry is not initialized or the
-         * target triple is invalid.
-         */
-        return false;
-    }
+        Clock::duration targetSetup {};
+        Clock::duration codegen     {};
+        Clock::duration optimization{};
+        Clock::duration emission    {};
+    };
 
     /**
-     * Generic CPU is used without any additional features.
+     * Lowers, optimizes and compiles the unit of the module into the object code of the target,
+     * within its own LLVM context, thus units may be compiled by multiple threads at once.
      */
-    auto const cpu{ "generic" };
-    auto const features{ "" };
+    [[ nodiscard ]] std::optional< Unit > emitUnit
+    (
+        Compiler::Settings                      const & settings,
+        AST::Node::Pointer                      const & node,
+        AST::Node                               const * unit,
+        std::unordered_set< AST::Node const * > const & inBoundsSubscripts
+    )
+    {
+        Unit result;
 
-    llvm::TargetOptions options;
-    llvm::Optional< llvm::Reloc::Model > relocationModel;
+        /**
+         * Target is set up by the first compilation of the thread only.
+         */
+        auto start{ Clock::now() };
+        auto * target{ Target::get() };
+        if ( target == nullptr ) { return std::nullopt; }
 
-    auto targetMachine{ target->createTargetMachine( targetTriple, cpu, features, options, relocationModel ) };
+        result.targetSetup = Clock::now() - start;
 
-    /**
-     * Generate LLVM IR code from the AST.
-     */
-    auto context{ IR::codegen( node, targetMachine->createDataLayout(), targetTriple ) };
-
-    /**
-     * Optimize LLVM IR.
-     *
-     * @note: Optimizations are turned on only for the sake of testing.
-     * In production, we do not want optimizations to remove all unused functions,
-     * smart contracts, etc. as these are used later by the Adamnite VM.
-     */
-#ifdef TESTS_ENABLED
-        llvm::ModuleAnalysisManager   moduleAnalysisManager;
-        llvm::CGSCCAnalysisManager    cGSCCAnalysisManager;
-        llvm::FunctionAnalysisManager functionAnalysisManager;
-        llvm::LoopAnalysisManager     loopAnalysisManager;
+        /**
+         * Generate LLVM IR code from the AST.
+         */
+        start = Clock::now();
+        auto context
+        {
+            IR::codegen
+            (
+                node,
+                unit,
+                target->machine().createDataLayout(),
+                target->triple(),
+                inBoundsSubscripts,
+                !settings.outputIR /* discardValueNames */
+            )
+        };
 
-        llvm::PassBuilder passBuilder{ targetMachine };
-        passBuilder.registerModuleAnalyses  ( moduleAnalysisManager   );
-        passBuilder.registerCGSCCAnalyses   ( cGSCCAnalysisManager    );
-        passBuilder.registerFunctionAnalyses( functionAnalysisManager );
-        passBuilder.registerLoopAnalyses    ( loopAnalysisManager     );
+        for ( auto const & function : context.module_->functions() )
+        {
+            if ( function.isDeclaration() ) { continue; }
 
-        passBuilder.crossRegisterProxies( loopAnalysisManager, functionAnalysisManager, cGSCCAnalysisManager, moduleAnalysisManager );
+            ++result.functions;
+            result.instructions += function.getInstructionCount();
+        }
+        result.codegen = Clock::now() - start;
 
         /**
-         * @note: Crash happens in llvm::AnalysisManager, LLVM 14.0.6.
-         * Uncomment once we update LLVM to newer version.
+         * Optimize LLVM IR.
          */
-        // auto modulePassManager{ passBuilder.buildPerModuleDefaultPipeline( llvm::OptimizationLevel::O3 ) };
-        // modulePassManager.run( *context.module_, moduleAnalysisManager );
-#endif // TESTS_ENABLED
+        start = Clock::now();
+        target->optimize( *context.module_, settings.optimizationLevel, context.exportedFunctions );
+
+        for ( auto const & function : context.module_->functions() )
+        {
+            result.optimizedInstructions += function.getInstructionCount();
+        }
+        result.optimization = Clock::now() - start;
+
+        if ( settings.outputIR )
+        {
+            llvm::raw_string_ostream stream{ result.ir };
+            context.module_->print( stream, nullptr );
+        }
 
-    if ( settings.outputIR )
-    {
         /**
-         * Write generated LLVM IR code to standard output.
+         * Compile to object code, which is kept in memory until it is linked.
          */
-        std::printf( "\nLLVM IR:\n" );
-        context.module_->print( llvm::outs(), nullptr );
-        std::printf( "\n" );
+        start = Clock::now();
+        {
+            llvm::raw_svector_ostream dst{ result.objectCode };
+
+            llvm::legacy::PassManager passManager;
+            target->machine().addPassesToEmitFile( passManager, dst, nullptr, llvm::CGFT_ObjectFile );
+            passManager.run( *context.module_ );
+        }
+        result.emission = Clock::now() - start;
+
+        result.importedModules = std::move( context.importedModules );
+        return result;
     }
 
     /**
-     * Compile to object code.
+     * Compiles the module into the object code of the target, which is kept in memory. Top level contracts
+     * and functions are compiled independently of each other, on the thread pool if multiple threads are
+     * requested. Units are returned in the order of the source, whatever the number of threads is.
      */
-    static constexpr auto objectCodeFilename{ "out.o" };
+    [[ nodiscard ]] bool emitObjectCode
+    (
+        Compiler::Settings   const & settings,
+        AST::Node::Pointer   const & node,
+        std::vector< Unit >        & units
+    )
     {
-        std::error_code errorCode;
-        llvm::raw_fd_ostream dst{ objectCodeFilename, errorCode, llvm::sys::fs::OF_None };
+        /**
+         * Resolve types of all the expressions, type errors are reported
+         * before any time is spent on LLVM initialization.
+         */
+        auto * statistics{ settings.statistics };
+        auto   start     { Clock::now() };
 
-        if ( errorCode )
+        // Results of the analysis are handed to the code generation as the types annotating the nodes
+        static_cast< void >( Semantic::analyze( *node ) );
+        Semantic::inferIntegerWidths( *node );
+
+        auto const inBoundsSubscripts{ Semantic::findInBoundsSubscripts( *node ) };
+
+        if ( statistics != nullptr )
         {
-            llvm::errs() << "Could not open a file: " << errorCode.message();
-            return false;
+            auto const analysis{ Clock::now() - start };
+            statistics->record( "semantic analysis", analysis, statistics->countNodes( *node ), "nodes" );
         }
 
-        llvm::legacy::PassManager passManager;
-        targetMachine->addPassesToEmitFile( passManager, dst, nullptr, llvm::CGFT_ObjectFile );
-        passManager.run( *context.module_ );
-        dst.flush();
-    }
+        auto const definitions{ IR::units( *node ) };
 
-#ifdef TESTS_ENABLED
-#   if __APPLE__
-    static constexpr auto linker{ "ld" };
-#   elif __linux__
-    /**
-     * Use gcc instead of ld on Linux as there seem to exist some issues when executing ld standalone.
-     */
-    static constexpr auto linker{ "gcc" };
-#   endif
-#else
-    static constexpr auto linker{ "wasm-ld" };
-#endif // TESTS_ENABLED
+        std::vector< std::optional< Unit > > results;
+        results.reserve( std::size( definitions ) );
 
-    if ( llvm::ErrorOr< std::string > path{ llvm::sys::findProgramByName( linker ) } )
-    {
-        ASSERT( llvm::sys::fs::can_execute( *path ) );
+        if ( settings.threadsCount <= 1U || std::size( definitions ) == 1U )
+        {
+            for ( auto const * definition : definitions )
+            {
+                results.push_back( emitUnit( settings, node, definition, inBoundsSubscripts ) );
+            }
+        }
+        else
+        {
+            ThreadPool threadPool{ std::min( settings.threadsCount, std::size( definitions ) ) };
+
+            std::vector< std::future< std::optional< Unit > > > futures;
+            futures.reserve( std::size( definitions ) );
+            for ( auto const * definition : definitions )
+            {
+                futures.push_back
+                (
+                    threadPool.submit
+                    (
+                        [ &settings, &node, &inBoundsSubscripts, definition ]
+                        {
+                            return emitUnit( settings, node, definition, inBoundsSubscripts );
+                        }
+                    )
+                );
+            }
+
+            for ( auto & future : futures )
+            {
+                results.push_back( future.get() );
+            }
+        }
 
-        std::vector< llvm::StringRef > arguments
+        if ( std::any_of( std::begin( results ), std::end( results ), []( auto const & result ){ return !result.has_value(); } ) )
+        {
+            return false;
+        }
+
+        for ( auto & result : results )
+        {
+            units.push_back( std::move( *result ) );
+        }
+
+        if ( statistics != nullptr )
         {
-            *path,
-#ifdef TESTS_ENABLED
-#   if __APPLE__
-            "-L/usr/lib", "-lSystem", "-syslibroot", SYSROOT_PATH,
-#   endif
-#else
             /**
-             * Set following flags in case you want to run the WASM executable:
-             *     --entry main --allow-undefined -lc \
-             *     -L WASM_WASI_LIB_PATH              \
-             *     -L WASM_RUNTIME_LIBRARY_PATH       \
-             *     WASM_WASI_RUNTIME_PATH
+             * Durations of the phases are summed over the units, thus they stand for
+             * the time spent by all the threads rather than the elapsed time.
              */
-            "--no-entry", "--allow-undefined", "-lc",
-            "-L", WASM_WASI_LIB_PATH,
-            "-L", WASM_RUNTIME_LIBRARY_PATH,
-#endif // TESTS_ENABLED
-            "-o", settings.executableFilename, objectCodeFilename
-        };
+            Unit total;
+            for ( auto const & unit : units )
+            {
+                total.functions             += unit.functions;
+                total.instructions          += unit.instructions;
+                total.optimizedInstructions += unit.optimizedInstructions;
+                total.targetSetup           += unit.targetSetup;
+                total.codegen               += unit.codegen;
+                total.optimization          += unit.optimization;
+                total.emission              += unit.emission;
+            }
+
+            statistics->llvmFunctions    = total.functions;
+            statistics->llvmInstructions = total.instructions;
 
-#ifndef TESTS_ENABLED
-        for ( auto const & module : context.importedModules )
+            statistics->record( "target setup"   , total.targetSetup );
+            statistics->record( "code generation", total.codegen, total.instructions, "instructions" );
+            if ( settings.optimizationLevel != Compiler::OptimizationLevel::O0 )
+            {
+                statistics->record( "IR optimization", total.optimization, total.optimizedInstructions, "instructions" );
+            }
+            statistics->record( "object emission", total.emission, total.instructions, "instructions" );
+        }
+
+        if ( settings.outputIR )
         {
-            arguments.push_back( externalModulePaths[ module ] );
+            /**
+             * Write generated LLVM IR code of all the units to standard output.
+             */
+            std::printf( "\nLLVM IR:\n" );
+            for ( auto const & unit : units )
+            {
+                llvm::outs() << unit.ir;
+            }
+            llvm::outs().flush();
+            std::printf( "\n" );
         }
-#endif // TESTS_ENABLED
 
-        auto const result{ llvm::sys::ExecuteAndWait( *path, arguments ) };
-        if ( result < 0 )
+        return true;
+    }
+
+    /**
+     * Imported modules of the units, without duplicates, in the order they are imported in.
+     */
+    [[ nodiscard ]] std::vector< std::string > importedModules( std::vector< Unit > const & units )
+    {
+        std::vector< std::string > result;
+        for ( auto const & unit : units )
         {
-            std::printf( "%s linker failed!", linker );
-            return false;
+            for ( auto const & module : unit.importedModules )
+            {
+                if ( std::find( std::begin( result ), std::end( result ), module ) == std::end( result ) )
+                {
+                    result.push_back( module );
+                }
+            }
         }
+        return result;
     }
-    else
+} // namespace
+
+bool compile( Compiler::Settings settings, AST::Node::Pointer const & node )
+{
+    std::vector< Unit > units;
+    if ( !emitObjectCode( settings, node, units ) ) { return false; }
+
+    std::vector< std::string_view > objects;
+    for ( auto const & unit : units )
     {
-        std::printf( "%s linker not found in PATH!", linker );
+        objects.emplace_back( unit.objectCode.data(), std::size( unit.objectCode ) );
+    }
+
+    auto const start{ Clock::now() };
+    if ( std::string diagnostics; !link( objects, settings.executableFilename, importedModules( units ), diagnostics ) )
+    {
+        llvm::errs() << diagnostics;
         return false;
     }
 
-    std::remove( objectCodeFilename );
+    if ( settings.statistics != nullptr )
+    {
+        settings.statistics->record( "linking", start );
+    }
+
+    return true;
+}
+
+bool compile( Compiler::Settings const & settings, AST::Node::Pointer const & node, Compiler::Output & output )
+{
+    std::vector< Unit > units;
+    if ( !emitObjectCode( settings, node, units ) ) { return false; }
+
+    std::vector< std::string_view > objects;
+    for ( auto const & unit : units )
+    {
+        objects.emplace_back( unit.objectCode.data(), std::size( unit.objectCode ) );
+    }
+    output.importedModules = importedModules( units );
+
+    auto const start{ Clock::now() };
+    if ( std::string diagnostics; !link( objects, output.objectCode, output.importedModules, diagnostics ) )
+    {
+        output.diagnostics.push_back( { .errorInfo = std::nullopt, .message = "Module could not be linked" } );
+
+        // Each line of the linker messages is a diagnostic of its own
+        llvm::SmallVector< llvm::StringRef > lines;
+        llvm::StringRef{ diagnostics }.split( lines, '\n', -1 /* maxSplit */, false /* keepEmpty */ );
+        for ( auto const line : lines )
+        {
+            output.diagnostics.push_back( { .errorInfo = std::nullopt, .message = line.str() } );
+        }
+        return true;
+    }
+
+    if ( settings.statistics != nullptr )
+    {
+        settings.statistics->record( "linking", start );
+    }
+
     return true;
 }
 
-} // namespace A1::LLVM
\ No newline at end of file
+} // namespace A1::LLVM
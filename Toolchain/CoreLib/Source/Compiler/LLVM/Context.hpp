@@ -9,6 +9,8 @@
 
 #include "Symbols.hpp"
 
+#include <CoreLib/AST/ASTNode.hpp>
+
 #if defined (__clang__)
 #   pragma clang diagnostic push
 #   pragma clang diagnostic ignored "-Wunused-parameter"
@@ -28,6 +30,9 @@
 #endif
 
 #include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
 namespace A1::LLVM
 {
@@ -47,6 +52,25 @@ struct Context final
 
     /** Stores all the external module names that are imported within the current module. */
     std::vector< std::string > importedModules{};
+
+    /**
+     * Lowered types indexed by Registry::getIndex. Types are lowered on first use,
+     * a null entry stands for a type which is not lowered yet.
+     */
+    std::vector< llvm::Type * > types{};
+
+    /** Array subscripts which are proven to be in bounds, their bounds checks are omitted. */
+    std::unordered_set< AST::Node const * > inBoundsSubscripts{};
+
+    /**
+     * Names of the entry points of the module, i.e. contract functions and constructors,
+     * which are called by the Adamnite VM, and of the free functions, which may be called
+     * from the other units of the module, thus never internalized by the optimizer.
+     */
+    std::unordered_set< std::string > exportedFunctions{};
+
+    /** Set while lowering a contract or a function of another unit, only its declarations are generated. */
+    bool declarationsOnly{ false };
 };
 
 } // namespace A1::LLVM
\ No newline at end of file
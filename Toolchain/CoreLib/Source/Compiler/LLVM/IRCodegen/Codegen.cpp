@@ -8,6 +8,7 @@
 #include "Codegen.hpp"
 #include "CodegenVisitor.hpp"
 #include "CodegenBuiltin.hpp"
+#include "CodegenWideInteger.hpp"
 
 #include <CoreLib/Utils/Macros.hpp>
 
@@ -31,17 +32,43 @@
 #   pragma GCC diagnostic pop
 #endif
 
-#include <string_view>
+#include <algorithm>
+#include <initializer_list>
 #include <memory>
+#include <string_view>
 
 namespace A1::LLVM::IR
 {
 
+namespace
+{
+    [[ nodiscard ]] bool isDefinition( AST::Node const & node, std::initializer_list< AST::NodeType > const types ) noexcept
+    {
+        return node.is< AST::NodeType >() && std::find( std::begin( types ), std::end( types ), node.get< AST::NodeType >() ) != std::end( types );
+    }
+} // namespace
+
+std::vector< AST::Node const * > units( AST::Node const & moduleNode )
+{
+    std::vector< AST::Node const * > result{ nullptr };
+    for ( auto const & node : moduleNode.children() )
+    {
+        if ( node != nullptr && isDefinition( *node, { AST::NodeType::ContractDefinition, AST::NodeType::FunctionDefinition } ) )
+        {
+            result.push_back( node.get() );
+        }
+    }
+    return result;
+}
+
 Context codegen
 (
     AST::Node::Pointer const & moduleNode,
+    AST::Node          const * unit,
     llvm::DataLayout   const   dataLayout,
-    std::string_view   const   targetTriple
+    std::string_view   const   targetTriple,
+    std::unordered_set< AST::Node const * > inBoundsSubscripts,
+    bool const discardValueNames
 )
 {
     auto ctx
@@ -49,6 +76,9 @@ Context codegen
         [ & ]()
         {
             auto context{ std::make_unique< llvm::LLVMContext >()                };
+
+            // Names of the values are used only when the IR is written out, e.g. '--llvm-ir'
+            context->setDiscardValueNames( discardValueNames );
             auto builder{ std::make_unique< llvm::IRBuilder<> >( *context )      };
             auto module_{ std::make_unique< llvm::Module >( "Module", *context ) };
 
@@ -64,10 +94,11 @@ Context codegen
 
             return Context
             {
-                .internalCtx = std::move( context ),
-                .builder     = std::move( builder ),
-                .module_     = std::move( module_ ),
-                .symbols     = std::move( symbols )
+                .internalCtx        = std::move( context ),
+                .builder            = std::move( builder ),
+                .module_            = std::move( module_ ),
+                .symbols            = std::move( symbols ),
+                .inBoundsSubscripts = std::move( inBoundsSubscripts )
             };
         }()
     };
@@ -98,19 +129,16 @@ Context codegen
     for ( auto const & node : moduleNode->children() )
     {
         if ( node == nullptr ) { continue; }
-        if
-        (
-            node->is< AST::NodeType >() &&
-            (
-                node->get< AST::NodeType >() == AST::NodeType::ContractDefinition ||
-                node->get< AST::NodeType >() == AST::NodeType::FunctionDefinition
-            )
-        )
+        if ( isDefinition( *node, { AST::NodeType::ContractDefinition, AST::NodeType::ClassDefinition, AST::NodeType::FunctionDefinition } ) )
         {
             inMainBlock = false;
+
+            // Contracts and functions of the other units are declared, so that they can be called
+            ctx.declarationsOnly = node.get() != unit && !isDefinition( *node, { AST::NodeType::ClassDefinition } );
             codegen( ctx, node );
+            ctx.declarationsOnly = false;
         }
-        else
+        else if ( unit == nullptr )
         {
             if ( !inMainBlock )
             {
@@ -122,23 +150,35 @@ Context codegen
         }
     }
 
-    if ( !inMainBlock )
+#ifdef TESTS_ENABLED
+    if ( unit == nullptr )
     {
-        // Getting back to main block
-        ctx.builder->SetInsertPoint( mainBlock );
-    }
-
-    ctx.builder->CreateRet( llvm::ConstantInt::get( *ctx.internalCtx, llvm::APInt( 32U, 0U, false /* isSigned */ ) ) );
+        if ( !inMainBlock )
+        {
+            // Getting back to main block
+            ctx.builder->SetInsertPoint( mainBlock );
+        }
 
-#ifndef TESTS_ENABLED
+        ctx.builder->CreateRet( llvm::ConstantInt::get( *ctx.internalCtx, llvm::APInt( 32U, 0U, false /* isSigned */ ) ) );
+        ctx.exportedFunctions.insert( "main" );
+    }
+    else
+    {
+        // Main function is defined by the main unit only
+        mainFunction->eraseFromParent();
+    }
+#else
     /**
      * @note: Main function exists only for the sake of testing.
      * In production, when source code is built to ADVM bytecode,
      * main function should be left out.
      */
+    static_cast< void >( inMainBlock );
     mainFunction->eraseFromParent();
 #endif // TESTS_ENABLED
 
+    expandWideDivisions( ctx );
+
     return ctx;
 }
 
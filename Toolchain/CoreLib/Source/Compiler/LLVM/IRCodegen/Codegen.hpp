@@ -11,6 +11,9 @@
 
 #include <CoreLib/AST/ASTNode.hpp>
 
+#include <unordered_set>
+#include <vector>
+
 namespace llvm
 {
     // fwd
@@ -20,12 +23,27 @@ namespace llvm
 namespace A1::LLVM::IR
 {
 
+/**
+ * Returns the units of the code generation of the module, i.e. the top level contracts and functions,
+ * which are lowered independently of each other, each one into its own LLVM context, preceded by the
+ * main unit, i.e. null, which stands for the top level statements. Units are in the order of the source.
+ */
+[[ nodiscard ]]
+std::vector< AST::Node const * > units( AST::Node const & moduleNode );
+
+/**
+ * Lowers the unit of the module, in which the contracts and functions of the other units are only declared.
+ * Classes are values rather than units, they are lowered into every unit which may use them.
+ */
 [[ nodiscard ]]
 Context codegen
 (
     AST::Node::Pointer const & moduleNode,
+    AST::Node          const * unit,
     llvm::DataLayout   const   dataLayout,
-    std::string_view   const   targetTriple
+    std::string_view   const   targetTriple,
+    std::unordered_set< AST::Node const * > inBoundsSubscripts = {},
+    bool const discardValueNames = false
 );
 
 } // namespace A1::LLVM::IR
\ No newline at end of file
@@ -0,0 +1,336 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include "CodegenArray.hpp"
+#include "CodegenExpression.hpp"
+#include "CodegenRuntime.hpp"
+
+#include <CoreLib/Types.hpp>
+#include <CoreLib/Utils/Macros.hpp>
+
+#if defined (__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunused-parameter"
+#elif defined(__GNUC__) || defined(__GNUG__)
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/GlobalVariable.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/MDBuilder.h>
+#include <llvm/IR/Module.h>
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#elif defined(__GNUC__) || defined(__GNUG__)
+#   pragma GCC diagnostic pop
+#endif
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+
+namespace A1::LLVM::IR
+{
+
+namespace
+{
+    [[ nodiscard ]]
+    ArrayType const * getArrayType( AST::Node::Pointer const & node ) noexcept
+    {
+        auto const typeID{ node->typeID() };
+        return typeID != nullptr ? std::get_if< ArrayType >( typeID ) : nullptr;
+    }
+
+    /** Loads the handle of the array, which is null for the empty array. */
+    [[ nodiscard ]]
+    llvm::Value * codegenHandle( Context & ctx, AST::Node::Pointer const & array )
+    {
+        auto * handle{ codegen( ctx, array ) };
+        return handle != nullptr ? Detail::load( ctx, handle ) : nullptr;
+    }
+
+    /**
+     * Null handle is redirected to the zero constant, thus the length of the empty
+     * array is loaded without branching around the load.
+     */
+    [[ nodiscard ]]
+    llvm::Value * codegenLength( Context & ctx, llvm::Value * handle )
+    {
+        auto & builder{ *ctx.builder };
+
+        static constexpr auto name{ "array.empty" };
+
+        auto * empty{ ctx.module_->getNamedGlobal( name ) };
+        if ( empty == nullptr )
+        {
+            empty = new llvm::GlobalVariable
+            (
+                *ctx.module_,
+                builder.getInt64Ty(),
+                true /* isConstant */,
+                llvm::GlobalValue::PrivateLinkage,
+                builder.getInt64( 0U ),
+                name
+            );
+        }
+
+        auto * header{ builder.CreateSelect( builder.CreateIsNull( handle ), builder.CreateBitCast( empty, builder.getInt8PtrTy() ), handle ) };
+        return builder.CreateLoad( builder.getInt64Ty(), builder.CreateBitCast( header, builder.getInt64Ty()->getPointerTo() ), "arraylength" );
+    }
+
+    /** Class of the elements of the struct-of-arrays array, which is defined before the array is lowered. */
+    [[ nodiscard ]]
+    Symbols::ContractType const & getClass( Context & ctx, ArrayType const & array )
+    {
+        return ctx.symbols.contractTypes.at( std::string{ Registry::toStringView( array.innerTypeID ) } );
+    }
+
+    /** Loads the handle of the column, the reference points to the handles of all the columns. */
+    [[ nodiscard ]]
+    llvm::Value * codegenColumnHandle( Context & ctx, llvm::Value * reference, unsigned const column )
+    {
+        auto & builder{ *ctx.builder };
+        return builder.CreateLoad( builder.getInt8PtrTy(), builder.CreateStructGEP( reference->getType()->getContainedType( 0U ), reference, column ) );
+    }
+
+    /** Returns the pointer to the element of the given type, the node is the subscript. */
+    [[ nodiscard ]]
+    llvm::Value * codegenElement( Context & ctx, AST::Node const & node, llvm::Value * handle, llvm::Type * elementType )
+    {
+        auto & builder{ *ctx.builder };
+        auto const & index{ node.children()[ 1U ] };
+
+        // Index of the num type is truncated, as any other num passed as an integer
+        auto const value{ codegenNumeric( ctx, index ) };
+        if ( value.value == nullptr ) { return nullptr; }
+
+        auto * index64{ Detail::convert( ctx, value, builder.getInt64Ty(), false /* isFixed */, Detail::isSigned( index ) ) };
+
+        // Negative index is out of bounds as well, as it compares as the huge unsigned one
+        if ( !ctx.inBoundsSubscripts.contains( &node ) )
+        {
+            codegenBoundsCheck( ctx, builder.CreateICmpULT( index64, codegenLength( ctx, handle ) ) );
+        }
+
+        auto * data{ builder.CreateConstGEP1_64( builder.getInt8Ty(), handle, arrayDataOffset ) };
+        return builder.CreateGEP( elementType, builder.CreateBitCast( data, elementType->getPointerTo() ), index64, "arrayelement" );
+    }
+
+    /** Appends the zero-initialized element to the array, the reference is the pointer to the handle. */
+    [[ nodiscard ]]
+    llvm::Value * codegenAppend( Context & ctx, llvm::Value * reference, llvm::Type * elementType )
+    {
+        auto & builder{ *ctx.builder };
+
+        auto append
+        {
+            Detail::getRuntimeFunction
+            (
+                ctx,
+                "array_append",
+                llvm::FunctionType::get( builder.getInt8PtrTy(), { builder.getInt8PtrTy()->getPointerTo(), builder.getInt32Ty() }, false )
+            )
+        };
+
+        // Elements are laid out as in the LLVM array, i.e. by their allocation size
+        auto const size{ static_cast< std::uint32_t >( ctx.module_->getDataLayout().getTypeAllocSize( elementType ).getFixedSize() ) };
+
+        auto * pointer{ builder.CreateCall( append, { reference, builder.getInt32( size ) } ) };
+        return builder.CreateBitCast( pointer, elementType->getPointerTo() );
+    }
+} // namespace
+
+void codegenBoundsCheck( Context & ctx, llvm::Value * inBounds )
+{
+    auto & builder{ *ctx.builder };
+    auto * parent { builder.GetInsertBlock()->getParent() };
+
+    auto * failBlock{ llvm::BasicBlock::Create( *ctx.internalCtx, "bounds.fail", parent ) };
+    auto * okBlock  { llvm::BasicBlock::Create( *ctx.internalCtx, "bounds.ok"  , parent ) };
+
+    builder.CreateCondBr
+    (
+        inBounds,
+        okBlock,
+        failBlock,
+        llvm::MDBuilder( *ctx.internalCtx ).createBranchWeights( 1U << 20U, 1U )
+    );
+
+    builder.SetInsertPoint( failBlock );
+    builder.CreateCall( ctx.symbols.externalBuiltInFunctions().at( "abort" ), llvm::None );
+    builder.CreateUnreachable();
+
+    builder.SetInsertPoint( okBlock );
+}
+
+bool isArrayIndex( AST::Node::Pointer const & node ) noexcept
+{
+    return
+        node->is< AST::NodeType >() && node->get< AST::NodeType >() == AST::NodeType::Index &&
+        std::size( node->children() ) == 2U && getArrayType( node->children()[ 0U ] ) != nullptr;
+}
+
+bool isColumnIndex( AST::Node::Pointer const & node ) noexcept
+{
+    return isArrayIndex( node ) && getArrayType( node->children()[ 0U ] )->layout == ArrayLayout::StructOfArrays;
+}
+
+bool isArray( TypeID const typeID ) noexcept
+{
+    return typeID != nullptr && std::holds_alternative< ArrayType >( *typeID );
+}
+
+llvm::Value * codegenArrayElement( Context & ctx, AST::Node const & node )
+{
+    auto const & nodes{ node.children() };
+    ASSERTM( std::size( nodes ) == 2U, "Array subscript consists of the array and the index" );
+
+    auto const * array{ getArrayType( nodes[ 0U ] ) };
+    ASSERT( array != nullptr && array->layout == ArrayLayout::ArrayOfStructs );
+
+    auto * elementType{ getStorageType( ctx, array->innerTypeID ) };
+    auto * handle     { codegenHandle( ctx, nodes[ 0U ] ) };
+    if ( elementType == nullptr || handle == nullptr ) { return nullptr; }
+
+    return codegenElement( ctx, node, handle, elementType );
+}
+
+llvm::Value * codegenArrayLoad( Context & ctx, AST::Node const & node )
+{
+    auto * element{ codegenArrayElement( ctx, node ) };
+    if ( element == nullptr ) { return nullptr; }
+
+    auto * elementType{ element->getType()->getContainedType( 0U ) };
+    return Detail::isInstance( getArrayType( node.children()[ 0U ] )->innerTypeID )
+        ? element
+        : ctx.builder->CreateLoad( elementType, element );
+}
+
+llvm::Value * codegenColumnElement( Context & ctx, AST::Node const & node, std::string_view const dataMember )
+{
+    auto const & nodes{ node.children() };
+    ASSERTM( std::size( nodes ) == 2U, "Array subscript consists of the array and the index" );
+
+    auto const * array{ getArrayType( nodes[ 0U ] ) };
+    ASSERT( array != nullptr && array->layout == ArrayLayout::StructOfArrays );
+
+    auto const & dataMembers{ getClass( ctx, *array ).dataMemberTypes };
+    auto const   it         { dataMembers.find( std::string{ dataMember } ) };
+    ASSERTM( it != std::end( dataMembers ), "Data member of the class is known to the semantic analysis" );
+
+    auto * reference{ codegen( ctx, nodes[ 0U ] ) };
+    if ( reference == nullptr ) { return nullptr; }
+
+    auto const column{ static_cast< unsigned >( std::distance( std::begin( dataMembers ), it ) ) };
+    return codegenElement( ctx, node, codegenColumnHandle( ctx, reference, column ), it->second.internalType );
+}
+
+llvm::Value * codegenColumnLoad( Context & ctx, AST::Node const & node, std::string_view const dataMember )
+{
+    auto * element{ codegenColumnElement( ctx, node, dataMember ) };
+    if ( element == nullptr ) { return nullptr; }
+
+    return ctx.builder->CreateLoad( element->getType()->getContainedType( 0U ), element );
+}
+
+llvm::Value * codegenArrayLength( Context & ctx, AST::Node::Pointer const & array )
+{
+    auto const * type{ getArrayType( array ) };
+    ASSERT( type != nullptr );
+
+    if ( type->layout == ArrayLayout::StructOfArrays )
+    {
+        // Columns have the same length, the class without data members has no columns though
+        if ( getClass( ctx, *type ).dataMemberTypes.empty() ) { return ctx.builder->getInt64( 0U ); }
+
+        auto * reference{ codegen( ctx, array ) };
+        return reference != nullptr ? codegenLength( ctx, codegenColumnHandle( ctx, reference, 0U ) ) : nullptr;
+    }
+
+    auto * handle{ codegenHandle( ctx, array ) };
+    return handle != nullptr ? codegenLength( ctx, handle ) : nullptr;
+}
+
+llvm::Value * codegenArrayAppend( Context & ctx, std::span< AST::Node::Pointer const > const nodes )
+{
+    ASSERTM( std::size( nodes ) == 2U, "Append consists of the array and the call of the 'append' function" );
+    auto & builder{ *ctx.builder };
+
+    auto const * array{ getArrayType( nodes[ 0U ] ) };
+    ASSERT( array != nullptr );
+
+    auto const & callNodes{ nodes[ 1U ]->children() };
+    ASSERTM( std::size( callNodes ) == 2U, "Function 'append' takes the element only" );
+
+    auto * elementType{ getStorageType( ctx, array->innerTypeID ) };
+    if ( elementType == nullptr ) { return nullptr; }
+
+    // Element is evaluated before the append, which may invalidate the pointers to the elements
+    llvm::Value * element{ nullptr };
+    if ( Detail::isInstance( array->innerTypeID ) )
+    {
+        auto * instance{ codegen( ctx, callNodes[ 1U ] ) };
+        if ( instance == nullptr ) { return nullptr; }
+
+        element = builder.CreateLoad( elementType, Detail::load( ctx, instance ) );
+    }
+    else
+    {
+        auto const value{ codegenNumeric( ctx, callNodes[ 1U ] ) };
+        if ( value.value == nullptr ) { return nullptr; }
+
+        element = Detail::convert( ctx, value, elementType, Detail::isFixedPoint( array->innerTypeID, elementType ), Detail::isSigned( callNodes[ 1U ] ) );
+    }
+
+    auto * reference{ codegenArrayReference( ctx, nodes[ 0U ] ) };
+    if ( reference == nullptr ) { return nullptr; }
+
+    if ( array->layout == ArrayLayout::ArrayOfStructs )
+    {
+        builder.CreateStore( element, codegenAppend( ctx, reference, elementType ) );
+        return element;
+    }
+
+    // Each data member is appended to its column, packed bools are unpacked into bytes
+    auto column{ 0U };
+    for ( auto const & [ name, dataMember ] : getClass( ctx, *array ).dataMemberTypes )
+    {
+        auto * value{ builder.CreateExtractValue( element, static_cast< unsigned >( dataMember.index ) ) };
+        if ( dataMember.bit )
+        {
+            value = builder.CreateAnd( builder.CreateLShr( value, *dataMember.bit ), 1U );
+        }
+
+        auto * columnReference{ builder.CreateStructGEP( reference->getType()->getContainedType( 0U ), reference, column++ ) };
+        builder.CreateStore( value, codegenAppend( ctx, columnReference, dataMember.internalType ) );
+    }
+    return element;
+}
+
+llvm::Value * codegenArrayReference( Context & ctx, AST::Node::Pointer const & array )
+{
+    auto & builder{ *ctx.builder };
+
+    auto * handle{ codegen( ctx, array ) };
+    if ( handle == nullptr ) { return nullptr; }
+
+    // Struct-of-arrays array is referred to by the pointer to the handles of its columns
+    if ( auto const * type{ getArrayType( array ) }; type != nullptr && type->layout == ArrayLayout::StructOfArrays ) { return handle; }
+
+    if ( auto * type{ handle->getType() }; !type->isPointerTy() || !type->getContainedType( 0U )->isPointerTy() )
+    {
+        auto * slot{ Detail::createSlot( *builder.GetInsertBlock()->getParent(), type ) };
+        builder.CreateStore( handle, slot );
+        handle = slot;
+    }
+    return builder.CreateBitCast( handle, builder.getInt8PtrTy()->getPointerTo() );
+}
+
+} // namespace A1::LLVM::IR
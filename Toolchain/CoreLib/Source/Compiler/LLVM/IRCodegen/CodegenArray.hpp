@@ -0,0 +1,80 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include "../Context.hpp"
+
+#include <CoreLib/AST/ASTNode.hpp>
+
+#include <span>
+#include <string_view>
+
+namespace llvm
+{
+    // fwd
+    class Value;
+} // namespace llvm
+
+namespace A1::LLVM::IR
+{
+
+/**
+ * Arrays are buffers of the runtime of the CoreUtils library, see CoreUtils/Containers/Array.hpp.
+ * Variable or data member of the array type holds the opaque handle, which is null until the first
+ * append, thus the zero-initialized contract holds empty arrays. The length and the elements are
+ * accessed inline, only the append calls the runtime.
+ *
+ * Subscripts are checked against the length and the out of bounds access aborts, unless the
+ * bounds analysis proved the subscript to be in bounds, see Semantic/BoundsAnalysis.hpp.
+ *
+ * Instances are stored inline, thus the subscript of the array of instances is the pointer
+ * to the element. Struct-of-arrays array holds the handle of the column per data member
+ * instead, e.g. 'proposals[i].count' reads the 'count' column only. Columns are ordered
+ * by the names of the data members and all of them have the same length.
+ */
+
+/** Offset of the first element from the handle, i.e. the size of the array header. */
+inline constexpr unsigned arrayDataOffset{ 16U };
+
+/** Aborts unless the condition holds, the check is marked as unlikely to fail. */
+void codegenBoundsCheck( Context & ctx, llvm::Value * inBounds );
+
+/** Checks whether the node is the subscript of the array, e.g. 'self.values[i]'. */
+[[ nodiscard ]] bool isArrayIndex( AST::Node::Pointer const & node ) noexcept;
+
+/** Checks whether the node is the subscript of the struct-of-arrays array, e.g. 'proposals[i]'. */
+[[ nodiscard ]] bool isColumnIndex( AST::Node::Pointer const & node ) noexcept;
+
+/** Checks whether the type is the array type, e.g. the type of the array argument of the function. */
+[[ nodiscard ]] bool isArray( TypeID const typeID ) noexcept;
+
+/** Returns the pointer to the element, the subscript node is the array and the index. */
+[[ nodiscard ]] llvm::Value * codegenArrayElement( Context & ctx, AST::Node const & node );
+
+/** Loads the element of the subscript, the instance is not loaded as it is accessed by its pointer. */
+[[ nodiscard ]] llvm::Value * codegenArrayLoad( Context & ctx, AST::Node const & node );
+
+/** Returns the pointer to the data member of the struct-of-arrays element within its column. */
+[[ nodiscard ]] llvm::Value * codegenColumnElement( Context & ctx, AST::Node const & node, std::string_view const dataMember );
+
+/** Loads the data member of the struct-of-arrays element. */
+[[ nodiscard ]] llvm::Value * codegenColumnLoad( Context & ctx, AST::Node const & node, std::string_view const dataMember );
+
+/** Loads the length of the array, zero for the array which was never appended to. */
+[[ nodiscard ]] llvm::Value * codegenArrayLength( Context & ctx, AST::Node::Pointer const & array );
+
+/** Appends the element, the nodes are the array and the call of 'append'. */
+[[ nodiscard ]] llvm::Value * codegenArrayAppend( Context & ctx, std::span< AST::Node::Pointer const > const nodes );
+
+/**
+ * Returns the pointer to the handle. Arrays are passed to functions by reference,
+ * as the append may reallocate the buffer, which updates the handle.
+ */
+[[ nodiscard ]] llvm::Value * codegenArrayReference( Context & ctx, AST::Node::Pointer const & array );
+
+} // namespace A1::LLVM::IR
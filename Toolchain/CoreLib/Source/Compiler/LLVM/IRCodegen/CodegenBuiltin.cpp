@@ -163,6 +163,23 @@ Symbols::Table< llvm::FunctionCallee > externalBuiltinFunctions( llvm::LLVMConte
                 )
             )
         },
+        {
+            "memcmp",
+            module_.getOrInsertFunction
+            (
+                "memcmp",
+                llvm::FunctionType::get
+                (
+                    llvm::IntegerType::getInt32Ty( ctx ),
+                    {
+                        llvm::PointerType::get( llvm::Type::getInt8Ty( ctx ), 0 ),
+                        llvm::PointerType::get( llvm::Type::getInt8Ty( ctx ), 0 ),
+                        llvm::IntegerType::getInt64Ty( ctx )
+                    },
+                    false
+                )
+            )
+        },
         {
             "is_utf8",
             module_.getOrInsertFunction
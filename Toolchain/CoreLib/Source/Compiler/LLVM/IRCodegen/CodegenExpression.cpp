@@ -6,9 +6,15 @@
  */
 
 #include "CodegenExpression.hpp"
+#include "CodegenArray.hpp"
+#include "CodegenMap.hpp"
+#include "CodegenRuntime.hpp"
+#include "CodegenWideInteger.hpp"
 
 #include <CoreLib/Types.hpp>
 
+#include "Utils/Utils.hpp"
+
 #if defined (__clang__)
 #   pragma clang diagnostic push
 #   pragma clang diagnostic ignored "-Wunused-parameter"
@@ -27,79 +33,329 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
 namespace A1::LLVM::IR
 {
 
 namespace
 {
+    /** Format string of the module, which is emitted on first use. */
+    [[ nodiscard ]]
+    llvm::Value * getFormat( Context & ctx, llvm::StringRef const name, llvm::StringRef const format )
+    {
+        if ( auto * global{ ctx.module_->getNamedGlobal( name ) }; global != nullptr )
+        {
+            return ctx.builder->CreateConstInBoundsGEP2_32( global->getValueType(), global, 0U, 0U );
+        }
+        return ctx.builder->CreateGlobalStringPtr( format, name, 0U, ctx.module_.get() );
+    }
+
+    /**
+     * Format is chosen according to the type resolved by the semantic analysis, which accepts
+     * the numeric and the string values only. String is not null-terminated, thus its length is
+     * passed as the precision, unless it is the decimal representation of the number.
+     * Integers are printed extended to 64 bits, 'long long' is of that width on every target.
+     */
     [[ nodiscard ]]
-    llvm::Value * getPrintFormat( Context & ctx, llvm::Type const * type )
+    llvm::Value * getPrintFormat( Context & ctx, TypeID const typeID, bool const isSigned, bool const isNullTerminated )
     {
-        if ( type->isIntegerTy( sizeof( Number::Type ) * 8U ) )
+        if ( typeID == Registry::getStrHandle() )
         {
-            static auto * format{ ctx.builder->CreateGlobalStringPtr( "%d\n", "numFormat", 0U, ctx.module_.get() ) };
-            return format;
+            return isNullTerminated ? getFormat( ctx, "strFormat", "%s\n" ) : getFormat( ctx, "strViewFormat", "%.*s\n" );
         }
-        else if
+
+        ASSERTM( Registry::isNumeric( typeID ), "Semantic analysis accepts printing of the numeric and the string values only" );
+        return isSigned ? getFormat( ctx, "numFormat", "%lld\n" ) : getFormat( ctx, "unsignedNumFormat", "%llu\n" );
+    }
+
+    [[ nodiscard ]]
+    llvm::Type * lowerType( Context & ctx, TypeID const typeID )
+    {
+        if ( typeID == nullptr ) { return nullptr; }
+
+        return std::visit
         (
-            type->isPointerTy() &&
-            type->getNumContainedTypes() > 0 &&
-            (
-                type->getContainedType( 0U )->isArrayTy  () ||
-                type->getContainedType( 0U )->isIntegerTy() ||
-                type->getContainedType( 0U )->isPointerTy()
-            )
-        )
+            Overload
+            {
+                [ & ]( PrimitiveType const type ) -> llvm::Type *
+                {
+                    switch ( type )
+                    {
+                        case PrimitiveType::Address:
+                            return llvm::Type::getInt8PtrTy( *ctx.internalCtx );
+
+                        case PrimitiveType::Str:
+                            return getStrType( ctx );
+
+                        case PrimitiveType::Bool:
+                        case PrimitiveType::I8:
+                        case PrimitiveType::U8:
+                            return llvm::Type::getInt8Ty( *ctx.internalCtx );
+
+                        case PrimitiveType::I16:
+                        case PrimitiveType::U16:
+                            return llvm::Type::getInt16Ty( *ctx.internalCtx );
+
+                        case PrimitiveType::I32:
+                        case PrimitiveType::U32:
+                            return llvm::Type::getInt32Ty( *ctx.internalCtx );
+
+                        case PrimitiveType::Num:
+                        case PrimitiveType::I64:
+                        case PrimitiveType::U64:
+                            return llvm::Type::getInt64Ty( *ctx.internalCtx );
+
+                        case PrimitiveType::I256:
+                        case PrimitiveType::U256:
+                            return llvm::Type::getIntNTy( *ctx.internalCtx, 256U );
+
+                        case PrimitiveType::Unknown:
+                        case PrimitiveType::Count:
+                            break;
+                    }
+                    return nullptr;
+                },
+                [ & ]( ArrayType const & type ) -> llvm::Type *
+                {
+                    // Arrays are managed by the runtime and are passed around as opaque handles
+                    auto * handleType{ llvm::Type::getInt8PtrTy( *ctx.internalCtx ) };
+                    if ( type.layout == ArrayLayout::ArrayOfStructs ) { return handleType; }
+
+                    // Struct-of-arrays array holds the handle of the column per data member
+                    auto const it{ ctx.symbols.contractTypes.find( std::string{ Registry::toStringView( type.innerTypeID ) } ) };
+                    if ( it == std::end( ctx.symbols.contractTypes ) ) { return nullptr; }
+
+                    return llvm::StructType::get
+                    (
+                        *ctx.internalCtx,
+                        std::vector< llvm::Type * >( std::size( it->second.dataMemberTypes ), handleType )
+                    );
+                },
+                [ & ]( ContractType const & type ) -> llvm::Type *
+                {
+                    // Contract type is known once its definition is generated
+                    if ( auto const it{ ctx.symbols.contractTypes.find( type.name ) }; it != std::end( ctx.symbols.contractTypes ) )
+                    {
+                        return llvm::PointerType::get( it->second.internalType, 0U );
+                    }
+                    return nullptr;
+                },
+                [ & ]( FunctionType const & type ) -> llvm::Type *
+                {
+                    std::vector< llvm::Type * > parameterTypes;
+                    for ( auto const parameter : type.parameterTypeIDs )
+                    {
+                        auto * parameterType{ getType( ctx, parameter.typeID ) };
+                        if ( parameterType == nullptr ) { return nullptr; }
+                        parameterTypes.push_back( parameterType );
+                    }
+
+                    auto * returnType{ type.returnTypeID != nullptr ? getType( ctx, type.returnTypeID ) : llvm::Type::getVoidTy( *ctx.internalCtx ) };
+                    if ( returnType == nullptr ) { return nullptr; }
+
+                    return llvm::PointerType::get( llvm::FunctionType::get( returnType, parameterTypes, false /* isVarArg */ ), 0U );
+                },
+                [ & ]( MapType const & ) -> llvm::Type *
+                {
+                    // Maps are managed by the runtime and are passed around as opaque handles
+                    return llvm::Type::getInt8PtrTy( *ctx.internalCtx );
+                }
+            },
+            *typeID
+        );
+    }
+
+    /** Contract type of the variable is resolved by the semantic analysis. */
+    [[ nodiscard ]]
+    std::string const & getContractName( AST::Node::Pointer const & variableNode ) noexcept
+    {
+        ASSERTM( Detail::isInstance( variableNode->typeID() ), "Semantic analysis resolves the contract of the accessed instance" );
+        return std::get< ContractType >( *variableNode->typeID() ).name;
+    }
+
+    /** Type of the function's parameter, as resolved by the semantic analysis for the callee. */
+    [[ nodiscard ]]
+    TypeID getParameterTypeID( AST::Node::Pointer const & callee, std::size_t const index ) noexcept
+    {
+        if ( auto const typeID{ callee->typeID() }; typeID != nullptr && std::holds_alternative< FunctionType >( *typeID ) )
         {
-            static auto * format{ ctx.builder->CreateGlobalStringPtr( "%s\n", "strFormat", 0U, ctx.module_.get() ) };
-            return format;
+            auto const & parameters{ std::get< FunctionType >( *typeID ).parameterTypeIDs };
+            if ( index < std::size( parameters ) ) { return parameters[ index ].typeID; }
         }
         return nullptr;
     }
 
     [[ nodiscard ]]
-    llvm::Type * getType( Context & ctx, TypeID const typeID )
+    llvm::Constant * getInitialValue( Context & ctx, TypeID const typeID, llvm::Type * type, AST::Node const * initNode )
     {
-             if ( typeID == Registry::getAddressHandle() ) { return llvm::Type::getInt8PtrTy ( *ctx.internalCtx ); }
-        else if ( typeID == Registry::getBoolHandle   () ) { return llvm::Type::getInt8Ty    ( *ctx.internalCtx ); }
-        else if ( typeID == Registry::getNumHandle    () ) { return llvm::Type::getInt64Ty   ( *ctx.internalCtx ); }
-        else if ( typeID == Registry::getStrHandle    () ) { return llvm::Type::getInt8PtrTy ( *ctx.internalCtx ); }
-        else if ( typeID == Registry::getI8Handle     () || typeID == Registry::getU8Handle () ) { return llvm::Type::getInt8Ty ( *ctx.internalCtx ); }
-        else if ( typeID == Registry::getI16Handle    () || typeID == Registry::getU16Handle() ) { return llvm::Type::getInt16Ty( *ctx.internalCtx ); }
-        else if ( typeID == Registry::getI32Handle    () || typeID == Registry::getU32Handle() ) { return llvm::Type::getInt32Ty( *ctx.internalCtx ); }
-        else if ( typeID == Registry::getI64Handle    () || typeID == Registry::getU64Handle() ) { return llvm::Type::getInt64Ty( *ctx.internalCtx ); }
+        if ( initNode != nullptr )
+        {
+            if ( initNode->is< Number >() && type->isIntegerTy() )
+            {
+                auto const & number{ initNode->get< Number >() };
+                auto const   value { Detail::isFixedPoint( typeID, type ) ? getFixedPoint( number ) : getIntegralPart( number ) };
+                return llvm::ConstantInt::get( type, static_cast< std::uint64_t >( value ), true /* isSigned */ );
+            }
+            else if ( initNode->is< AST::Boolean >() && type->isIntegerTy() )
+            {
+                return llvm::ConstantInt::get( type, initNode->get< AST::Boolean >() ? 1U : 0U );
+            }
+            else if ( initNode->is< StringLiteral >() )
+            {
+                return codegenStrLiteral( ctx, initNode->get< StringLiteral >().value );
+            }
+        }
 
-        return nullptr;
+        // Zero-initialized string is the empty null view
+        return llvm::Constant::getNullValue( type );
+    }
+
+    /**
+     * Object of the data member access is either the variable, e.g. 'self', or the instance
+     * stored in the array or the map. Writing to the instance of the missing key inserts the key.
+     */
+    [[ nodiscard ]]
+    llvm::Value * codegenObject( Context & ctx, AST::Node::Pointer const & node, bool const isWrite )
+    {
+        if ( node->is< Identifier >() ) { return ctx.symbols.variable( node->get< Identifier >().name ); }
+        if ( isWrite && isMapIndex( node ) ) { return codegenMapInsert( ctx, node->children() ); }
+
+        auto * object{ codegen( ctx, node ) };
+        return object != nullptr ? Detail::load( ctx, object ) : nullptr;
     }
 } // namespace
 
-llvm::Value * codegenAssign( Context & ctx, std::span< AST::Node::Pointer const > const nodes )
+/**
+ * Type lowering happens for every declaration, thus lowered types are
+ * cached in the context and looked up by the dense index of the type.
+ */
+llvm::Type * getType( Context & ctx, TypeID const typeID )
 {
-    ASSERTM( std::size( nodes ) == 2U, "Assignment expression consists of two operands" );
+    auto const index{ Registry::getIndex( typeID ) };
+    if ( index < std::size( ctx.types ) && ctx.types[ index ] != nullptr )
+    {
+        return ctx.types[ index ];
+    }
 
-    auto * lhs{ codegen( ctx, nodes[ 0U ] ) };
+    auto * type{ lowerType( ctx, typeID ) };
+    if ( type != nullptr )
+    {
+        if ( index >= std::size( ctx.types ) ) { ctx.types.resize( index + 1U, nullptr ); }
+        ctx.types[ index ] = type;
+    }
+    return type;
+}
 
-    llvm::Value * value{ nullptr };
-    if ( nodes[ 1U ]->is< StringLiteral >() )
+llvm::Type * getStorageType( Context & ctx, TypeID const typeID )
+{
+    if ( typeID != nullptr && std::holds_alternative< ContractType >( *typeID ) )
     {
-        value = codegen( ctx, nodes[ 1U ] );
+        if ( auto const it{ ctx.symbols.contractTypes.find( std::get< ContractType >( *typeID ).name ) }; it != std::end( ctx.symbols.contractTypes ) )
+        {
+            return it->second.internalType;
+        }
+        return nullptr;
     }
-    else
+    return getType( ctx, typeID );
+}
+
+llvm::Value * codegenStore( Context & ctx, AST::Node::Pointer const & target, NumericValue const value, bool const isSigned )
+{
+    auto & builder{ *ctx.builder };
+
+    llvm::Value * pointer{ nullptr };
+    if ( target->is< AST::NodeType >() && target->get< AST::NodeType >() == AST::NodeType::MemberCall )
     {
-        auto * rhs{ codegen( ctx, nodes[ 1U ] ) };
-        ctx.builder->CreateStore( rhs, lhs );
-        return lhs;
+        auto const & nodes{ target->children() };
+        if ( std::size( nodes ) == 2U && nodes[ 1U ]->is< Identifier >() )
+        {
+            auto const & name{ nodes[ 1U ]->get< Identifier >().name };
+            if ( isColumnIndex( nodes[ 0U ] ) )
+            {
+                pointer = codegenColumnElement( ctx, *nodes[ 0U ], name );
+                if ( pointer != nullptr && target->typeID() == Registry::getBoolHandle() )
+                {
+                    // Bool column holds a byte per element, which reads as the packed bool does
+                    builder.CreateStore( builder.CreateZExt( builder.CreateIsNotNull( value.value ), builder.getInt8Ty() ), pointer );
+                    return value.value;
+                }
+            }
+            else
+            {
+                auto * object{ codegenObject( ctx, nodes[ 0U ], true /* isWrite */ ) };
+                if ( object == nullptr ) { return nullptr; }
+
+                auto const & contract  { ctx.symbols.contractTypes[ getContractName( nodes[ 0U ] ) ] };
+                auto const & dataMember{ contract.dataMemberTypes.at( name ) };
+
+                pointer = builder.CreateStructGEP( contract.internalType, object, dataMember.index );
+                if ( dataMember.bit )
+                {
+                    // Packed bool is written by replacing its bit within the byte
+                    auto * byte
+                    {
+                        builder.CreateAnd
+                        (
+                            builder.CreateLoad( dataMember.internalType, pointer ),
+                            ~( 1U << *dataMember.bit ) & 0xFFU
+                        )
+                    };
+
+                    auto * bit
+                    {
+                        builder.CreateShl
+                        (
+                            builder.CreateZExt( builder.CreateIsNotNull( value.value ), dataMember.internalType ),
+                            *dataMember.bit
+                        )
+                    };
+
+                    builder.CreateStore( builder.CreateOr( byte, bit ), pointer );
+                    return value.value;
+                }
+            }
+        }
     }
 
-    if ( nodes[ 0U ]->is< Identifier >() )
+    if ( pointer == nullptr )
     {
-        ctx.symbols.variable( nodes[ 0U ]->get< Identifier >().name, value );
+        pointer =
+            isMapIndex  ( target ) ? codegenMapInsert   ( ctx, target->children() ) :
+            isArrayIndex( target ) ? codegenArrayElement( ctx, *target            ) :
+                                     codegen            ( ctx, target             );
     }
-    else
+    if ( pointer == nullptr ) { return nullptr; }
+
+    // Semantic analysis accepts the targets which are stored in memory only, including the parameters
+    ASSERTM( pointer->getType()->isPointerTy() && pointer->getType()->getNumContainedTypes() > 0U, "Assignment target is stored in memory" );
+    if ( pointer->getType()->isPointerTy() && pointer->getType()->getNumContainedTypes() > 0U )
     {
-        ctx.builder->CreateStore( value, lhs );
+        auto * type{ pointer->getType()->getContainedType( 0U ) };
+        if ( type->isStructTy() && value.value->getType() == pointer->getType() )
+        {
+            // Instance stored inline in the array or the map is copied
+            builder.CreateStore( builder.CreateLoad( type, value.value ), pointer );
+        }
+        else
+        {
+            builder.CreateStore( Detail::convert( ctx, value, type, Detail::isFixedPoint( target->typeID(), type ), isSigned ), pointer );
+        }
     }
-    return value;
+    return pointer;
+}
+
+llvm::Value * codegenAssign( Context & ctx, std::span< AST::Node::Pointer const > const nodes )
+{
+    ASSERTM( std::size( nodes ) == 2U, "Assignment expression consists of two operands" );
+
+    auto const rhs{ codegenNumeric( ctx, nodes[ 1U ] ) };
+    if ( rhs.value == nullptr ) { return nullptr; }
+
+    return codegenStore( ctx, nodes[ 0U ], rhs, Detail::isSigned( nodes[ 1U ] ) );
 }
 
 llvm::Value * codegenCall( Context & ctx, std::span< AST::Node::Pointer const > const nodes )
@@ -111,37 +367,48 @@ llvm::Value * codegenCall( Context & ctx, std::span< AST::Node::Pointer const >
 
     if ( auto const & type{ ctx.symbols.contractTypes.find( name ) }; type != std::end( ctx.symbols.contractTypes ) )
     {
-        auto * globalContract
+        // Class instance is a value, whereas the contract state is global
+        auto * instance
         {
-            new llvm::GlobalVariable
-            (
-                *ctx.module_,
-                type->second.internalType,
-                false, /* isConstant */
-                llvm::GlobalVariable::ExternalLinkage,
-                llvm::Constant::getNullValue( type->second.internalType )
-            )
+            type->second.isClass
+                ? static_cast< llvm::Value * >( Detail::createSlot( *ctx.builder->GetInsertBlock()->getParent(), type->second.internalType ) )
+                : new llvm::GlobalVariable
+                (
+                    *ctx.module_,
+                    type->second.internalType,
+                    false, /* isConstant */
+                    llvm::GlobalVariable::InternalLinkage,
+                    llvm::Constant::getNullValue( type->second.internalType )
+                )
         };
 
         auto * initialContract{ ctx.builder->CreateCall( ctx.symbols.functions[ fmt::format( "{}____default_init__", name ) ], llvm::None ) };
-        ctx.builder->CreateStore( initialContract, globalContract );
+        ctx.builder->CreateStore( initialContract, instance );
 
         if ( auto const ctor{ ctx.symbols.functions.find( fmt::format( "{}____init__", name ) ) }; ctor != std::end( ctx.symbols.functions ) )
         {
-            ctx.builder->CreateCall( ctor->second, { globalContract } );
+            ctx.builder->CreateCall( ctor->second, { instance } );
         }
-        return globalContract;
+        return instance;
+    }
+    else if ( name == "len" && std::size( nodes ) == 2U && isArray( nodes[ 1U ]->typeID() ) )
+    {
+        return codegenArrayLength( ctx, nodes[ 1U ] );
+    }
+    else if ( name == "len" && std::size( nodes ) == 2U && nodes[ 1U ]->typeID() == Registry::getStrHandle() )
+    {
+        return codegenStrLength( ctx, nodes[ 1U ] );
     }
     else
     {
         // Create a function call
 
-        std::vector< llvm::Value * > arguments;
+        std::vector< NumericValue > values;
         for ( auto i{ 1U }; i < std::size( nodes ); i++ )
         {
-            auto * value{ codegen( ctx, nodes[ i ] ) };
-            if ( value == nullptr ) { return nullptr; }
-            arguments.push_back( Detail::load( ctx, value ) );
+            auto const value{ codegenNumeric( ctx, nodes[ i ] ) };
+            if ( value.value == nullptr ) { return nullptr; }
+            values.push_back( value );
         }
 
         auto const & externalBuiltInFunctions{ ctx.symbols.externalBuiltInFunctions() };
@@ -154,13 +421,54 @@ llvm::Value * codegenCall( Context & ctx, std::span< AST::Node::Pointer const >
         if ( name == "print" )
         {
             // Standard print function currently supports one argument only
-            if ( std::size( arguments ) > 1U ) { return nullptr; }
+            if ( std::size( values ) > 1U ) { return nullptr; }
+
+            auto * argument        { values[ 0U ].value };
+            auto   printTypeID     { nodes[ 1U ]->typeID() };
+            auto   isNullTerminated{ false };
+            if ( values[ 0U ].isFixed )
+            {
+                // Decimals do not fit into any printf format either, they are printed without the trailing zeros
+                argument         = codegenFixedPointToString( ctx, argument );
+                printTypeID      = Registry::getStrHandle();
+                isNullTerminated = true;
+            }
+            else if ( Registry::isWide( printTypeID ) )
+            {
+                // Wider integers do not fit into any printf format, they are printed in their decimal representation
+                argument         = codegenWideToString( ctx, argument, Detail::isSigned( nodes[ 1U ] ) );
+                printTypeID      = Registry::getStrHandle();
+                isNullTerminated = true;
+            }
+            else if ( auto * type{ argument->getType() }; type->isIntegerTy() && type->getIntegerBitWidth() < sizeof( Number::Type ) * 8U )
+            {
+                // Results of comparisons and values of narrower types are printed as any other number
+                argument = Detail::convert
+                (
+                    ctx,
+                    argument,
+                    llvm::Type::getInt64Ty( *ctx.internalCtx ),
+                    !type->isIntegerTy( 1U ) && Detail::isSigned( nodes[ 1U ] )
+                );
+            }
 
-            arguments.insert( std::begin( arguments ), getPrintFormat( ctx, arguments[ 0U ]->getType() ) );
+            auto * format{ getPrintFormat( ctx, printTypeID, Detail::isSigned( nodes[ 1U ] ), isNullTerminated ) };
+            if ( printTypeID == Registry::getStrHandle() && !isNullTerminated )
+            {
+                auto * length{ ctx.builder->CreateTrunc( ctx.builder->CreateExtractValue( argument, 1U ), ctx.builder->getInt32Ty() ) };
+                return ctx.builder->CreateCall( externalBuiltInFunctions.at( name ), { format, length, ctx.builder->CreateExtractValue( argument, 0U ) } );
+            }
+            return ctx.builder->CreateCall( externalBuiltInFunctions.at( name ), { format, argument } );
+        }
 
-            return ctx.builder->CreateCall( externalBuiltInFunctions.at( name ), arguments );
+        // Built-in functions take integers, thus nums are passed truncated
+        std::vector< llvm::Value * > arguments;
+        for ( auto const & value : values )
+        {
+            arguments.push_back( Detail::toIntegral( ctx, value ) );
         }
-        else if ( auto it{ externalBuiltInFunctions.find( name ) }; it != std::end( externalBuiltInFunctions ) )
+
+        if ( auto it{ externalBuiltInFunctions.find( name ) }; it != std::end( externalBuiltInFunctions ) )
         {
             return ctx.builder->CreateCall( externalBuiltInFunctions.at( name ), arguments );
         }
@@ -169,7 +477,29 @@ llvm::Value * codegenCall( Context & ctx, std::span< AST::Node::Pointer const >
             return ctx.builder->CreateCall( internalBuiltInFunctions.at( name ), arguments );
         }
 
-        return ctx.builder->CreateCall( ctx.symbols.functions[ ctx.symbols.mangle( name ) ], arguments );
+        auto function{ ctx.symbols.functions[ ctx.symbols.mangle( name ) ] };
+        if ( auto const * functionType{ function.getFunctionType() }; functionType != nullptr )
+        {
+            for ( auto i{ 0U }; i < std::size( arguments ) && i < functionType->getNumParams(); i++ )
+            {
+                if ( auto const parameterTypeID{ getParameterTypeID( nodes[ 0U ], i ) }; isArray( parameterTypeID ) || isMap( parameterTypeID ) )
+                {
+                    arguments[ i ] = isArray( parameterTypeID ) ? codegenArrayReference( ctx, nodes[ i + 1U ] ) : codegenMapReference( ctx, nodes[ i + 1U ] );
+                    continue;
+                }
+
+                auto * type{ functionType->getParamType( i ) };
+                arguments[ i ] = Detail::convert
+                (
+                    ctx,
+                    values[ i ],
+                    type,
+                    Detail::isFixedPoint( getParameterTypeID( nodes[ 0U ], i ), type ),
+                    Detail::isSigned( nodes[ i + 1U ] )
+                );
+            }
+        }
+        return ctx.builder->CreateCall( function, arguments );
     }
 
     return nullptr;
@@ -177,37 +507,31 @@ llvm::Value * codegenCall( Context & ctx, std::span< AST::Node::Pointer const >
 
 llvm::Value * codegenMemberCall( Context & ctx, std::span< AST::Node::Pointer const > const nodes )
 {
-    ASSERTM( std::size( nodes ) == 2U, "Member call expression consists of two identifiers: variable and either data member or function member identifier" );
+    ASSERTM( std::size( nodes ) == 2U, "Member call expression consists of the object and either data member or function member identifier" );
 
-    ASSERTM( nodes[ 0U ]->is< Identifier >(), "Variable identifier is the first child node in the member call expression" );
-    auto const & variableName{ nodes[ 0U ]->get< Identifier >().name };
+    if ( isArray( nodes[ 0U ]->typeID() ) ) { return codegenArrayAppend( ctx, nodes ); }
 
-    auto * variable{ ctx.symbols.variable( variableName ) };
-
-    auto const contractTypeName
+    auto const & member{ nodes[ 1U ] };
+    if ( member->is< Identifier >() && isColumnIndex( nodes[ 0U ] ) )
     {
-        [ &contracts = ctx.symbols.contractTypes, type = variable->getType() ]() -> std::string
-        {
-            for ( auto const & contract : contracts )
-            {
-                if ( contract.second.internalType == type->getContainedType( 0U ) ) { return contract.first; }
-            }
-            return {};
-        }()
-    };
+        return codegenColumnLoad( ctx, *nodes[ 0U ], member->get< Identifier >().name );
+    }
 
-    auto const & member{ nodes[ 1U ] };
+    auto * variable{ codegenObject( ctx, nodes[ 0U ], false /* isWrite */ ) };
+    if ( variable == nullptr ) { return nullptr; }
+
+    auto const & contractTypeName{ getContractName( nodes[ 0U ] ) };
     if ( member->is< Identifier >() )
     {
-        auto const & dataMemberTypes{ ctx.symbols.contractTypes[ contractTypeName ].dataMemberTypes };
+        auto const & dataMember{ ctx.symbols.contractTypes[ contractTypeName ].dataMemberTypes.at( member->get< Identifier >().name ) };
 
         // Access data member
-        return ctx.builder->CreateStructGEP
-        (
-            variable->getType()->getContainedType( 0U ),
-            variable,
-            dataMemberTypes.at( member->get< Identifier >().name ).index
-        );
+        auto * pointer{ ctx.builder->CreateStructGEP( variable->getType()->getContainedType( 0U ), variable, dataMember.index ) };
+        if ( !dataMember.bit ) { return pointer; }
+
+        // Packed bool is read by value, as there is no pointer to a single bit
+        auto * byte{ ctx.builder->CreateLoad( dataMember.internalType, pointer ) };
+        return ctx.builder->CreateAnd( ctx.builder->CreateLShr( byte, *dataMember.bit ), 1U );
     }
     else if ( member->is< AST::NodeType >() && member->get< AST::NodeType >() == AST::NodeType::Call )
     {
@@ -219,23 +543,49 @@ llvm::Value * codegenMemberCall( Context & ctx, std::span< AST::Node::Pointer co
         ASSERTM( memberNodes[ 0U ]->is< Identifier >(), "Identifier is the first child node in the call expression" );
         auto const & name{ memberNodes[ 0U ]->get< Identifier >().name };
 
-        std::vector< llvm::Value * > arguments{ variable };
+        std::vector< NumericValue > values{ { variable, false } };
         for ( auto i{ 1U }; i < std::size( memberNodes ); i++ )
         {
-            auto * value{ codegen( ctx, memberNodes[ i ] ) };
-            if ( value == nullptr ) { return nullptr; }
-            arguments.push_back( value );
+            auto const value{ codegenNumeric( ctx, memberNodes[ i ] ) };
+            if ( value.value == nullptr ) { return nullptr; }
+            values.push_back( value );
+        }
+
+        std::vector< llvm::Value * > arguments;
+        for ( auto const & value : values ) { arguments.push_back( value.value ); }
+
+        auto function{ ctx.symbols.functions[ fmt::format( "{}__{}", contractTypeName, name ) ] };
+        if ( auto const * functionType{ function.getFunctionType() }; functionType != nullptr )
+        {
+            for ( auto i{ 1U }; i < std::size( arguments ) && i < functionType->getNumParams(); i++ )
+            {
+                if ( auto const parameterTypeID{ getParameterTypeID( memberNodes[ 0U ], i ) }; isArray( parameterTypeID ) || isMap( parameterTypeID ) )
+                {
+                    arguments[ i ] = isArray( parameterTypeID ) ? codegenArrayReference( ctx, memberNodes[ i ] ) : codegenMapReference( ctx, memberNodes[ i ] );
+                    continue;
+                }
+
+                auto * type{ functionType->getParamType( i ) };
+                arguments[ i ] = Detail::convert
+                (
+                    ctx,
+                    values[ i ],
+                    type,
+                    Detail::isFixedPoint( getParameterTypeID( memberNodes[ 0U ], i ), type ),
+                    Detail::isSigned( memberNodes[ i ] )
+                );
+            }
         }
 
         return memberNodes.size() == 1U
-            ? ctx.builder->CreateCall( ctx.symbols.functions[ fmt::format( "{}__{}", contractTypeName, name ) ], llvm::None )
-            : ctx.builder->CreateCall( ctx.symbols.functions[ fmt::format( "{}__{}", contractTypeName, name ) ], arguments  );
+            ? ctx.builder->CreateCall( function, llvm::None )
+            : ctx.builder->CreateCall( function, arguments  );
     }
 
     return nullptr;
 }
 
-llvm::Value * codegenContractDefinition( Context & ctx, std::span< AST::Node::Pointer const > const nodes )
+llvm::Value * codegenContractDefinition( Context & ctx, std::span< AST::Node::Pointer const > const nodes, bool const isClass )
 {
     ASSERTM( std::size( nodes ) >= 2U, "Contract definition consists of an identifier and one or more statements in the contract's body" );
 
@@ -244,14 +594,18 @@ llvm::Value * codegenContractDefinition( Context & ctx, std::span< AST::Node::Po
 
     auto * contractType{ llvm::StructType::create( *ctx.internalCtx, contractName ) };
 
-    std::vector< llvm::Constant * > dataMemberInitialValues;
-    std::vector< llvm::Type     * > dataMemberTypes;
-
-    Symbols::Table< Symbols::DataMemberType > dataMembers;
-
     ctx.symbols.currentContractName = contractName;
 
-    std::size_t dataMemberIndex{ 0U };
+    struct DataMember
+    {
+        std::string_view   name;
+        llvm::Type       * type        { nullptr };
+        llvm::Constant   * initialValue{ nullptr };
+    };
+
+    std::vector< DataMember       > dataMembers;
+    std::vector< std::string_view > boolDataMembers;
+    std::vector< bool             > boolInitialValues;
 
     for ( auto i{ 1U }; i < std::size( nodes ); i++ )
     {
@@ -266,41 +620,87 @@ llvm::Value * codegenContractDefinition( Context & ctx, std::span< AST::Node::Po
                 ASSERTM( children[ 0U ]->is< Identifier >(), "Data member identifier is the first child node in the definition" );
                 ASSERTM( children[ 1U ]->is< TypeID     >(), "Data member type is the second child node in the definition" );
 
-                auto const typeID{ children[ 1U ]->get< TypeID >() };
-                dataMemberTypes.push_back( getType( ctx, typeID ) );
+                auto const   name    { std::string_view{ children[ 0U ]->get< Identifier >().name } };
+                auto const   typeID  { children[ 1U ]->get< TypeID >() };
+                auto const * initNode{ std::size( children ) > 2U ? children[ 2U ].get() : nullptr };
 
-                if ( std::size( children ) > 2U )
+                if ( typeID == Registry::getBoolHandle() )
                 {
-                    auto const & initNode{ children[ 2U ] };
-                    if ( initNode->is< Number >() )
-                    {
-                        dataMemberInitialValues.push_back( llvm::ConstantInt::get( llvm::Type::getInt64Ty( *ctx.internalCtx ), initNode->get< Number >().value, true /* isSigned */ ) );
-                    }
-                    else if ( initNode->is< StringLiteral >() )
-                    {
-                        dataMemberInitialValues.push_back( ctx.builder->CreateGlobalStringPtr( initNode->get< StringLiteral >().value, "", 0U, ctx.module_.get() ) );
-                    }
+                    boolDataMembers  .push_back( name );
+                    boolInitialValues.push_back( initNode != nullptr && initNode->is< AST::Boolean >() && initNode->get< AST::Boolean >() );
+                    continue;
                 }
-                else
-                {
-                    if ( typeID == Registry::getNumHandle() )
-                    {
-                        dataMemberInitialValues.push_back( llvm::ConstantInt::get( llvm::Type::getInt64Ty( *ctx.internalCtx ), 0U, true /* isSigned */ ) );
-                    }
-                    else if ( typeID == Registry::getStrHandle() )
+
+                auto * type{ getType( ctx, typeID ) };
+                ASSERTM( type != nullptr, "Data member type is known at the point of the contract definition" );
+
+                dataMembers.push_back
+                (
                     {
-                        dataMemberInitialValues.push_back( ctx.builder->CreateGlobalStringPtr( "", "", 0U, ctx.module_.get() ) );
+                        .name         = name,
+                        .type         = type,
+                        .initialValue = getInitialValue( ctx, typeID, type, initNode )
                     }
-                }
+                );
+            }
+        }
+    }
 
-                dataMembers[ children[ 0U ]->get< Identifier >().name ] =
-                {
-                    .internalType = dataMemberTypes[ dataMemberIndex ],
-                    .index        = dataMemberIndex++
-                };
+    /**
+     * Contract state is laid out to minimize padding, i.e. data members are ordered
+     * from the largest to the smallest, with bools packed into the trailing bytes.
+     */
+    auto const & dataLayout{ ctx.module_->getDataLayout() };
+    std::stable_sort
+    (
+        std::begin( dataMembers ),
+        std::end  ( dataMembers ),
+        [ &dataLayout ]( DataMember const & lhs, DataMember const & rhs )
+        {
+            return dataLayout.getTypeAllocSize( lhs.type ) > dataLayout.getTypeAllocSize( rhs.type );
+        }
+    );
 
-                // codegen( ctx, node );
-            }
+    std::vector< llvm::Type     * > dataMemberTypes;
+    std::vector< llvm::Constant * > dataMemberInitialValues;
+
+    Symbols::Table< Symbols::DataMemberType > dataMemberSymbols;
+
+    for ( auto const & dataMember : dataMembers )
+    {
+        dataMemberSymbols[ std::string{ dataMember.name } ] =
+        {
+            .internalType = dataMember.type,
+            .index        = std::size( dataMemberTypes ),
+            .bit          = std::nullopt
+        };
+        dataMemberTypes        .push_back( dataMember.type         );
+        dataMemberInitialValues.push_back( dataMember.initialValue );
+    }
+
+    static constexpr auto bitsPerByte{ 8U };
+
+    auto * byteType{ llvm::Type::getInt8Ty( *ctx.internalCtx ) };
+    for ( std::size_t i{ 0U }; i < std::size( boolDataMembers ); i++ )
+    {
+        auto const bit{ static_cast< std::uint8_t >( i % bitsPerByte ) };
+        if ( bit == 0U )
+        {
+            dataMemberTypes        .push_back( byteType );
+            dataMemberInitialValues.push_back( llvm::ConstantInt::get( byteType, 0U ) );
+        }
+
+        dataMemberSymbols[ std::string{ boolDataMembers[ i ] } ] =
+        {
+            .internalType = byteType,
+            .index        = std::size( dataMemberTypes ) - 1U,
+            .bit          = bit
+        };
+
+        if ( boolInitialValues[ i ] )
+        {
+            auto * & byte{ dataMemberInitialValues.back() };
+            byte = llvm::ConstantInt::get( byteType, llvm::cast< llvm::ConstantInt >( byte )->getZExtValue() | ( 1U << bit ) );
         }
     }
 
@@ -308,7 +708,8 @@ llvm::Value * codegenContractDefinition( Context & ctx, std::span< AST::Node::Po
     ctx.symbols.contractTypes[ contractName ] =
     {
         .internalType    = contractType,
-        .dataMemberTypes = std::move( dataMembers )
+        .dataMemberTypes = std::move( dataMemberSymbols ),
+        .isClass         = isClass
     };
 
     for ( auto i{ 1U }; i < std::size( nodes ); i++ )
@@ -328,15 +729,29 @@ llvm::Value * codegenContractDefinition( Context & ctx, std::span< AST::Node::Po
         // Create default constructor if there is no user-defined constructor
         auto   ctorName{ fmt::format( "{}____default_init__", contractName ) };
         auto * ctorType{ llvm::FunctionType::get( contractType, false ) };
-        auto * ctor    { llvm::Function::Create( ctorType, llvm::Function::ExternalLinkage, ctorName, ctx.module_.get() ) };
-        auto * block   { llvm::BasicBlock::Create( *ctx.internalCtx, "", ctor ) };
-        ctx.builder->SetInsertPoint( block );
+        auto * ctor
+        {
+            llvm::Function::Create
+            (
+                ctorType,
+                isClass ? llvm::Function::InternalLinkage : llvm::Function::ExternalLinkage,
+                ctorName,
+                ctx.module_.get()
+            )
+        };
 
-        auto * alloca{ ctx.builder->CreateAlloca( contractType, 0U ) };
-        ctx.builder->CreateStore( llvm::ConstantStruct::get( contractType, dataMemberInitialValues ), alloca );
-        ctx.builder->CreateRet( ctx.builder->CreateLoad( contractType, alloca ) );
+        if ( !ctx.declarationsOnly )
+        {
+            auto * block{ llvm::BasicBlock::Create( *ctx.internalCtx, "", ctor ) };
+            ctx.builder->SetInsertPoint( block );
+
+            auto * alloca{ ctx.builder->CreateAlloca( contractType, 0U ) };
+            ctx.builder->CreateStore( llvm::ConstantStruct::get( contractType, dataMemberInitialValues ), alloca );
+            ctx.builder->CreateRet( ctx.builder->CreateLoad( contractType, alloca ) );
+        }
 
         ctx.symbols.functions[ ctorName ] = ctor;
+        if ( !isClass ) { ctx.exportedFunctions.insert( ctorName ); }
     }
 
     /**
@@ -363,9 +778,11 @@ llvm::Function * codegenFunctionDefinition( Context & ctx, std::span< AST::Node:
     auto const & functionName{ nodes[ 0U ]->get< Identifier >().name };
 
     std::vector< std::string > parameterNames;
+    std::vector< TypeID      > parameterTypeIDs;
     std::vector< llvm::Type * > parameters;
 
-    llvm::Type * returnType{ llvm::Type::getVoidTy( *ctx.internalCtx ) };
+    llvm::Type * returnType  { llvm::Type::getVoidTy( *ctx.internalCtx ) };
+    TypeID       returnTypeID{ nullptr };
 
     ctx.symbols.currentFunctionName = functionName;
 
@@ -386,7 +803,12 @@ llvm::Function * codegenFunctionDefinition( Context & ctx, std::span< AST::Node:
                     parameterNames.push_back( ctx.symbols.mangle( parameterNodes[ 0U ]->get< Identifier >().name ) );
 
                     ASSERTM( parameterNodes[ 1U ]->is< TypeID >(), "Function parameter type annotation is the second child node in the function parameter definition" );
-                    parameters.push_back( getType( ctx, parameterNodes[ 1U ]->get< TypeID >() ) );
+                    auto const parameterTypeID{ parameterNodes[ 1U ]->get< TypeID >() };
+                    parameterTypeIDs.push_back( parameterTypeID );
+
+                    // Arrays and maps are passed by reference, so that the callee appending or inserting updates the handle
+                    auto * parameterType{ getType( ctx, parameterTypeID ) };
+                    parameters.push_back( isArray( parameterTypeID ) || isMap( parameterTypeID ) ? parameterType->getPointerTo() : parameterType );
                 }
                 else if ( std::size( parameterNodes ) == 1U )
                 {
@@ -398,19 +820,39 @@ llvm::Function * codegenFunctionDefinition( Context & ctx, std::span< AST::Node:
                         // TODO: Throw an error here. Only 'self' parameter is allowed not to have the type specified.
                     }
 
+                    parameterTypeIDs.push_back( nullptr );
                     parameters.push_back( llvm::PointerType::get( ctx.symbols.contractTypes[ ctx.symbols.currentContractName ].internalType, 0U ) );
                 }
             }
         }
         else if ( node->is< TypeID >() )
         {
-            returnType = getType( ctx, node->get< TypeID >() );
+            returnTypeID = node->get< TypeID >();
+            returnType   = getType( ctx, returnTypeID );
             break;
         }
     }
 
+    // Class methods are lowered into every unit which may call them, thus are local to the unit
+    auto const isMethod{ !ctx.symbols.currentContractName.empty() };
+    auto const isClass { isMethod && ctx.symbols.contractTypes[ ctx.symbols.currentContractName ].isClass };
+
     auto * functionType{ llvm::FunctionType::get( returnType, parameters, false ) };
-    auto * function    { llvm::Function::Create( functionType, llvm::Function::ExternalLinkage, functionName, ctx.module_.get() ) };
+    auto * function
+    {
+        llvm::Function::Create
+        (
+            functionType,
+            isClass ? llvm::Function::InternalLinkage : llvm::Function::ExternalLinkage,
+            functionName,
+            ctx.module_.get()
+        )
+    };
+
+    if ( !isClass )
+    {
+        ctx.exportedFunctions.insert( functionName );
+    }
 
     // Set names for all the arguments
     auto idx{ 0U };
@@ -419,16 +861,34 @@ llvm::Function * codegenFunctionDefinition( Context & ctx, std::span< AST::Node:
         arg.setName( parameterNames[ idx++ ] );
     }
 
+    if ( ctx.declarationsOnly )
+    {
+        // Body of the function is lowered by the unit which defines it
+        ctx.symbols.currentFunctionName.clear();
+        ctx.symbols.functions[ ctx.symbols.mangle( functionName ) ] = function;
+        return function;
+    }
+
     auto * block{ llvm::BasicBlock::Create( *ctx.internalCtx, "", function ) };
     ctx.builder->SetInsertPoint( block );
 
     for ( auto & arg : function->args() )
     {
         /**
-         * Since we do not support mutable function arguments,
-         * we don't need to create alloca for each argument.
+         * Parameters are assignable as the local variables are, thus their values are spilled into the stack
+         * slots, which the optimizer promotes back to the registers. 'self', the instances, the arrays and the maps
+         * are passed by their pointers, which are never reassigned, writing to their members goes through the pointers.
          */
-        ctx.symbols.variables[ std::string{ arg.getName() }] = &arg;
+        auto const typeID{ parameterTypeIDs[ arg.getArgNo() ] };
+        if ( typeID == nullptr || isArray( typeID ) || isMap( typeID ) || Detail::isInstance( typeID ) )
+        {
+            ctx.symbols.variables[ parameterNames[ arg.getArgNo() ] ] = &arg;
+            continue;
+        }
+
+        auto * slot{ ctx.builder->CreateAlloca( arg.getType(), 0U, arg.getName() + ".addr" ) };
+        ctx.builder->CreateStore( &arg, slot );
+        ctx.symbols.variables[ parameterNames[ arg.getArgNo() ] ] = slot;
     }
 
     /**
@@ -441,9 +901,13 @@ llvm::Function * codegenFunctionDefinition( Context & ctx, std::span< AST::Node:
         {
             if ( node->get< AST::NodeType >() == AST::NodeType::StatementReturn )
             {
-                if ( auto * return_{ codegen( ctx, node ) } )
+                auto const & returnNode{ node->children()[ 0U ] };
+                if ( auto const return_{ codegenNumeric( ctx, returnNode ) }; return_.value != nullptr )
                 {
-                    ctx.builder->CreateRet( return_ );
+                    ctx.builder->CreateRet
+                    (
+                        Detail::convert( ctx, return_, returnType, Detail::isFixedPoint( returnTypeID, returnType ), Detail::isSigned( returnNode ) )
+                    );
                 }
             }
             else if ( node->get< AST::NodeType >() == AST::NodeType::VariableDefinition )
@@ -499,36 +963,70 @@ llvm::Value * codegenVariableDefinition( Context & ctx, std::span< AST::Node::Po
     /**
      * If there is only initialization node or if there are both type annotation and
      * initialization nodes, create new value from initialization node.
-     * TODO: Check if type annotation and initialization match.
+     * Numeric variables are stored with the width of the annotated or inferred type.
      *
      * If there is only type annotation node, create new value from the default value of
      * the specified type.
      */
-    auto const & node{ std::size( nodes ) <= 2U ? nodes[ 1U ] : nodes[ 2U ] };
+    auto const & initNode{ std::size( nodes ) > 2U ? nodes[ 2U ] : nodes[ 1U ] };
+    auto const   typeID
+    {
+        [ &nodes ]() -> TypeID
+        {
+            if ( nodes[ 1U ]->is< TypeID >() ) { return nodes[ 1U ]->get< TypeID >(); }
+
+            // Unannotated integer variable may be narrowed by the width inference, otherwise it is num
+            auto const inferredTypeID{ nodes[ 0U ]->typeID() };
+            return Registry::isNumeric( inferredTypeID ) ? inferredTypeID : nullptr;
+        }()
+    };
 
     llvm::Value * value{ nullptr };
 
-    if ( node->is< TypeID >() )
+    if ( Registry::isNumeric( typeID ) )
     {
-        auto const typeID{ node->get< TypeID >() };
-        if ( typeID == Registry::getNumHandle() )
+        auto * type{ getType( ctx, typeID ) };
+
+        llvm::Value * initialValue{ llvm::ConstantInt::get( type, 0U ) };
+        if ( initNode->is_not< TypeID >() )
         {
-            value = inScopeBuilder.CreateAlloca( llvm::Type::getInt64Ty( *ctx.internalCtx ), 0U, name.data() );
-            inScopeBuilder.CreateStore( llvm::ConstantInt::get( llvm::Type::getInt64Ty( *ctx.internalCtx ), 0U, true /* isSigned */ ), value );
+            auto const init{ codegenNumeric( ctx, initNode ) };
+            if ( init.value == nullptr ) { return nullptr; }
+            initialValue = Detail::convert( ctx, init, type, Detail::isFixedPoint( typeID, type ), Detail::isSigned( initNode ) );
         }
-        else if ( typeID == Registry::getStrHandle() )
+
+        value = inScopeBuilder.CreateAlloca( type, 0U, name.data() );
+        ctx.builder->CreateStore( initialValue, value );
+    }
+    else if ( ( typeID != nullptr ? typeID : nodes[ 0U ]->typeID() ) == Registry::getStrHandle() )
+    {
+        // Variable holds the view, thus assigning the slice to it copies no bytes
+        auto * type{ getStrType( ctx ) };
+
+        llvm::Value * initialValue{ llvm::Constant::getNullValue( type ) };
+        if ( initNode->is_not< TypeID >() )
         {
-            value = ctx.builder->CreateGlobalStringPtr( "", "", 0U, ctx.module_.get() );
+            initialValue = codegen( ctx, initNode );
+            if ( initialValue == nullptr ) { return nullptr; }
+            initialValue = Detail::load( ctx, initialValue );
         }
+
+        value = inScopeBuilder.CreateAlloca( type, 0U, name.data() );
+        ctx.builder->CreateStore( initialValue, value );
     }
-    else if ( node->is< Number >() )
+    else if ( initNode->is< TypeID >() )
     {
-        value = inScopeBuilder.CreateAlloca( llvm::Type::getInt64Ty( *ctx.internalCtx ), 0U, name.data() );
-        inScopeBuilder.CreateStore( codegen( ctx, node ), value );
+        if ( std::holds_alternative< MapType >( *typeID ) || std::holds_alternative< ArrayType >( *typeID ) )
+        {
+            // Map and array are empty until the first insertion creates them
+            auto * type{ getType( ctx, typeID ) };
+            value = inScopeBuilder.CreateAlloca( type, 0U, name.data() );
+            ctx.builder->CreateStore( llvm::Constant::getNullValue( type ), value );
+        }
     }
     else
     {
-        value = codegen( ctx, node );
+        value = codegen( ctx, initNode );
     }
 
     ctx.symbols.variable( name, value );
@@ -627,9 +1125,9 @@ llvm::Value * codegenControlFlow( Context & ctx, std::span< AST::Node::Pointer c
     parent->getBasicBlockList().push_back( endBlock );
     ctx.builder->SetInsertPoint( endBlock );
 
-    if ( hasElifElseBlock )
+    // Branches of the statement may end with the values of different types, e.g. assignments to a string and a number
+    if ( hasElifElseBlock && then->getType() == elifOrElse->getType() )
     {
-        ASSERT( then->getType() == elifOrElse->getType() );
         auto * phi{ ctx.builder->CreatePHI( then->getType(), hasElifElseBlock ? 2U : 1U, "iftmp" ) };
         phi->addIncoming( then      , thenBlock );
         phi->addIncoming( elifOrElse, elseBlock );
@@ -8,9 +8,12 @@
 #pragma once
 
 #include "../Context.hpp"
+#include "CodegenFixedPoint.hpp"
+#include "CodegenString.hpp"
 #include "CodegenVisitor.hpp"
 
 #include <CoreLib/AST/ASTNode.hpp>
+#include <CoreLib/Types.hpp>
 #include <CoreLib/Utils/Macros.hpp>
 
 #if defined (__clang__)
@@ -23,6 +26,7 @@
 
 #include <llvm/IR/DerivedTypes.h>
 #include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Operator.h>
 #include <llvm/IR/Value.h>
 
 #if defined(__clang__)
@@ -31,6 +35,8 @@
 #   pragma GCC diagnostic pop
 #endif
 
+#include <algorithm>
+#include <cstdint>
 #include <string_view>
 #include <span>
 
@@ -39,48 +45,269 @@ namespace A1::LLVM::IR
 
 namespace Detail
 {
+    /** Contract and class instances are accessed by their pointers, rather than loaded. */
+    [[ nodiscard ]]
+    inline bool isInstance( TypeID const typeID ) noexcept
+    {
+        return typeID != nullptr && std::holds_alternative< ContractType >( *typeID );
+    }
+
     [[ nodiscard  ]]
     inline llvm::Value * load( Context & ctx, llvm::Value * value ) noexcept
     {
+        auto * type{ value->getType() };
+        if ( !type->isPointerTy() || type->getNumContainedTypes() == 0U ) { return value; }
+
+        auto * pointeeType{ type->getContainedType( 0U ) };
         if
         (
-            value->getType()->getNumContainedTypes() > 0U &&
-            value->getType()->getContainedType( 0U )->isIntegerTy( sizeof( Number::Type ) * 8U )
+            pointeeType->isPointerTy() ||
+            pointeeType == getStrType( ctx ) ||
+            pointeeType->isIntegerTy( sizeof( Number::Type ) * 8U ) ||
+            (
+                pointeeType->isIntegerTy() &&
+                ( llvm::isa< llvm::AllocaInst >( value ) || llvm::isa< llvm::GEPOperator >( value ) )
+            )
         )
         {
-            return ctx.builder->CreateLoad( llvm::Type::getInt64Ty( *ctx.internalCtx ), value );
+            return ctx.builder->CreateLoad( pointeeType, value );
         }
-        else if
-        (
-            value->getType()->isPointerTy() &&
-            value->getType()->getNumContainedTypes() > 0U &&
-            value->getType()->getContainedType( 0U )->isPointerTy()
-        )
+        return value;
+    }
+
+    /** Values of unknown type are treated as num, which is signed. */
+    [[ nodiscard ]]
+    inline bool isSigned( AST::Node::Pointer const & node ) noexcept
+    {
+        return node == nullptr || node->typeID() == nullptr || Registry::isSigned( node->typeID() );
+    }
+
+    /**
+     * Mirrors the semantic analysis, where operands of the same sized integer type keep their type,
+     * operation involving 256-bit integer results in its type and any other combination of operands results in num.
+     */
+    [[ nodiscard ]]
+    inline bool isSignedOperation( std::span< AST::Node::Pointer const > const nodes ) noexcept
+    {
+        for ( auto const & node : nodes )
+        {
+            if ( node != nullptr && Registry::isWide( node->typeID() ) ) { return isSigned( node ); }
+        }
+
+        if ( std::size( nodes ) == 2U && nodes[ 0U ]->typeID() != nodes[ 1U ]->typeID() ) { return true; }
+        return isSigned( nodes[ 0U ] );
+    }
+
+    /**
+     * Mirrors the semantic analysis as well, operation results in num unless its operands are of the same
+     * sized integer type or one of them is a 256-bit integer. Operation on values of unknown type is not one on nums.
+     */
+    [[ nodiscard ]]
+    inline bool isNumOperation( std::span< AST::Node::Pointer const > const nodes ) noexcept
+    {
+        for ( auto const & node : nodes )
+        {
+            if ( node->typeID() == nullptr || Registry::isWide( node->typeID() ) ) { return false; }
+        }
+
+        auto const typeID{ nodes[ 0U ]->typeID() };
+        return
+            typeID == Registry::getNumHandle () ||
+            typeID == Registry::getBoolHandle() ||
+            ( std::size( nodes ) == 2U && nodes[ 1U ]->typeID() != typeID );
+    }
+
+    /** num values of the full width are fixed-point, as opposed to the num variables of the inferred width. */
+    [[ nodiscard ]]
+    inline bool isFixedPoint( TypeID const typeID, llvm::Type const * type ) noexcept
+    {
+        return typeID == Registry::getNumHandle() && type->isIntegerTy( sizeof( Number::Type ) * 8U );
+    }
+
+    [[ nodiscard ]]
+    inline bool isFixedPoint( AST::Node::Pointer const & node, llvm::Value const * value ) noexcept
+    {
+        if ( node->is< Number >() ) { return node->get< Number >().decimals != 0U; }
+        return isFixedPoint( node->typeID(), value->getType() );
+    }
+
+    /** Scaling of the fixed-point operands required by the operation. */
+    enum class Scaling : std::uint8_t
+    {
+        Common,    // Operands are of the same scale, e.g. in addition or comparison
+        Product,   // Product of two decimals is rescaled
+        Quotient,  // Quotient is a decimal, even the quotient of two integers
+        Truncated, // Quotient of the floor division is an integer
+        Integral,  // Bitwise operations are applied to the integral part
+        None       // Logical operations only test for zero
+    };
+
+    [[ nodiscard ]]
+    constexpr Scaling getScaling( AST::NodeType const type ) noexcept
+    {
+        switch ( type )
         {
-            return ctx.builder->CreateLoad( value->getType()->getContainedType( 0U ), value );
+            case AST::NodeType::Multiplication:
+            case AST::NodeType::AssignMultiplication:
+                return Scaling::Product;
+
+            case AST::NodeType::Division:
+            case AST::NodeType::AssignDivision:
+                return Scaling::Quotient;
+
+            case AST::NodeType::FloorDivision:
+            case AST::NodeType::AssignFloorDivision:
+                return Scaling::Truncated;
+
+            case AST::NodeType::BitwiseLeftShift:
+            case AST::NodeType::BitwiseRightShift:
+            case AST::NodeType::BitwiseAnd:
+            case AST::NodeType::BitwiseOr:
+            case AST::NodeType::BitwiseXor:
+            case AST::NodeType::BitwiseNot:
+            case AST::NodeType::AssignBitwiseLeftShift:
+            case AST::NodeType::AssignBitwiseRightShift:
+            case AST::NodeType::AssignBitwiseAnd:
+            case AST::NodeType::AssignBitwiseOr:
+            case AST::NodeType::AssignBitwiseXor:
+                return Scaling::Integral;
+
+            case AST::NodeType::LogicalNot:
+            case AST::NodeType::LogicalAnd:
+            case AST::NodeType::LogicalOr:
+                return Scaling::None;
+
+            default:
+                return Scaling::Common;
+        }
+    }
+
+    /** Truncates or extends integer value to the given type, any other value is returned as is. */
+    [[ nodiscard ]]
+    inline llvm::Value * convert( Context & ctx, llvm::Value * value, llvm::Type * type, bool const isSigned )
+    {
+        if ( value->getType() != type && value->getType()->isIntegerTy() && type->isIntegerTy() )
+        {
+            return ctx.builder->CreateIntCast( value, type, isSigned );
         }
         return value;
     }
+
+    /**
+     * Extends integer operands to the width of the operation. As in the semantic analysis,
+     * operation on operands of the same sized integer type keeps their width, any other
+     * operation is performed on num, e.g. operation on the variables of the inferred width.
+     */
+    inline void unify( Context & ctx, std::span< AST::Node::Pointer const > const nodes, llvm::Value * & lhs, llvm::Value * & rhs )
+    {
+        auto * lhsType{ lhs->getType() };
+        auto * rhsType{ rhs->getType() };
+        if ( !lhsType->isIntegerTy() || !rhsType->isIntegerTy() ) { return; }
+
+        auto const isNum{ []( AST::Node::Pointer const & node ) { return node->typeID() == nullptr || node->typeID() == Registry::getNumHandle(); } };
+
+        auto bitWidth{ std::max( lhsType->getIntegerBitWidth(), rhsType->getIntegerBitWidth() ) };
+        if ( isNum( nodes[ 0U ] ) || isNum( nodes[ 1U ] ) )
+        {
+            bitWidth = std::max( bitWidth, static_cast< unsigned >( sizeof( Number::Type ) * 8U ) );
+        }
+
+        auto * type{ llvm::Type::getIntNTy( ctx.builder->getContext(), bitWidth ) };
+        lhs = convert( ctx, lhs, type, isSigned( nodes[ 0U ] ) );
+        rhs = convert( ctx, rhs, type, isSigned( nodes[ 1U ] ) );
+    }
+
+    /** Truncates num to its integral part, any other value is returned as is. */
+    [[ nodiscard ]]
+    inline llvm::Value * toIntegral( Context & ctx, NumericValue const value )
+    {
+        return value.isFixed ? codegenFromFixedPoint( ctx, value.value ) : value.value;
+    }
+
+    /**
+     * Converts the numeric value to the given type, which is either fixed-point num
+     * or an integer, any non-integer value is returned as is.
+     */
+    [[ nodiscard ]]
+    inline llvm::Value * convert( Context & ctx, NumericValue const value, llvm::Type * type, bool const isFixed, bool const isSigned )
+    {
+        if ( !value.value->getType()->isIntegerTy() || !type->isIntegerTy() ) { return value.value; }
+
+        if ( value.isFixed && !isFixed ) { return convert( ctx, codegenFromFixedPoint( ctx, value.value ), type, true /* isSigned */ ); }
+        if ( !value.isFixed && isFixed )
+        {
+            return codegenToFixedPoint( ctx, convert( ctx, value.value, type, isSigned && !value.value->getType()->isIntegerTy( 1U ) ) );
+        }
+        return convert( ctx, value.value, type, isSigned );
+    }
+
+    /**
+     * Brings the operands of the operation on nums to their common scale, if the operation requires it.
+     * Operands are of the num width at this point. Returns whether the result is fixed-point.
+     */
+    inline bool rescale( Context & ctx, Scaling const scaling, NumericValue & lhs, NumericValue & rhs )
+    {
+        switch ( scaling )
+        {
+            case Scaling::Common:
+            case Scaling::Truncated:
+            {
+                if      (  lhs.isFixed && !rhs.isFixed ) { rhs = { codegenToFixedPoint( ctx, rhs.value ), true }; }
+                else if ( !lhs.isFixed &&  rhs.isFixed ) { lhs = { codegenToFixedPoint( ctx, lhs.value ), true }; }
+                return scaling == Scaling::Common && lhs.isFixed;
+            }
+            case Scaling::Product : return lhs.isFixed || rhs.isFixed;
+            case Scaling::Quotient: return true;
+            case Scaling::Integral:
+            {
+                lhs = { toIntegral( ctx, lhs ), false };
+                rhs = { toIntegral( ctx, rhs ), false };
+                return false;
+            }
+            case Scaling::None:
+                break;
+        }
+        return false;
+    }
 } // namespace Detail
 
+/** Lowers the type to its LLVM type, null if the type cannot be lowered (yet). */
+[[ nodiscard ]] llvm::Type * getType( Context & ctx, TypeID const typeID );
+
+/**
+ * Lowers the type of the value stored inline in the array or the map. Contract and class
+ * instances are stored by value, i.e. as their structures, rather than as the pointers.
+ */
+[[ nodiscard ]] llvm::Type * getStorageType( Context & ctx, TypeID const typeID );
+
+/**
+ * Stores the value into the target expression, i.e. variable or data member, converting
+ * it to the type of the target. Returns the target for further use in the expression.
+ */
+[[ nodiscard ]] llvm::Value * codegenStore( Context & ctx, AST::Node::Pointer const & target, NumericValue const value, bool const isSigned );
+
 template< typename ... T >
 using IRBuilderUnaryClbk = llvm::Value * ( llvm::IRBuilderBase::* )( llvm::Value *, llvm::Twine const &, T ... );
 
 template< typename ... T >
 [[ nodiscard ]]
-llvm::Value * codegenUnary
+NumericValue codegenUnary
 (
     Context                                     & ctx,
+    AST::NodeType                         const   type,
     IRBuilderUnaryClbk< T ... >           const   clbk,
     std::span< AST::Node::Pointer const > const   nodes,
     std::string_view                      const   opName
 )
 {
     ASSERT( std::size( nodes ) == 1U );
-    auto * lhs{ codegen( ctx, nodes[ 0U ] ) };
+    auto operand{ codegenNumeric( ctx, nodes[ 0U ] ) };
+    if ( operand.value == nullptr ) { return {}; }
 
-    if ( lhs == nullptr ) { return nullptr; }
-    return ( *( ctx.builder ).*clbk )( Detail::load( ctx, lhs ), opName, T{} ... );
+    auto const scaling{ Detail::getScaling( type ) };
+    if ( scaling == Detail::Scaling::Integral ) { operand = { Detail::toIntegral( ctx, operand ), false }; }
+
+    return { ( *( ctx.builder ).*clbk )( operand.value, opName, T{} ... ), operand.isFixed && scaling == Detail::Scaling::Common };
 }
 
 template< typename ... T >
@@ -88,20 +315,73 @@ using IRBuilderBinaryClbk = llvm::Value * ( llvm::IRBuilderBase::* )( llvm::Valu
 
 template< typename ... T >
 [[ nodiscard ]]
-llvm::Value * codegenBinary
+NumericValue codegenBinary
 (
     Context                                     & ctx,
+    AST::NodeType                         const   type,
     IRBuilderBinaryClbk< T ... >          const   clbk,
     std::span< AST::Node::Pointer const > const   nodes,
     std::string_view                      const   opName
 )
 {
     ASSERT( std::size( nodes ) == 2U );
-    auto * lhs{ codegen( ctx, nodes[ 0U ] ) };
-    auto * rhs{ codegen( ctx, nodes[ 1U ] ) };
+    auto lhs{ codegenNumeric( ctx, nodes[ 0U ] ) };
+    auto rhs{ codegenNumeric( ctx, nodes[ 1U ] ) };
+
+    if ( lhs.value == nullptr || rhs.value == nullptr ) { return {}; }
+
+    auto const scaling{ Detail::getScaling( type ) };
+    if ( scaling == Detail::Scaling::None )
+    {
+        Detail::unify( ctx, nodes, lhs.value, rhs.value );
+        return { ( *( ctx.builder ).*clbk )( lhs.value, rhs.value, opName, T{} ... ), false };
+    }
+
+    if ( !Detail::isNumOperation( nodes ) )
+    {
+        // Sized integers are operated on as integers, thus nums are truncated to them
+        auto * lhsValue{ Detail::toIntegral( ctx, lhs ) };
+        auto * rhsValue{ Detail::toIntegral( ctx, rhs ) };
+        Detail::unify( ctx, nodes, lhsValue, rhsValue );
+        return { ( *( ctx.builder ).*clbk )( lhsValue, rhsValue, opName, T{} ... ), false };
+    }
+
+    Detail::unify( ctx, nodes, lhs.value, rhs.value );
+    auto const isFixed{ Detail::rescale( ctx, scaling, lhs, rhs ) };
 
-    if ( lhs == nullptr || rhs == nullptr ) { return nullptr; }
-    return ( *( ctx.builder ).*clbk )( Detail::load( ctx, lhs ), Detail::load( ctx, rhs ), opName, T{} ... );
+    if ( scaling == Detail::Scaling::Product && lhs.isFixed && rhs.isFixed )
+    {
+        return { codegenFixedPointMultiplication( ctx, lhs.value, rhs.value ), true };
+    }
+    else if ( scaling == Detail::Scaling::Quotient )
+    {
+        // Integer dividend is scaled, so that the quotient of the integer divisor is num
+        if ( !lhs.isFixed ) { lhs = { codegenToFixedPoint( ctx, lhs.value ), true }; }
+        if (  rhs.isFixed ) { return { codegenFixedPointDivision( ctx, lhs.value, rhs.value ), true }; }
+    }
+
+    // Comparison of nums results in bool
+    auto * result{ ( *( ctx.builder ).*clbk )( lhs.value, rhs.value, opName, T{} ... ) };
+    return { result, isFixed && !result->getType()->isIntegerTy( 1U ) };
+}
+
+/**
+ * Operations which differ for signed and unsigned integers, e.g. division
+ * or comparison, are chosen according to the type of the operands.
+ */
+template< typename ... T >
+[[ nodiscard ]]
+NumericValue codegenBinary
+(
+    Context                                     & ctx,
+    AST::NodeType                         const   type,
+    IRBuilderBinaryClbk< T ... >          const   signedClbk,
+    IRBuilderBinaryClbk< T ... >          const   unsignedClbk,
+    std::span< AST::Node::Pointer const > const   nodes,
+    std::string_view                      const   opName
+)
+{
+    return codegenBinary( ctx, type, Detail::isSignedOperation( nodes ) ? signedClbk : unsignedClbk, nodes, opName );
 }
 
 template< typename ... T >
@@ -109,6 +389,7 @@ template< typename ... T >
 llvm::Value * codegenAssign
 (
     Context                                     & ctx,
+    AST::NodeType                         const   type,
     IRBuilderBinaryClbk< T ... >          const   clbk,
     std::span< AST::Node::Pointer const > const   nodes,
     std::string_view                      const   opName
@@ -116,19 +397,31 @@ llvm::Value * codegenAssign
 {
     ASSERT( std::size( nodes ) == 2U );
 
-    auto * lhs{ codegen( ctx, nodes[ 0U ] ) };
-    auto * rhs{ codegenBinary( ctx, clbk, nodes, opName ) };
+    auto const rhs{ codegenBinary( ctx, type, clbk, nodes, opName ) };
+    if ( rhs.value == nullptr ) { return nullptr; }
 
-    if ( lhs == nullptr || rhs == nullptr ) { return nullptr; }
+    return codegenStore( ctx, nodes[ 0U ], rhs, Detail::isSignedOperation( nodes ) );
+}
 
-    ctx.builder->CreateStore( rhs, lhs );
-    return lhs;
+template< typename ... T >
+[[ nodiscard ]]
+llvm::Value * codegenAssign
+(
+    Context                                     & ctx,
+    AST::NodeType                         const   type,
+    IRBuilderBinaryClbk< T ... >          const   signedClbk,
+    IRBuilderBinaryClbk< T ... >          const   unsignedClbk,
+    std::span< AST::Node::Pointer const > const   nodes,
+    std::string_view                      const   opName
+)
+{
+    return codegenAssign( ctx, type, Detail::isSignedOperation( nodes ) ? signedClbk : unsignedClbk, nodes, opName );
 }
 
 [[ nodiscard ]] llvm::Value    * codegenAssign            ( Context & ctx, std::span< AST::Node::Pointer const > const nodes );
 [[ nodiscard ]] llvm::Value    * codegenCall              ( Context & ctx, std::span< AST::Node::Pointer const > const nodes );
 [[ nodiscard ]] llvm::Value    * codegenMemberCall        ( Context & ctx, std::span< AST::Node::Pointer const > const nodes );
-[[ nodiscard ]] llvm::Value    * codegenContractDefinition( Context & ctx, std::span< AST::Node::Pointer const > const nodes );
+[[ nodiscard ]] llvm::Value    * codegenContractDefinition( Context & ctx, std::span< AST::Node::Pointer const > const nodes, bool const isClass );
 [[ nodiscard ]] llvm::Function * codegenFunctionDefinition( Context & ctx, std::span< AST::Node::Pointer const > const nodes );
 [[ nodiscard ]] llvm::Value    * codegenVariableDefinition( Context & ctx, std::span< AST::Node::Pointer const > const nodes );
 [[ nodiscard ]] llvm::Value    * codegenControlFlow       ( Context & ctx, std::span< AST::Node::Pointer const > const nodes );
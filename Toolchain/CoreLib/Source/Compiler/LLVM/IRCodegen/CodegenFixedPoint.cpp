@@ -0,0 +1,116 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include "CodegenFixedPoint.hpp"
+#include "CodegenRuntime.hpp"
+
+#include <CoreLib/Utils/Macros.hpp>
+
+#if defined (__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunused-parameter"
+#elif defined(__GNUC__) || defined(__GNUG__)
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/IRBuilder.h>
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#elif defined(__GNUC__) || defined(__GNUG__)
+#   pragma GCC diagnostic pop
+#endif
+
+#include <type_traits>
+
+namespace A1::LLVM::IR
+{
+
+namespace
+{
+    /** Size of the buffer for the decimal representation, i.e. 19 digits, sign, decimal point and the terminating null. */
+    constexpr unsigned stringBufferSize{ 24U };
+
+    [[ nodiscard ]]
+    llvm::Value * codegenRuntimeCall( Context & ctx, llvm::StringRef const name, llvm::Value * lhs, llvm::Value * rhs )
+    {
+        auto & builder{ *ctx.builder };
+        ASSERT( lhs->getType()->isIntegerTy( sizeof( Number::Type ) * 8U ) && rhs->getType() == lhs->getType() );
+
+        auto function
+        {
+            Detail::getRuntimeFunction
+            (
+                ctx,
+                name,
+                llvm::FunctionType::get( builder.getInt64Ty(), { builder.getInt64Ty(), builder.getInt64Ty() }, false )
+            )
+        };
+        return builder.CreateCall( function, { lhs, rhs } );
+    }
+} // namespace
+
+Number::Type getFixedPoint( Number const number ) noexcept
+{
+    using Unsigned = std::make_unsigned_t< Number::Type >;
+    return static_cast< Number::Type >
+    (
+        static_cast< Unsigned >( number.value ) * static_cast< Unsigned >( getPowerOf10( Number::maxDecimals - number.decimals ) )
+    );
+}
+
+Number::Type getIntegralPart( Number const number ) noexcept
+{
+    return number.value / getPowerOf10( number.decimals );
+}
+
+llvm::Value * codegenToFixedPoint( Context & ctx, llvm::Value * value )
+{
+    ASSERT( value->getType()->isIntegerTy( sizeof( Number::Type ) * 8U ) );
+    return ctx.builder->CreateMul( value, llvm::ConstantInt::get( value->getType(), fixedPointScale ), "fixtmp" );
+}
+
+llvm::Value * codegenFromFixedPoint( Context & ctx, llvm::Value * value )
+{
+    ASSERT( value->getType()->isIntegerTy( sizeof( Number::Type ) * 8U ) );
+    return ctx.builder->CreateSDiv( value, llvm::ConstantInt::get( value->getType(), fixedPointScale ), "unfixtmp" );
+}
+
+llvm::Value * codegenFixedPointMultiplication( Context & ctx, llvm::Value * lhs, llvm::Value * rhs )
+{
+    return codegenRuntimeCall( ctx, "num_mul", lhs, rhs );
+}
+
+llvm::Value * codegenFixedPointDivision( Context & ctx, llvm::Value * lhs, llvm::Value * rhs )
+{
+    return codegenRuntimeCall( ctx, "num_div", lhs, rhs );
+}
+
+llvm::Value * codegenFixedPointToString( Context & ctx, llvm::Value * value )
+{
+    auto & builder{ *ctx.builder };
+    ASSERT( value->getType()->isIntegerTy( sizeof( Number::Type ) * 8U ) );
+
+    auto toString
+    {
+        Detail::getRuntimeFunction
+        (
+            ctx,
+            "num_to_string",
+            llvm::FunctionType::get( builder.getInt8PtrTy(), { builder.getInt64Ty(), builder.getInt8PtrTy() }, false )
+        )
+    };
+
+    auto * function  { builder.GetInsertBlock()->getParent() };
+    auto * bufferSlot{ Detail::createSlot( *function, llvm::ArrayType::get( builder.getInt8Ty(), stringBufferSize ) ) };
+
+    return builder.CreateCall( toString, { value, builder.CreateBitCast( bufferSlot, builder.getInt8PtrTy() ) } );
+}
+
+} // namespace A1::LLVM::IR
@@ -0,0 +1,57 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include "../Context.hpp"
+
+#include <CoreLib/Tokenizer/Token.hpp>
+
+namespace llvm
+{
+    // fwd
+    class Value;
+} // namespace llvm
+
+namespace A1::LLVM::IR
+{
+
+/**
+ * num is a fixed-point decimal, i.e. the 64-bit integer scaled by 10^Number::maxDecimals.
+ * Sums, differences, comparisons and remainders of the scaled values are the integer ones,
+ * as well as products and quotients of a decimal and an integer. Products and quotients
+ * of two decimals need 128-bit intermediates, thus they are left to the runtime of the CoreUtils library.
+ */
+[[ nodiscard ]]
+constexpr Number::Type getPowerOf10( unsigned const exponent ) noexcept
+{
+    Number::Type power{ 1 };
+    for ( auto i{ 0U }; i < exponent; ++i ) { power *= 10; }
+    return power;
+}
+
+inline constexpr Number::Type fixedPointScale{ getPowerOf10( Number::maxDecimals ) };
+
+/** Value of the literal in the fixed-point representation, wraps around if the literal is out of the range of num. */
+[[ nodiscard ]] Number::Type getFixedPoint( Number const number ) noexcept;
+
+/** Integral part of the literal, i.e. the literal truncated towards zero. */
+[[ nodiscard ]] Number::Type getIntegralPart( Number const number ) noexcept;
+
+/** Scales the 64-bit integer to num. */
+[[ nodiscard ]] llvm::Value * codegenToFixedPoint( Context & ctx, llvm::Value * value );
+
+/** Truncates num towards zero, i.e. to the 64-bit integer of its integral part. */
+[[ nodiscard ]] llvm::Value * codegenFromFixedPoint( Context & ctx, llvm::Value * value );
+
+[[ nodiscard ]] llvm::Value * codegenFixedPointMultiplication( Context & ctx, llvm::Value * lhs, llvm::Value * rhs );
+[[ nodiscard ]] llvm::Value * codegenFixedPointDivision      ( Context & ctx, llvm::Value * lhs, llvm::Value * rhs );
+
+/** Converts num to its decimal representation, without the trailing zeros of the fraction. Returns pointer to the string. */
+[[ nodiscard ]] llvm::Value * codegenFixedPointToString( Context & ctx, llvm::Value * value );
+
+} // namespace A1::LLVM::IR
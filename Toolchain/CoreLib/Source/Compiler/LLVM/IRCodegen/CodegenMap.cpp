@@ -0,0 +1,223 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include "CodegenMap.hpp"
+#include "CodegenExpression.hpp"
+#include "CodegenRuntime.hpp"
+
+#include <CoreLib/Types.hpp>
+#include <CoreLib/Utils/Macros.hpp>
+
+#if defined (__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunused-parameter"
+#elif defined(__GNUC__) || defined(__GNUG__)
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/GlobalVariable.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Module.h>
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#elif defined(__GNUC__) || defined(__GNUG__)
+#   pragma GCC diagnostic pop
+#endif
+
+#include <fmt/format.h>
+
+#include <cstdint>
+
+namespace A1::LLVM::IR
+{
+
+namespace
+{
+    [[ nodiscard ]]
+    MapType const * getMapType( AST::Node::Pointer const & node ) noexcept
+    {
+        auto const typeID{ node->typeID() };
+        return typeID != nullptr ? std::get_if< MapType >( typeID ) : nullptr;
+    }
+
+    [[ nodiscard ]]
+    std::uint32_t getSize( Context & ctx, llvm::Type * type )
+    {
+        return static_cast< std::uint32_t >( ctx.module_->getDataLayout().getTypeStoreSize( type ).getFixedSize() );
+    }
+
+    struct Key
+    {
+        llvm::Value   * bytes{ nullptr };
+        std::uint32_t   size { 0U };
+    };
+
+    /**
+     * Integer key is converted to the key type and stored in the slot, so that the keys
+     * which are equal as numbers, e.g. integer 1 and num 1.0, are equal as bytes as well.
+     */
+    [[ nodiscard ]]
+    Key codegenKey( Context & ctx, MapType const & map, AST::Node::Pointer const & node )
+    {
+        auto & builder{ *ctx.builder };
+
+        auto * type{ getType( ctx, map.keyTypeID ) };
+        auto   key { codegenNumeric( ctx, node ) };
+        if ( type == nullptr || key.value == nullptr ) { return {}; }
+
+        if ( map.keyTypeID == Registry::getAddressHandle() )
+        {
+            return { builder.CreateBitCast( key.value, builder.getInt8PtrTy() ), addressSize };
+        }
+
+        ASSERTM( type->isIntegerTy(), "Map key is either an integer or an address" );
+
+        auto * slot{ Detail::createSlot( *builder.GetInsertBlock()->getParent(), type ) };
+        builder.CreateStore( Detail::convert( ctx, key, type, Detail::isFixedPoint( map.keyTypeID, type ), Detail::isSigned( node ) ), slot );
+
+        return { builder.CreateBitCast( slot, builder.getInt8PtrTy() ), getSize( ctx, type ) };
+    }
+
+    /** Constant zero of the value type, which the missing keys read as. */
+    [[ nodiscard ]]
+    llvm::Value * getZero( Context & ctx, TypeID const typeID, llvm::Type * type )
+    {
+        auto const name{ fmt::format( "map.zero.{}", Registry::getIndex( typeID ) ) };
+
+        auto * zero{ ctx.module_->getNamedGlobal( name ) };
+        if ( zero == nullptr )
+        {
+            zero = new llvm::GlobalVariable
+            (
+                *ctx.module_,
+                type,
+                true /* isConstant */,
+                llvm::GlobalValue::PrivateLinkage,
+                llvm::Constant::getNullValue( type ),
+                name
+            );
+        }
+        return ctx.builder->CreateBitCast( zero, ctx.builder->getInt8PtrTy() );
+    }
+} // namespace
+
+bool isMapIndex( AST::Node::Pointer const & node ) noexcept
+{
+    return
+        node->is< AST::NodeType >() && node->get< AST::NodeType >() == AST::NodeType::Index &&
+        std::size( node->children() ) == 2U && getMapType( node->children()[ 0U ] ) != nullptr;
+}
+
+bool isMap( TypeID const typeID ) noexcept
+{
+    return typeID != nullptr && std::holds_alternative< MapType >( *typeID );
+}
+
+llvm::Value * codegenMapLoad( Context & ctx, std::span< AST::Node::Pointer const > const nodes )
+{
+    ASSERTM( std::size( nodes ) == 2U, "Map subscript consists of the map and the key" );
+    auto & builder{ *ctx.builder };
+
+    auto const * map{ getMapType( nodes[ 0U ] ) };
+    ASSERT( map != nullptr );
+
+    auto * valueType{ getStorageType( ctx, map->valueTypeID ) };
+    auto * handle   { codegen( ctx, nodes[ 0U ] ) };
+    if ( valueType == nullptr || handle == nullptr ) { return nullptr; }
+
+    handle = Detail::load( ctx, handle );
+
+    auto const key{ codegenKey( ctx, *map, nodes[ 1U ] ) };
+    if ( key.bytes == nullptr ) { return nullptr; }
+
+    auto get
+    {
+        Detail::getRuntimeFunction
+        (
+            ctx,
+            "map_get",
+            llvm::FunctionType::get( builder.getInt8PtrTy(), { builder.getInt8PtrTy(), builder.getInt8PtrTy() }, false )
+        )
+    };
+    auto * value{ builder.CreateCall( get, { handle, key.bytes } ) };
+
+    // Missing key is redirected to the zero constant, rather than branching around the load
+    auto * pointer{ builder.CreateSelect( builder.CreateIsNull( value ), getZero( ctx, map->valueTypeID, valueType ), value ) };
+    pointer = builder.CreateBitCast( pointer, valueType->getPointerTo() );
+
+    // Instance is not loaded as it is accessed by its pointer
+    return Detail::isInstance( map->valueTypeID ) ? pointer : builder.CreateLoad( valueType, pointer, "mapvalue" );
+}
+
+llvm::Value * codegenMapInsert( Context & ctx, std::span< AST::Node::Pointer const > const nodes )
+{
+    ASSERTM( std::size( nodes ) == 2U, "Map subscript consists of the map and the key" );
+    auto & builder{ *ctx.builder };
+
+    auto const * map{ getMapType( nodes[ 0U ] ) };
+    ASSERT( map != nullptr );
+
+    // Runtime creates the map on the first insertion, thus it is given the pointer to the handle
+    auto * valueType{ getStorageType( ctx, map->valueTypeID ) };
+    auto * handle   { codegenMapReference( ctx, nodes[ 0U ] ) };
+    if ( valueType == nullptr || handle == nullptr ) { return nullptr; }
+
+    auto const key{ codegenKey( ctx, *map, nodes[ 1U ] ) };
+    if ( key.bytes == nullptr ) { return nullptr; }
+
+    auto insert
+    {
+        Detail::getRuntimeFunction
+        (
+            ctx,
+            "map_insert",
+            llvm::FunctionType::get
+            (
+                builder.getInt8PtrTy(),
+                { builder.getInt8PtrTy()->getPointerTo(), builder.getInt32Ty(), builder.getInt32Ty(), builder.getInt8PtrTy() },
+                false
+            )
+        )
+    };
+
+    auto * value
+    {
+        builder.CreateCall
+        (
+            insert,
+            {
+                handle,
+                builder.getInt32( key.size ),
+                builder.getInt32( getSize( ctx, valueType ) ),
+                key.bytes
+            }
+        )
+    };
+    return builder.CreateBitCast( value, valueType->getPointerTo() );
+}
+
+llvm::Value * codegenMapReference( Context & ctx, AST::Node::Pointer const & map )
+{
+    auto & builder{ *ctx.builder };
+
+    auto * handle{ isMapIndex( map ) ? codegenMapInsert( ctx, map->children() ) : codegen( ctx, map ) };
+    if ( handle == nullptr ) { return nullptr; }
+
+    // Temporary map, e.g. the one returned by the function, has no place of its own
+    if ( auto * type{ handle->getType() }; !type->isPointerTy() || !type->getContainedType( 0U )->isPointerTy() )
+    {
+        auto * slot{ Detail::createSlot( *builder.GetInsertBlock()->getParent(), type ) };
+        builder.CreateStore( handle, slot );
+        handle = slot;
+    }
+    return builder.CreateBitCast( handle, builder.getInt8PtrTy()->getPointerTo() );
+}
+
+} // namespace A1::LLVM::IR
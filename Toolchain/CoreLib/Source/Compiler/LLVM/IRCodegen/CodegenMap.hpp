@@ -0,0 +1,58 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include "../Context.hpp"
+
+#include <CoreLib/AST/ASTNode.hpp>
+#include <CoreLib/Types.hpp>
+
+#include <span>
+
+namespace llvm
+{
+    // fwd
+    class Value;
+} // namespace llvm
+
+namespace A1::LLVM::IR
+{
+
+/**
+ * Maps are hash tables of the runtime of the CoreUtils library, see CoreUtils/Containers/HashMap.hpp.
+ * Variable or data member of the map type holds the opaque handle, which is null until the first
+ * insertion, thus the zero-initialized contract holds empty maps. Integer keys are passed by
+ * the bytes of the key type, address keys by the bytes of the address. Instances are stored
+ * inline, as the values of any other type.
+ */
+
+/** Size of the address in bytes, i.e. the size of the RIPEMD-160 digest. */
+inline constexpr unsigned addressSize{ 20U };
+
+/** Checks whether the node is the subscript of the map, e.g. 'self.balances[owner]'. */
+[[ nodiscard ]] bool isMapIndex( AST::Node::Pointer const & node ) noexcept;
+
+[[ nodiscard ]] bool isMap( TypeID const typeID ) noexcept;
+
+/**
+ * Loads the value of the key, zero if the key is not present. Nodes are the map and the key.
+ * Instance is not loaded, the pointer to it is returned, which is read-only for the missing key.
+ */
+[[ nodiscard ]] llvm::Value * codegenMapLoad( Context & ctx, std::span< AST::Node::Pointer const > const nodes );
+
+/** Returns the pointer to the value of the key, the key is inserted if it is not present. */
+[[ nodiscard ]] llvm::Value * codegenMapInsert( Context & ctx, std::span< AST::Node::Pointer const > const nodes );
+
+/**
+ * Returns the pointer to the handle. Maps are passed to functions by reference, as the first insertion
+ * creates the map, which updates the handle. Handle of the nested map is the value of the outer map,
+ * thus the key of the outer map is inserted, so that the handle has its place to be updated in.
+ */
+[[ nodiscard ]] llvm::Value * codegenMapReference( Context & ctx, AST::Node::Pointer const & map );
+
+} // namespace A1::LLVM::IR
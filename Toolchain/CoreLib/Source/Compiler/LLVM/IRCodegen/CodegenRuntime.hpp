@@ -0,0 +1,60 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include "../Context.hpp"
+
+#if defined (__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunused-parameter"
+#elif defined(__GNUC__) || defined(__GNUG__)
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/IRBuilder.h>
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#elif defined(__GNUC__) || defined(__GNUG__)
+#   pragma GCC diagnostic pop
+#endif
+
+#include <algorithm>
+
+namespace A1::LLVM::IR::Detail
+{
+    /**
+     * Runtime functions are defined in the CoreUtils library, which is linked
+     * as any other imported module, thus it is imported implicitly once used.
+     */
+    [[ nodiscard ]]
+    inline llvm::FunctionCallee getRuntimeFunction( Context & ctx, llvm::StringRef const name, llvm::FunctionType * type )
+    {
+        static constexpr auto runtimeModule{ "core" };
+        if ( std::find( std::begin( ctx.importedModules ), std::end( ctx.importedModules ), runtimeModule ) == std::end( ctx.importedModules ) )
+        {
+            ctx.importedModules.emplace_back( runtimeModule );
+        }
+        return ctx.module_->getOrInsertFunction( name, type );
+    }
+
+    /**
+     * Values are passed to the runtime through memory, the slots are allocated in the entry
+     * block of the function, so that the stack does not grow when the runtime is called in a loop.
+     */
+    [[ nodiscard ]]
+    inline llvm::AllocaInst * createSlot( llvm::Function & function, llvm::Type * type )
+    {
+        auto & entryBlock{ function.getEntryBlock() };
+
+        llvm::IRBuilder<> entryBuilder{ &entryBlock, entryBlock.begin() };
+        return entryBuilder.CreateAlloca( type );
+    }
+} // namespace A1::LLVM::IR::Detail
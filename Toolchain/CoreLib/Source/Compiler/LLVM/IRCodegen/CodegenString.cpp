@@ -0,0 +1,165 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include "CodegenString.hpp"
+#include "CodegenArray.hpp"
+#include "CodegenExpression.hpp"
+
+#include <CoreLib/Types.hpp>
+#include <CoreLib/Utils/Macros.hpp>
+
+#if defined (__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunused-parameter"
+#elif defined(__GNUC__) || defined(__GNUG__)
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Module.h>
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#elif defined(__GNUC__) || defined(__GNUG__)
+#   pragma GCC diagnostic pop
+#endif
+
+namespace A1::LLVM::IR
+{
+
+namespace
+{
+    /** Loads the view, which is either the value, e.g. the argument, or the variable. */
+    [[ nodiscard ]]
+    llvm::Value * codegenView( Context & ctx, AST::Node::Pointer const & str )
+    {
+        auto * view{ codegen( ctx, str ) };
+        return view != nullptr ? Detail::load( ctx, view ) : nullptr;
+    }
+
+    /** Offset of the byte, num offsets are truncated as any other num passed as an integer. */
+    [[ nodiscard ]]
+    llvm::Value * codegenOffset( Context & ctx, AST::Node::Pointer const & offset )
+    {
+        auto const value{ codegenNumeric( ctx, offset ) };
+        if ( value.value == nullptr ) { return nullptr; }
+
+        return Detail::convert( ctx, value, ctx.builder->getInt64Ty(), false /* isFixed */, Detail::isSigned( offset ) );
+    }
+} // namespace
+
+llvm::StructType * getStrType( Context & ctx ) noexcept
+{
+    return llvm::StructType::get( *ctx.internalCtx, { llvm::Type::getInt8PtrTy( *ctx.internalCtx ), llvm::Type::getInt64Ty( *ctx.internalCtx ) } );
+}
+
+llvm::Constant * codegenStrLiteral( Context & ctx, std::string_view const value )
+{
+    auto * bytes{ ctx.builder->CreateGlobalStringPtr( value, "", 0U, ctx.module_.get() ) };
+    return llvm::ConstantStruct::get( getStrType( ctx ), { bytes, ctx.builder->getInt64( std::size( value ) ) } );
+}
+
+bool isStrIndex( AST::Node::Pointer const & node ) noexcept
+{
+    return
+        node->is< AST::NodeType >() && node->get< AST::NodeType >() == AST::NodeType::Index &&
+        std::size( node->children() ) == 2U && node->children()[ 0U ]->typeID() == Registry::getStrHandle();
+}
+
+llvm::Value * codegenStrByte( Context & ctx, AST::Node const & node )
+{
+    auto const & nodes{ node.children() };
+    ASSERTM( std::size( nodes ) == 2U, "String subscript consists of the string and the index" );
+    auto & builder{ *ctx.builder };
+
+    auto * view { codegenView  ( ctx, nodes[ 0U ] ) };
+    auto * index{ codegenOffset( ctx, nodes[ 1U ] ) };
+    if ( view == nullptr || index == nullptr ) { return nullptr; }
+
+    // Negative index is out of bounds as well, as it compares as the huge unsigned one
+    if ( !ctx.inBoundsSubscripts.contains( &node ) )
+    {
+        codegenBoundsCheck( ctx, builder.CreateICmpULT( index, builder.CreateExtractValue( view, 1U, "strlength" ) ) );
+    }
+
+    auto * byte{ builder.CreateGEP( builder.getInt8Ty(), builder.CreateExtractValue( view, 0U ), index ) };
+    return builder.CreateLoad( builder.getInt8Ty(), byte, "strbyte" );
+}
+
+llvm::Value * codegenStrSlice( Context & ctx, AST::Node const & node )
+{
+    auto const & nodes{ node.children() };
+    ASSERTM( std::size( nodes ) == 3U, "String slice consists of the string, the start and the end" );
+    auto & builder{ *ctx.builder };
+
+    auto * view { codegenView  ( ctx, nodes[ 0U ] ) };
+    auto * start{ codegenOffset( ctx, nodes[ 1U ] ) };
+    auto * end  { codegenOffset( ctx, nodes[ 2U ] ) };
+    if ( view == nullptr || start == nullptr || end == nullptr ) { return nullptr; }
+
+    // Slice is in bounds if 0 <= start <= end <= length, negative offsets compare as the huge unsigned ones
+    auto * length{ builder.CreateExtractValue( view, 1U, "strlength" ) };
+    codegenBoundsCheck( ctx, builder.CreateAnd( builder.CreateICmpULE( start, end ), builder.CreateICmpULE( end, length ) ) );
+
+    auto * bytes{ builder.CreateGEP( builder.getInt8Ty(), builder.CreateExtractValue( view, 0U ), start ) };
+
+    llvm::Value * slice{ llvm::UndefValue::get( getStrType( ctx ) ) };
+    slice = builder.CreateInsertValue( slice, bytes, 0U );
+    slice = builder.CreateInsertValue( slice, builder.CreateSub( end, start ), 1U, "strslice" );
+    return slice;
+}
+
+llvm::Value * codegenStrLength( Context & ctx, AST::Node::Pointer const & str )
+{
+    auto * view{ codegenView( ctx, str ) };
+    return view != nullptr ? ctx.builder->CreateExtractValue( view, 1U, "strlength" ) : nullptr;
+}
+
+llvm::Value * codegenStrEquality( Context & ctx, std::span< AST::Node::Pointer const > const nodes, bool const isEqual )
+{
+    ASSERT( std::size( nodes ) == 2U );
+    auto & builder{ *ctx.builder };
+
+    auto * lhs{ codegenView( ctx, nodes[ 0U ] ) };
+    auto * rhs{ codegenView( ctx, nodes[ 1U ] ) };
+    if ( lhs == nullptr || rhs == nullptr ) { return nullptr; }
+
+    auto * length    { builder.CreateExtractValue( lhs, 1U ) };
+    auto * sameLength{ builder.CreateICmpEQ( length, builder.CreateExtractValue( rhs, 1U ) ) };
+
+    // Bytes are compared only if there are any, as the empty string may be the null view
+    auto * parent      { builder.GetInsertBlock()->getParent() };
+    auto * lengthBlock { builder.GetInsertBlock() };
+    auto * compareBlock{ llvm::BasicBlock::Create( *ctx.internalCtx, "str.compare", parent ) };
+    auto * endBlock    { llvm::BasicBlock::Create( *ctx.internalCtx, "str.end"    , parent ) };
+
+    builder.CreateCondBr( builder.CreateAnd( sameLength, builder.CreateIsNotNull( length ) ), compareBlock, endBlock );
+
+    builder.SetInsertPoint( compareBlock );
+    auto * difference
+    {
+        builder.CreateCall
+        (
+            ctx.symbols.externalBuiltInFunctions().at( "memcmp" ),
+            { builder.CreateExtractValue( lhs, 0U ), builder.CreateExtractValue( rhs, 0U ), length }
+        )
+    };
+    auto * sameBytes{ builder.CreateIsNull( difference ) };
+    builder.CreateBr( endBlock );
+
+    builder.SetInsertPoint( endBlock );
+    auto * equal{ builder.CreatePHI( builder.getInt1Ty(), 2U, "streq" ) };
+    equal->addIncoming( sameLength, lengthBlock  );
+    equal->addIncoming( sameBytes , compareBlock );
+
+    return isEqual ? static_cast< llvm::Value * >( equal ) : builder.CreateNot( equal, "strne" );
+}
+
+} // namespace A1::LLVM::IR
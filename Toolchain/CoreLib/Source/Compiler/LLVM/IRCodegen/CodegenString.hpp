@@ -0,0 +1,60 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include "../Context.hpp"
+
+#include <CoreLib/AST/ASTNode.hpp>
+
+#include <span>
+#include <string_view>
+
+namespace llvm
+{
+    // fwd
+    class Constant;
+    class StructType;
+    class Value;
+} // namespace llvm
+
+namespace A1::LLVM::IR
+{
+
+/**
+ * Strings are views, i.e. the pointer to the first byte and the length, which are passed around
+ * by value. Bytes of the string are never written nor freed, string literals are the constant
+ * globals, thus the slice shares the bytes of the sliced string, no view outlives its bytes
+ * and slicing allocates nothing. Empty string may be the null view, e.g. of the zero-initialized
+ * contract, hence the bytes are not accessed unless the length is non-zero.
+ *
+ * Subscripts and slices are checked against the length and the out of bounds access aborts,
+ * unless the bounds analysis proved the subscript to be in bounds, see Semantic/BoundsAnalysis.hpp.
+ */
+
+/** Type of the string, { i8*, i64 }. */
+[[ nodiscard ]] llvm::StructType * getStrType( Context & ctx ) noexcept;
+
+/** View of the bytes of the literal, which are emitted as the constant global. */
+[[ nodiscard ]] llvm::Constant * codegenStrLiteral( Context & ctx, std::string_view const value );
+
+/** Checks whether the node is the subscript of the string, e.g. 'payload[i]'. */
+[[ nodiscard ]] bool isStrIndex( AST::Node::Pointer const & node ) noexcept;
+
+/** Loads the byte of the subscript, the subscript node is the string and the index. */
+[[ nodiscard ]] llvm::Value * codegenStrByte( Context & ctx, AST::Node const & node );
+
+/** Returns the view of the bytes from the start up to the end, the nodes are the string, the start and the end. */
+[[ nodiscard ]] llvm::Value * codegenStrSlice( Context & ctx, AST::Node const & node );
+
+/** Returns the length of the string in bytes. */
+[[ nodiscard ]] llvm::Value * codegenStrLength( Context & ctx, AST::Node::Pointer const & str );
+
+/** Compares the bytes of the strings, the nodes are the compared strings. */
+[[ nodiscard ]] llvm::Value * codegenStrEquality( Context & ctx, std::span< AST::Node::Pointer const > const nodes, bool const isEqual );
+
+} // namespace A1::LLVM::IR
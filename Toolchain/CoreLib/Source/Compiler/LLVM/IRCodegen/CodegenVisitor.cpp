@@ -6,7 +6,11 @@
  */
 
 #include "CodegenVisitor.hpp"
+#include "CodegenArray.hpp"
 #include "CodegenExpression.hpp"
+#include "CodegenFixedPoint.hpp"
+#include "CodegenMap.hpp"
+#include "CodegenString.hpp"
 #include "Utils/Utils.hpp"
 
 #if defined (__clang__)
@@ -26,9 +30,66 @@
 #   pragma GCC diagnostic pop
 #endif
 
+#include <optional>
+
 namespace A1::LLVM::IR
 {
 
+namespace
+{
+    /** Generates the unary or binary operation, if the node is one. */
+    [[ nodiscard ]]
+    std::optional< NumericValue > codegenOperation( Context & ctx, AST::Node::Pointer const & node )
+    {
+        if ( node->is_not< AST::NodeType >() ) { return std::nullopt; }
+
+        auto const type{ node->get< AST::NodeType >() };
+        if ( ( type == AST::NodeType::Equality || type == AST::NodeType::Inequality ) && node->children()[ 0U ]->typeID() == Registry::getStrHandle() )
+        {
+            // Strings are equal if their bytes are, regardless of whether they share them
+            return NumericValue{ codegenStrEquality( ctx, node->children(), type == AST::NodeType::Equality ), false };
+        }
+
+        switch ( type )
+        {
+#define CODEGEN( type, codegenFunc, builderFunc, opName ) \
+        case AST::NodeType::type: return codegenFunc( ctx, AST::NodeType::type, &llvm::IRBuilder<>::builderFunc, node->children(), opName )
+#define CODEGEN_SIGNED( type, codegenFunc, signedBuilderFunc, unsignedBuilderFunc, opName ) \
+        case AST::NodeType::type: return codegenFunc( ctx, AST::NodeType::type, &llvm::IRBuilder<>::signedBuilderFunc, &llvm::IRBuilder<>::unsignedBuilderFunc, node->children(), opName )
+
+            CODEGEN       ( UnaryMinus       , codegenUnary , CreateNeg       ,                "nottemp" );
+            CODEGEN       ( LogicalNot       , codegenUnary , CreateNot       ,                "lnottmp" );
+            CODEGEN       ( LogicalAnd       , codegenBinary, CreateLogicalAnd,                "landtmp" );
+            CODEGEN       ( LogicalOr        , codegenBinary, CreateLogicalOr ,                "lortmp"  );
+            CODEGEN       ( Multiplication   , codegenBinary, CreateMul       ,                "multmp"  );
+            CODEGEN_SIGNED( Division         , codegenBinary, CreateSDiv      , CreateUDiv   , "divtmp"  );
+            CODEGEN_SIGNED( FloorDivision    , codegenBinary, CreateSDiv      , CreateUDiv   , "fdivtmp" );
+            CODEGEN_SIGNED( Modulus          , codegenBinary, CreateSRem      , CreateURem   , "modtmp"  );
+            CODEGEN       ( Addition         , codegenBinary, CreateAdd       ,                "addtmp"  );
+            CODEGEN       ( Subtraction      , codegenBinary, CreateSub       ,                "subtmp"  );
+            CODEGEN       ( BitwiseLeftShift , codegenBinary, CreateShl       ,                "lshtmp"  );
+            CODEGEN_SIGNED( BitwiseRightShift, codegenBinary, CreateAShr      , CreateLShr   , "rshtmp"  );
+            CODEGEN       ( BitwiseAnd       , codegenBinary, CreateAnd       ,                "andtmp"  );
+            CODEGEN       ( BitwiseOr        , codegenBinary, CreateOr        ,                "ortmp "  );
+            CODEGEN       ( BitwiseXor       , codegenBinary, CreateXor       ,                "xortmp"  );
+            CODEGEN       ( BitwiseNot       , codegenUnary , CreateNot       ,                "nottmp"  );
+            CODEGEN       ( Equality         , codegenBinary, CreateICmpEQ    ,                "eqtmp"   );
+            CODEGEN       ( Inequality       , codegenBinary, CreateICmpNE    ,                "netmp"   );
+            CODEGEN_SIGNED( GreaterThan      , codegenBinary, CreateICmpSGT   , CreateICmpUGT, "gttmp"   );
+            CODEGEN_SIGNED( GreaterThanEqual , codegenBinary, CreateICmpSGE   , CreateICmpUGE, "getmp"   );
+            CODEGEN_SIGNED( LessThan         , codegenBinary, CreateICmpSLT   , CreateICmpULT, "ltmp"    );
+            CODEGEN_SIGNED( LessThanEqual    , codegenBinary, CreateICmpSLE   , CreateICmpULE, "letmp"   );
+            CODEGEN       ( IsIdentical      , codegenBinary, CreateICmpEQ    ,                "eqtmp"   );
+            CODEGEN       ( IsNotIdentical   , codegenBinary, CreateICmpNE    ,                "netmp"   );
+
+#undef CODEGEN_SIGNED
+#undef CODEGEN
+            default:
+                return std::nullopt;
+        }
+    }
+} // namespace
+
 llvm::Value * codegen( Context & ctx, AST::Node::Pointer const & node )
 {
     if ( node == nullptr ) { return nullptr; }
@@ -39,48 +100,35 @@ llvm::Value * codegen( Context & ctx, AST::Node::Pointer const & node )
         {
             [ &ctx, &node ]( AST::NodeType const type ) -> llvm::Value *
             {
+                // Integer result of the operation on nums is converted to num, as any other num value
+                if ( auto const result{ codegenOperation( ctx, node ) } )
+                {
+                    if ( result->value == nullptr || result->isFixed || !Detail::isFixedPoint( node->typeID(), result->value->getType() ) )
+                    {
+                        return result->value;
+                    }
+                    return codegenToFixedPoint( ctx, result->value );
+                }
+
                 switch ( type )
                 {
 #define CODEGEN( type, codegenFunc, builderFunc, opName ) \
-    case AST::NodeType::type: return codegenFunc( ctx, &llvm::IRBuilder<>::builderFunc, node->children(), opName )
-
-                    CODEGEN( UnaryMinus       , codegenUnary , CreateNeg       , "nottemp" );
-                    CODEGEN( LogicalNot       , codegenUnary , CreateNot       , "lnottmp" );
-                    CODEGEN( LogicalAnd       , codegenBinary, CreateLogicalAnd, "landtmp" );
-                    CODEGEN( LogicalOr        , codegenBinary, CreateLogicalOr , "lortmp"  );
-                    CODEGEN( Multiplication   , codegenBinary, CreateMul       , "multmp"  );
-                    CODEGEN( Division         , codegenBinary, CreateSDiv      , "divtmp"  );
-                    CODEGEN( FloorDivision    , codegenBinary, CreateSDiv      , "fdivtmp" );
-                    CODEGEN( Modulus          , codegenBinary, CreateSRem      , "modtmp"  );
-                    CODEGEN( Addition         , codegenBinary, CreateAdd       , "addtmp"  );
-                    CODEGEN( Subtraction      , codegenBinary, CreateSub       , "subtmp"  );
-                    CODEGEN( BitwiseLeftShift , codegenBinary, CreateShl       , "lshtmp"  );
-                    CODEGEN( BitwiseRightShift, codegenBinary, CreateAShr      , "rshtmp"  );
-                    CODEGEN( BitwiseAnd       , codegenBinary, CreateAnd       , "andtmp"  );
-                    CODEGEN( BitwiseOr        , codegenBinary, CreateOr        , "ortmp "  );
-                    CODEGEN( BitwiseXor       , codegenBinary, CreateXor       , "xortmp"  );
-                    CODEGEN( BitwiseNot       , codegenUnary , CreateNot       , "nottmp"  );
-                    CODEGEN( Equality         , codegenBinary, CreateICmpEQ    , "eqtmp"   );
-                    CODEGEN( Inequality       , codegenBinary, CreateICmpNE    , "netmp"   );
-                    CODEGEN( GreaterThan      , codegenBinary, CreateICmpUGT   , "gttmp"   );
-                    CODEGEN( GreaterThanEqual , codegenBinary, CreateICmpUGE   , "getmp"   );
-                    CODEGEN( LessThan         , codegenBinary, CreateICmpULT   , "ltmp"    );
-                    CODEGEN( LessThanEqual    , codegenBinary, CreateICmpULE   , "letmp"   );
-                    CODEGEN( IsIdentical      , codegenBinary, CreateICmpEQ    , "eqtmp"   );
-                    CODEGEN( IsNotIdentical   , codegenBinary, CreateICmpNE    , "netmp"   );
-
-                    CODEGEN( AssignAddition         , codegenAssign, CreateAdd , "addtmp"  );
-                    CODEGEN( AssignSubtraction      , codegenAssign, CreateSub , "subtmp"  );
-                    CODEGEN( AssignMultiplication   , codegenAssign, CreateMul , "multmp"  );
-                    CODEGEN( AssignDivision         , codegenAssign, CreateUDiv, "divtmp"  );
-                    CODEGEN( AssignFloorDivision    , codegenAssign, CreateUDiv, "fdivtmp" );
-                    CODEGEN( AssignModulus          , codegenAssign, CreateURem, "modtmp"  );
-                    CODEGEN( AssignBitwiseLeftShift , codegenAssign, CreateShl , "shltmp"  );
-                    CODEGEN( AssignBitwiseRightShift, codegenAssign, CreateAShr, "shrtmp"  );
-                    CODEGEN( AssignBitwiseAnd       , codegenAssign, CreateAnd , "andtmp"  );
-                    CODEGEN( AssignBitwiseOr        , codegenAssign, CreateOr  , "ortmp"   );
-                    CODEGEN( AssignBitwiseXor       , codegenAssign, CreateXor , "xortmp"  );
+    case AST::NodeType::type: return codegenFunc( ctx, AST::NodeType::type, &llvm::IRBuilder<>::builderFunc, node->children(), opName )
+#define CODEGEN_SIGNED( type, codegenFunc, signedBuilderFunc, unsignedBuilderFunc, opName ) \
+    case AST::NodeType::type: return codegenFunc( ctx, AST::NodeType::type, &llvm::IRBuilder<>::signedBuilderFunc, &llvm::IRBuilder<>::unsignedBuilderFunc, node->children(), opName )
+                    CODEGEN       ( AssignAddition         , codegenAssign, CreateAdd       ,                "addtmp"  );
+                    CODEGEN       ( AssignSubtraction      , codegenAssign, CreateSub       ,                "subtmp"  );
+                    CODEGEN       ( AssignMultiplication   , codegenAssign, CreateMul       ,                "multmp"  );
+                    CODEGEN_SIGNED( AssignDivision         , codegenAssign, CreateSDiv      , CreateUDiv   , "divtmp"  );
+                    CODEGEN_SIGNED( AssignFloorDivision    , codegenAssign, CreateSDiv      , CreateUDiv   , "fdivtmp" );
+                    CODEGEN_SIGNED( AssignModulus          , codegenAssign, CreateSRem      , CreateURem   , "modtmp"  );
+                    CODEGEN       ( AssignBitwiseLeftShift , codegenAssign, CreateShl       ,                "shltmp"  );
+                    CODEGEN_SIGNED( AssignBitwiseRightShift, codegenAssign, CreateAShr      , CreateLShr   , "shrtmp"  );
+                    CODEGEN       ( AssignBitwiseAnd       , codegenAssign, CreateAnd       ,                "andtmp"  );
+                    CODEGEN       ( AssignBitwiseOr        , codegenAssign, CreateOr        ,                "ortmp"   );
+                    CODEGEN       ( AssignBitwiseXor       , codegenAssign, CreateXor       ,                "xortmp"  );
 
+#undef CODEGEN_SIGNED
 #undef CODEGEN
                     case AST::NodeType::Assign     : return codegenAssign    ( ctx, node->children() );
                     case AST::NodeType::Call       : return codegenCall      ( ctx, node->children() );
@@ -94,6 +142,11 @@ llvm::Value * codegen( Context & ctx, AST::Node::Pointer const & node )
                     {
                         auto const & nodes{ node->children() };
                         ASSERT( std::size( nodes ) == 2U );
+
+                        if ( isMapIndex  ( node ) ) { return codegenMapLoad  ( ctx, nodes ); }
+                        if ( isArrayIndex( node ) ) { return codegenArrayLoad( ctx, *node ); }
+                        if ( isStrIndex  ( node ) ) { return codegenStrByte  ( ctx, *node ); }
+
                         ASSERTM( nodes[ 0U ]->is< Identifier >(), "Identifier is the first child node in the subscript operator expression" );
 
                         auto const & internalBuiltInFunctions{ ctx.symbols.internalBuiltInFunctions() };
@@ -104,11 +157,12 @@ llvm::Value * codegen( Context & ctx, AST::Node::Pointer const & node )
                             return ctx.builder->CreateCall( internalBuiltInFunctions.at( name ), { codegen( ctx, nodes[ 1U ] ) } );
                         }
 
-                        /**
-                         * TODO: Implement subscript operator for user-defined maps.
-                         */
                         return nullptr;
                     }
+                    case AST::NodeType::Slice:
+                    {
+                        return codegenStrSlice( ctx, *node );
+                    }
                     case AST::NodeType::StatementIf:
                     case AST::NodeType::StatementElif:
                     {
@@ -128,6 +182,11 @@ llvm::Value * codegen( Context & ctx, AST::Node::Pointer const & node )
                     {
                         return codegenLoopFlow( ctx, node->children() );
                     }
+                    case AST::NodeType::StatementPass:
+                    {
+                        // Pass statement generates no code, yet it is a valid statement, e.g. within if body
+                        return llvm::ConstantInt::get( *ctx.internalCtx, llvm::APInt( sizeof( Number::Type ) * 8U /* numBits */, 0U, false /* isSigned */ ) );
+                    }
                     case AST::NodeType::StatementReturn:
                     {
                         ASSERT( std::size( node->children() ) == 1U );
@@ -144,7 +203,8 @@ llvm::Value * codegen( Context & ctx, AST::Node::Pointer const & node )
                         return nullptr;
                     }
                     case AST::NodeType::StatementAssert   : return codegenAssert            ( ctx, node->children() );
-                    case AST::NodeType::ContractDefinition: return codegenContractDefinition( ctx, node->children() );
+                    case AST::NodeType::ContractDefinition: return codegenContractDefinition( ctx, node->children(), false /* isClass */ );
+                    case AST::NodeType::ClassDefinition   : return codegenContractDefinition( ctx, node->children(), true  /* isClass */ );
                     case AST::NodeType::FunctionDefinition: return codegenFunctionDefinition( ctx, node->children() );
                     case AST::NodeType::VariableDefinition: return codegenVariableDefinition( ctx, node->children() );
 
@@ -162,11 +222,12 @@ llvm::Value * codegen( Context & ctx, AST::Node::Pointer const & node )
             },
             [ &ctx ]( Number const number ) -> llvm::Value *
             {
-                return llvm::ConstantInt::get( *ctx.internalCtx, llvm::APInt( sizeof( Number::Type ) * 8U /* numBits */, number.value, false /* isSigned */ ) );
+                auto const value{ number.decimals > 0U ? getFixedPoint( number ) : number.value };
+                return llvm::ConstantInt::get( *ctx.internalCtx, llvm::APInt( sizeof( Number::Type ) * 8U /* numBits */, value, false /* isSigned */ ) );
             },
             [ &ctx ]( StringLiteral const & str ) -> llvm::Value *
             {
-                return ctx.builder->CreateGlobalStringPtr( str.value, "", 0U, ctx.module_.get() );
+                return codegenStrLiteral( ctx, str.value );
             },
             []( TypeID const ) -> llvm::Value *
             {
@@ -177,4 +238,22 @@ llvm::Value * codegen( Context & ctx, AST::Node::Pointer const & node )
     );
 }
 
-} // namespace A1::LLVM::IR
\ No newline at end of file
+NumericValue codegenNumeric( Context & ctx, AST::Node::Pointer const & node )
+{
+    if ( node == nullptr ) { return {}; }
+
+    if ( auto result{ codegenOperation( ctx, node ) } ) { return *result; }
+
+    if ( node->is< AST::NodeType >() && node->get< AST::NodeType >() == AST::NodeType::Parentheses )
+    {
+        ASSERT( std::size( node->children() ) == 1U );
+        return codegenNumeric( ctx, node->children()[ 0U ] );
+    }
+
+    auto * value{ Detail::load( ctx, codegen( ctx, node ) ) };
+    if ( value == nullptr ) { return {}; }
+
+    return { value, Detail::isFixedPoint( node, value ) };
+}
+
+} // namespace A1::LLVM::IR
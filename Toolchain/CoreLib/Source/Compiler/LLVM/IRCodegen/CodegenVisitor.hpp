@@ -20,6 +20,23 @@ namespace llvm
 namespace A1::LLVM::IR
 {
 
+/**
+ * Value of the numeric expression, fixed-point num values are told apart from the integers,
+ * since integer literals and num variables of the inferred width hold integers, which are
+ * scaled only once they meet the decimals, see CodegenFixedPoint.hpp.
+ */
+struct NumericValue
+{
+    llvm::Value * value  { nullptr };
+    bool          isFixed{ false };
+};
+
 llvm::Value * codegen( Context & ctx, AST::Node::Pointer const & node );
 
+/**
+ * Generates the expression and loads its value. Unlike 'codegen', integer result
+ * of the operation on nums is left as is, rather than converted to num.
+ */
+NumericValue codegenNumeric( Context & ctx, AST::Node::Pointer const & node );
+
 } // namespace A1::LLVM::IR
\ No newline at end of file
@@ -0,0 +1,222 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include "CodegenWideInteger.hpp"
+#include "CodegenRuntime.hpp"
+
+#include <CoreLib/Utils/Macros.hpp>
+
+#if defined (__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunused-parameter"
+#elif defined(__GNUC__) || defined(__GNUG__)
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/InstrTypes.h>
+#include <llvm/IR/MDBuilder.h>
+#include <llvm/Transforms/Utils/BasicBlockUtils.h>
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#elif defined(__GNUC__) || defined(__GNUG__)
+#   pragma GCC diagnostic pop
+#endif
+
+#include <vector>
+
+namespace A1::LLVM::IR
+{
+
+namespace
+{
+    using Detail::createSlot;
+    using Detail::getRuntimeFunction;
+
+    /** Width of the integer types handled by the runtime. */
+    constexpr unsigned wideBitWidth{ 256U };
+
+    /** Size of the buffer for the decimal representation, i.e. 78 digits, sign and the terminating null. */
+    constexpr unsigned stringBufferSize{ 80U };
+
+    [[ nodiscard ]]
+    llvm::Value * asLimbs( llvm::IRBuilder<> & builder, llvm::Value * slot )
+    {
+        return builder.CreateBitCast( slot, llvm::PointerType::get( builder.getInt64Ty(), 0U ) );
+    }
+
+    [[ nodiscard ]]
+    bool isWideDivision( llvm::Instruction const & instruction ) noexcept
+    {
+        switch ( instruction.getOpcode() )
+        {
+            case llvm::Instruction::UDiv:
+            case llvm::Instruction::SDiv:
+            case llvm::Instruction::URem:
+            case llvm::Instruction::SRem:
+                return instruction.getType()->isIntegerTy( wideBitWidth );
+
+            default:
+                return false;
+        }
+    }
+
+    void expandWideDivision( Context & ctx, llvm::BinaryOperator & division )
+    {
+        auto const opcode    { division.getOpcode() };
+        auto const isSigned  { opcode == llvm::Instruction::SDiv || opcode == llvm::Instruction::SRem };
+        auto const isQuotient{ opcode == llvm::Instruction::SDiv || opcode == llvm::Instruction::UDiv };
+
+        auto * lhs     { division.getOperand( 0U ) };
+        auto * rhs     { division.getOperand( 1U ) };
+        auto * type    { division.getType() };
+        auto * function{ division.getFunction() };
+
+        llvm::IRBuilder<> builder{ &division };
+
+        /**
+         * Operands which fit in 64 bits, or in 63 bits in case of signed division so that
+         * both of them are non-negative, are divided natively. Division by zero is left to
+         * the runtime, which defines its result.
+         */
+        auto * highBits{ builder.CreateLShr( builder.CreateOr( lhs, rhs ), isSigned ? 63U : 64U ) };
+        auto * isSmall
+        {
+            builder.CreateAnd
+            (
+                builder.CreateICmpEQ( highBits, llvm::ConstantInt::get( type, 0U ) ),
+                builder.CreateICmpNE( rhs     , llvm::ConstantInt::get( type, 0U ) )
+            )
+        };
+
+        llvm::Instruction * fastTerminator{ nullptr };
+        llvm::Instruction * slowTerminator{ nullptr };
+        llvm::SplitBlockAndInsertIfThenElse
+        (
+            isSmall,
+            &division,
+            &fastTerminator,
+            &slowTerminator,
+            llvm::MDBuilder{ ctx.builder->getContext() }.createBranchWeights( 1000U, 1U )
+        );
+
+        builder.SetInsertPoint( fastTerminator );
+        auto * fastResult
+        {
+            builder.CreateZExt
+            (
+                builder.CreateBinOp
+                (
+                    isQuotient ? llvm::Instruction::UDiv : llvm::Instruction::URem,
+                    builder.CreateTrunc( lhs, builder.getInt64Ty() ),
+                    builder.CreateTrunc( rhs, builder.getInt64Ty() )
+                ),
+                type
+            )
+        };
+
+        auto * limbsType{ llvm::PointerType::get( builder.getInt64Ty(), 0U ) };
+        auto   divmod
+        {
+            getRuntimeFunction
+            (
+                ctx,
+                isSigned ? "i256_divmod" : "u256_divmod",
+                llvm::FunctionType::get( builder.getVoidTy(), { limbsType, limbsType, limbsType, limbsType }, false )
+            )
+        };
+
+        auto * lhsSlot      { createSlot( *function, type ) };
+        auto * rhsSlot      { createSlot( *function, type ) };
+        auto * quotientSlot { createSlot( *function, type ) };
+        auto * remainderSlot{ createSlot( *function, type ) };
+
+        builder.SetInsertPoint( slowTerminator );
+        builder.CreateStore( lhs, lhsSlot );
+        builder.CreateStore( rhs, rhsSlot );
+        builder.CreateCall
+        (
+            divmod,
+            {
+                asLimbs( builder, lhsSlot      ),
+                asLimbs( builder, rhsSlot      ),
+                asLimbs( builder, quotientSlot ),
+                asLimbs( builder, remainderSlot )
+            }
+        );
+        auto * slowResult{ builder.CreateLoad( type, isQuotient ? quotientSlot : remainderSlot ) };
+
+        builder.SetInsertPoint( &division );
+        auto * result{ builder.CreatePHI( type, 2U ) };
+        result->addIncoming( fastResult, fastTerminator->getParent() );
+        result->addIncoming( slowResult, slowTerminator->getParent() );
+
+        division.replaceAllUsesWith( result );
+        division.eraseFromParent();
+    }
+} // namespace
+
+llvm::Value * codegenWideToString( Context & ctx, llvm::Value * value, bool const isSigned )
+{
+    auto & builder{ *ctx.builder };
+    ASSERT( value->getType()->isIntegerTy( wideBitWidth ) );
+
+    auto toString
+    {
+        getRuntimeFunction
+        (
+            ctx,
+            isSigned ? "i256_to_string" : "u256_to_string",
+            llvm::FunctionType::get
+            (
+                builder.getInt8PtrTy(),
+                { llvm::PointerType::get( builder.getInt64Ty(), 0U ), builder.getInt8PtrTy() },
+                false
+            )
+        )
+    };
+
+    auto * function  { builder.GetInsertBlock()->getParent() };
+    auto * valueSlot { createSlot( *function, value->getType() ) };
+    auto * bufferSlot{ createSlot( *function, llvm::ArrayType::get( builder.getInt8Ty(), stringBufferSize ) ) };
+
+    builder.CreateStore( value, valueSlot );
+    return builder.CreateCall
+    (
+        toString,
+        { asLimbs( builder, valueSlot ), builder.CreateBitCast( bufferSlot, builder.getInt8PtrTy() ) }
+    );
+}
+
+void expandWideDivisions( Context & ctx )
+{
+    // Divisions are collected first, as the expansion splits the blocks being iterated
+    std::vector< llvm::BinaryOperator * > divisions;
+    for ( auto & function : *ctx.module_ )
+    {
+        for ( auto & block : function )
+        {
+            for ( auto & instruction : block )
+            {
+                if ( isWideDivision( instruction ) )
+                {
+                    divisions.push_back( llvm::cast< llvm::BinaryOperator >( &instruction ) );
+                }
+            }
+        }
+    }
+
+    for ( auto * division : divisions )
+    {
+        expandWideDivision( ctx, *division );
+    }
+}
+
+} // namespace A1::LLVM::IR
@@ -0,0 +1,37 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include "../Context.hpp"
+
+namespace llvm
+{
+    // fwd
+    class Value;
+} // namespace llvm
+
+namespace A1::LLVM::IR
+{
+
+/**
+ * 256-bit integers are lowered to LLVM i256, whose addition, subtraction, multiplication,
+ * shifts and comparisons the backend expands inline into chains of 64-bit operations.
+ * Division is the exception, as LLVM 14 backends cannot lower division of integers wider
+ * than 128 bits, thus it is left to the runtime of the CoreUtils library.
+ */
+
+/** Converts the 256-bit integer to its decimal representation, returns pointer to the string. */
+[[ nodiscard ]] llvm::Value * codegenWideToString( Context & ctx, llvm::Value * value, bool const isSigned );
+
+/**
+ * Replaces divisions of 256-bit integers within the module with the native 64-bit division,
+ * when both of the operands fit in it, and with the call to the runtime otherwise.
+ */
+void expandWideDivisions( Context & ctx );
+
+} // namespace A1::LLVM::IR
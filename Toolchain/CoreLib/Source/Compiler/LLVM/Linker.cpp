@@ -0,0 +1,310 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include "Linker.hpp"
+
+#include <CoreLib/Utils/Macros.hpp>
+
+#if defined (__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunused-parameter"
+#elif defined(__GNUC__) || defined(__GNUG__)
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Process.h>
+#include <llvm/Support/Program.h>
+#include <llvm/Support/raw_ostream.h>
+
+#ifdef LLD_ENABLED
+#   include <lld/Common/CommonLinkerContext.h>
+#   include <lld/Common/Driver.h>
+#endif // LLD_ENABLED
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#elif defined(__GNUC__) || defined(__GNUG__)
+#   pragma GCC diagnostic pop
+#endif
+
+#include <fmt/format.h>
+
+#if __linux__
+#   include <sys/mman.h>
+#   include <unistd.h>
+#endif // __linux__
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace A1::LLVM
+{
+
+namespace
+{
+    std::unordered_map< std::string_view, char const * > const externalModulePaths
+    {
+        {
+#ifndef TESTS_ENABLED
+            { "core", WASM_UTILS_LIBRARY_PATH }
+#endif // TESTS_ENABLED
+        }
+    };
+
+    /**
+     * File the object code is passed to the linker through, or the linked module is written to.
+     * On Linux, it is the anonymous in-memory file, which the linker opens by its '/proc' path,
+     * as the linker expects the path of the file. Otherwise, it is the unique temporary file.
+     *
+     * Descriptor is closed on exec, as the linkers of the concurrent compilations would
+     * inherit the objects of each other otherwise. The path names the descriptor of this
+     * process explicitly, thus the spawned linker opens it without inheriting it.
+     */
+    class ScratchFile final
+    {
+    public:
+        explicit ScratchFile( std::string_view const contents, bool const inMemory = true )
+        {
+#if __linux__
+            if ( inMemory )
+            {
+                if ( descriptor_ = ::memfd_create( "a1-object", MFD_CLOEXEC ); descriptor_ >= 0 )
+                {
+                    path_ = fmt::format( "/proc/{}/fd/{}", ::getpid(), descriptor_ );
+                }
+            }
+#else
+            static_cast< void >( inMemory );
+#endif // __linux__
+            if ( descriptor_ < 0 )
+            {
+                llvm::SmallString< 128U > path;
+                if ( llvm::sys::fs::createTemporaryFile( "a1", "o", descriptor_, path ) ) { return; }
+
+                path_      = path.str().str();
+                temporary_ = true;
+            }
+
+            llvm::raw_fd_ostream stream{ descriptor_, false /* shouldClose */ };
+            stream << contents;
+            stream.flush();
+
+            if ( stream.has_error() )
+            {
+                stream.clear_error();
+                path_.clear();
+            }
+        }
+
+        ScratchFile( ScratchFile const & ) = delete;
+        ScratchFile & operator=( ScratchFile const & ) = delete;
+
+        ~ScratchFile()
+        {
+            if ( descriptor_ >= 0 ) { static_cast< void >( llvm::sys::Process::SafelyCloseFileDescriptor( descriptor_ ) ); }
+            if ( temporary_ ) { llvm::sys::fs::remove( path_ ); }
+        }
+
+        [[ nodiscard ]] bool               valid() const noexcept { return !path_.empty(); }
+        [[ nodiscard ]] std::string const & path () const noexcept { return path_; }
+
+        /**
+         * Reads the file by its path rather than by the descriptor,
+         * since the linker may have replaced the file it has written to.
+         */
+        template< typename Contents >
+        [[ nodiscard ]] bool read( Contents & contents ) const
+        {
+            auto buffer{ llvm::MemoryBuffer::getFile( path_, false /* isText */, false /* requiresNullTerminator */ ) };
+            if ( !buffer ) { return false; }
+
+            contents.assign( ( *buffer )->getBufferStart(), ( *buffer )->getBufferEnd() );
+            return true;
+        }
+
+    private:
+        int         descriptor_{ -1 };
+        std::string path_;
+        bool        temporary_{ false };
+    };
+
+#ifdef LLD_ENABLED
+    /**
+     * Links the contract by lld within the process. Linker keeps its state in globals,
+     * thus concurrent compilations are linked one by one. Messages of the linker are
+     * written to the diagnostics rather than to the standard streams of the process.
+     */
+    [[ nodiscard ]] bool linkInProcess( std::vector< llvm::StringRef > const & arguments, llvm::raw_ostream & diagnostics )
+    {
+        static std::mutex linkerMutex;
+        std::scoped_lock lock{ linkerMutex };
+
+        std::vector< char const * > argv;
+        std::vector< std::string  > storage{ std::begin( arguments ), std::end( arguments ) };
+        for ( auto const & argument : storage ) { argv.push_back( argument.c_str() ); }
+
+        auto const linked{ lld::wasm::link( argv, diagnostics, diagnostics, false /* exitEarly */, false /* disableOutput */ ) };
+        lld::CommonLinkerContext::destroy();
+        return linked;
+    }
+#endif // LLD_ENABLED
+} // namespace
+
+bool link
+(
+    std::vector< std::string_view > const & objects,
+    std::string                     const & executableFilename,
+    std::vector< std::string >      const & importedModules,
+    std::string                           & diagnostics
+)
+{
+    llvm::raw_string_ostream diagnosticsStream{ diagnostics };
+
+    // Scratch files are neither copied nor moved, deque does not relocate its elements
+    std::deque< ScratchFile > objectFiles;
+    for ( auto const & object : objects )
+    {
+        if ( !objectFiles.emplace_back( object ).valid() )
+        {
+            diagnosticsStream << "Could not create a file for the object code\n";
+            return false;
+        }
+    }
+
+#ifdef TESTS_ENABLED
+#   if __APPLE__
+    static constexpr auto linker{ "ld" };
+#   elif __linux__
+    /**
+     * Use gcc instead of ld on Linux as there seem to exist some issues when executing ld standalone.
+     */
+    static constexpr auto linker{ "gcc" };
+#   endif
+#else
+    static constexpr auto linker{ "wasm-ld" };
+#endif // TESTS_ENABLED
+
+    std::vector< llvm::StringRef > arguments
+    {
+        linker,
+#ifdef TESTS_ENABLED
+#   if __APPLE__
+        "-L/usr/lib", "-lSystem", "-syslibroot", SYSROOT_PATH,
+#   endif
+#else
+        /**
+         * Set following flags in case you want to run the WASM executable:
+         *     --entry main --allow-undefined -lc \
+         *     -L WASM_WASI_LIB_PATH              \
+         *     -L WASM_RUNTIME_LIBRARY_PATH       \
+         *     WASM_WASI_RUNTIME_PATH
+         */
+        "--no-entry", "--allow-undefined", "-lc",
+        "-L", WASM_WASI_LIB_PATH,
+        "-L", WASM_RUNTIME_LIBRARY_PATH,
+#endif // TESTS_ENABLED
+        "-o", executableFilename
+    };
+
+    for ( auto const & objectFile : objectFiles )
+    {
+        arguments.push_back( objectFile.path() );
+    }
+
+#ifdef TESTS_ENABLED
+    arguments.push_back( TESTS_RUNTIME_LIBRARY_PATH );
+#endif // TESTS_ENABLED
+
+#ifndef TESTS_ENABLED
+    for ( auto const & module : importedModules )
+    {
+        auto const it{ externalModulePaths.find( module ) };
+        if ( it == std::end( externalModulePaths ) )
+        {
+            diagnosticsStream << "Unknown module '" << module << "' could not be linked\n";
+            return false;
+        }
+        arguments.push_back( it->second );
+    }
+#else
+    static_cast< void >( importedModules );
+#endif // TESTS_ENABLED
+
+#ifdef LLD_ENABLED
+    return linkInProcess( arguments, diagnosticsStream );
+#else
+    /**
+     * Without lld, the linker executable is spawned. Native executables of the tests are linked
+     * by the system compiler driver, which knows where to find the C runtime of the host.
+     * Standard streams of the linker are redirected to the scratch file, which is read
+     * into the diagnostics once the linker fails.
+     */
+    if ( llvm::ErrorOr< std::string > path{ llvm::sys::findProgramByName( linker ) } )
+    {
+        ASSERT( llvm::sys::fs::can_execute( *path ) );
+
+        ScratchFile const messages{ {} };
+        if ( !messages.valid() )
+        {
+            diagnosticsStream << "Could not create a file for the linker messages\n";
+            return false;
+        }
+
+        llvm::Optional< llvm::StringRef > const redirects[]{ llvm::None, llvm::StringRef{ messages.path() }, llvm::StringRef{ messages.path() } };
+
+        std::string errorMessage;
+        arguments.front() = *path;
+        if ( llvm::sys::ExecuteAndWait( *path, arguments, llvm::None, redirects, 0U, 0U, &errorMessage ) != 0 )
+        {
+            if ( std::string output; messages.read( output ) ) { diagnosticsStream << output; }
+            if ( !errorMessage.empty() ) { diagnosticsStream << errorMessage << '\n'; }
+            diagnosticsStream << linker << " linker failed\n";
+            return false;
+        }
+        return true;
+    }
+
+    diagnosticsStream << linker << " linker not found in PATH\n";
+    return false;
+#endif // LLD_ENABLED
+}
+
+bool link
+(
+    std::vector< std::string_view > const & objects,
+    std::vector< std::uint8_t >           & executable,
+    std::vector< std::string >      const & importedModules,
+    std::string                           & diagnostics
+)
+{
+    /**
+     * lld writes the output into the temporary file next to it, which it renames over the output,
+     * thus its output cannot be the in-memory file, as no file can be created within '/proc'.
+     */
+#ifdef TESTS_ENABLED
+    static constexpr auto isOutputInMemory{ true };
+#else
+    static constexpr auto isOutputInMemory{ false };
+#endif // TESTS_ENABLED
+
+    ScratchFile const output{ {}, isOutputInMemory };
+    if ( !output.valid() )
+    {
+        diagnostics += "Could not create a file for the linked module\n";
+        return false;
+    }
+
+    return link( objects, output.path(), importedModules, diagnostics ) && output.read( executable );
+}
+
+} // namespace A1::LLVM
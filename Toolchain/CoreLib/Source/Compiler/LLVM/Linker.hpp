@@ -0,0 +1,48 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace A1::LLVM
+{
+
+/**
+ * Links the object code of the units of the module into the executable file, along with the runtime
+ * library and the imported modules. Objects are passed to the linker in the given order. Contracts
+ * are linked by lld within the process if the compiler is built with lld, otherwise the linker
+ * executable is spawned. Object code is never written to the current directory, the linker reads
+ * it from the scratch file, i.e. the anonymous in-memory file on Linux and the unique temporary
+ * file elsewhere, thus concurrent compilations do not clobber each other. Messages of the linker,
+ * along with the reason of the failure, are appended to the diagnostics, never printed.
+ */
+[[ nodiscard ]] bool link
+(
+    std::vector< std::string_view > const & objects,
+    std::string                     const & executableFilename,
+    std::vector< std::string >      const & importedModules,
+    std::string                           & diagnostics
+);
+
+/**
+ * Links the object code into the executable held in memory, which is read back from the scratch
+ * file the linker writes it to, i.e. the in-memory file for the linker of the host on Linux
+ * and the unique temporary file for lld, which cannot write its output in place.
+ */
+[[ nodiscard ]] bool link
+(
+    std::vector< std::string_view > const & objects,
+    std::vector< std::uint8_t >           & executable,
+    std::vector< std::string >      const & importedModules,
+    std::string                           & diagnostics
+);
+
+} // namespace A1::LLVM
@@ -27,6 +27,8 @@
 
 #include <fmt/format.h>
 
+#include <cstdint>
+#include <optional>
 #include <string_view>
 #include <string>
 #include <map>
@@ -43,12 +45,21 @@ struct Symbols final
     {
         llvm::Type  * internalType{ nullptr };
         std::size_t   index       { 0U };
+
+        /**
+         * Bool data members are packed eight per byte,
+         * in which case the byte is stored at the index.
+         */
+        std::optional< std::uint8_t > bit{};
     };
 
     struct ContractType
     {
         llvm::StructType        * internalType{ nullptr };
         Table< DataMemberType >   dataMemberTypes;
+
+        /** Class instances are values, which are created in place rather than as the global contract state. */
+        bool isClass{ false };
     };
 
     /**
@@ -0,0 +1,212 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include "Target.hpp"
+
+#if defined (__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunused-parameter"
+#   pragma clang diagnostic ignored "-Wdeprecated-enum-enum-conversion"
+#elif defined(__GNUC__) || defined(__GNUG__)
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+
+#include <llvm/IR/Module.h>
+#include <llvm/MC/TargetRegistry.h>
+#include <llvm/Passes/OptimizationLevel.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/TargetSelect.h>
+#include <llvm/Target/TargetMachine.h>
+#include <llvm/Target/TargetOptions.h>
+#include <llvm/Transforms/IPO/GlobalDCE.h>
+#include <llvm/Transforms/IPO/Internalize.h>
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#elif defined(__GNUC__) || defined(__GNUG__)
+#   pragma GCC diagnostic pop
+#endif
+
+#include <mutex>
+
+namespace A1::LLVM
+{
+
+namespace
+{
+    [[ nodiscard ]] llvm::OptimizationLevel toLLVMOptimizationLevel( Compiler::OptimizationLevel const level ) noexcept
+    {
+        switch ( level )
+        {
+            case Compiler::OptimizationLevel::O0: break;
+            case Compiler::OptimizationLevel::O1: return llvm::OptimizationLevel::O1;
+            case Compiler::OptimizationLevel::O2: return llvm::OptimizationLevel::O2;
+            case Compiler::OptimizationLevel::O3: return llvm::OptimizationLevel::O3;
+            case Compiler::OptimizationLevel::Os: return llvm::OptimizationLevel::Os;
+            case Compiler::OptimizationLevel::Oz: return llvm::OptimizationLevel::Oz;
+        }
+        return llvm::OptimizationLevel::O0;
+    }
+
+    /**
+     * Initializes the target registry with the compiled for target only, instead of all
+     * the backends LLVM is built with. Inline assembly is not supported, thus no ASM parser.
+     */
+    void initializeTarget()
+    {
+#ifdef TESTS_ENABLED
+        llvm::InitializeNativeTarget();
+        llvm::InitializeNativeTargetAsmPrinter();
+#else
+        LLVMInitializeWebAssemblyTargetInfo();
+        LLVMInitializeWebAssemblyTarget    ();
+        LLVMInitializeWebAssemblyTargetMC  ();
+        LLVMInitializeWebAssemblyAsmPrinter();
+#endif // TESTS_ENABLED
+    }
+
+    /**
+     * In order to specify the architecture we want to target, we need the
+     * target triple which has the form: '<arch><sub>-<vendor>-<sys>-<abi>'.
+     * An example of such target triple is: 'x86_64-unknown-linux-gnu'.
+     */
+    [[ nodiscard ]] std::string const & targetTriple()
+    {
+#ifdef TESTS_ENABLED
+        static auto const triple{ llvm::sys::getDefaultTargetTriple() };
+#else
+        static std::string const triple{ "wasm32-unknown-wasi" };
+#endif // TESTS_ENABLED
+        return triple;
+    }
+} // namespace
+
+struct Target::Pipeline
+{
+    /**
+     * Analysis managers are destroyed in the reverse order, module analysis manager has
+     * to go first as its proxies refer to the other analysis managers.
+     */
+    llvm::LoopAnalysisManager     loopAnalysisManager;
+    llvm::FunctionAnalysisManager functionAnalysisManager;
+    llvm::CGSCCAnalysisManager    cGSCCAnalysisManager;
+    llvm::ModuleAnalysisManager   moduleAnalysisManager;
+
+    llvm::PassBuilder       passBuilder;
+    llvm::ModulePassManager modulePassManager;
+
+    Pipeline( llvm::TargetMachine & machine, llvm::OptimizationLevel const level, std::unordered_set< std::string > const * const & exportedFunctions )
+    : passBuilder{ &machine }
+    {
+        passBuilder.registerModuleAnalyses  ( moduleAnalysisManager   );
+        passBuilder.registerCGSCCAnalyses   ( cGSCCAnalysisManager    );
+        passBuilder.registerFunctionAnalyses( functionAnalysisManager );
+        passBuilder.registerLoopAnalyses    ( loopAnalysisManager     );
+
+        passBuilder.crossRegisterProxies( loopAnalysisManager, functionAnalysisManager, cGSCCAnalysisManager, moduleAnalysisManager );
+
+        modulePassManager.addPass
+        (
+            llvm::InternalizePass
+            {
+                [ &exportedFunctions ]( llvm::GlobalValue const & value )
+                {
+                    return exportedFunctions->contains( value.getName().str() );
+                }
+            }
+        );
+        modulePassManager.addPass( llvm::GlobalDCEPass{} );
+        modulePassManager.addPass( passBuilder.buildPerModuleDefaultPipeline( level ) );
+    }
+
+    void run( llvm::Module & module_ )
+    {
+        modulePassManager.run( module_, moduleAnalysisManager );
+
+        // Cached analyses refer to the module, which is about to be destroyed
+        loopAnalysisManager    .clear();
+        functionAnalysisManager.clear();
+        cGSCCAnalysisManager   .clear();
+        moduleAnalysisManager  .clear();
+    }
+};
+
+Target * Target::get()
+{
+    static std::once_flag initialized;
+    std::call_once( initialized, initializeTarget );
+
+    thread_local std::unique_ptr< Target > target
+    {
+        []() -> std::unique_ptr< Target >
+        {
+            std::string error;
+            auto const * registered{ llvm::TargetRegistry::lookupTarget( targetTriple(), error ) };
+
+            if ( registered == nullptr )
+            {
+                /**
+                 * The requested target could not be found.
+                 * This occurs if the TargetRegistry is not initialized or the
+                 * target triple is invalid.
+                 */
+                return nullptr;
+            }
+
+            /**
+             * Generic CPU is used without any additional features.
+             */
+            auto const cpu{ "generic" };
+            auto const features{ "" };
+
+            llvm::TargetOptions options;
+            llvm::Optional< llvm::Reloc::Model > relocationModel;
+
+            std::unique_ptr< llvm::TargetMachine > machine
+            {
+                registered->createTargetMachine( targetTriple(), cpu, features, options, relocationModel )
+            };
+            return machine != nullptr ? std::unique_ptr< Target >{ new Target{ std::move( machine ) } } : nullptr;
+        }()
+    };
+    return target.get();
+}
+
+Target::Target( std::unique_ptr< llvm::TargetMachine > machine ) noexcept
+: machine_{ std::move( machine ) }
+{}
+
+Target::~Target() = default;
+
+std::string_view Target::triple() const noexcept
+{
+    return targetTriple();
+}
+
+void Target::optimize
+(
+    llvm::Module                            & module_,
+    Compiler::OptimizationLevel       const   level,
+    std::unordered_set< std::string > const & exportedFunctions
+)
+{
+    if ( level == Compiler::OptimizationLevel::O0 ) { return; }
+
+    auto & pipeline{ pipelines_[ static_cast< std::size_t >( level ) ] };
+    if ( pipeline == nullptr )
+    {
+        pipeline = std::make_unique< Pipeline >( *machine_, toLLVMOptimizationLevel( level ), exportedFunctions_ );
+    }
+
+    exportedFunctions_ = &exportedFunctions;
+    pipeline->run( module_ );
+    exportedFunctions_ = nullptr;
+}
+
+} // namespace A1::LLVM
@@ -0,0 +1,77 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <CoreLib/Compiler/Settings.hpp>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+namespace llvm
+{
+    // fwd
+    class Module;
+    class TargetMachine;
+} // namespace llvm
+
+namespace A1::LLVM
+{
+
+/**
+ * Target the modules are compiled for, i.e. the host in tests and 'wasm32-unknown-wasi' otherwise.
+ * Only the backend of that target is initialized, once per process. The target machine and
+ * the optimization pipelines are created on first use and reused by all the compilations
+ * of the thread, so that the compilation of a module costs almost nothing but the module.
+ * Each thread gets its own target, as neither the target machine nor the pass managers are
+ * safe to be shared by threads compiling at the same time.
+ */
+class Target final
+{
+public:
+    /** Returns the target of the calling thread, null if the target is not supported by LLVM. */
+    [[ nodiscard ]] static Target * get();
+
+    Target( Target const & ) = delete;
+    Target & operator=( Target const & ) = delete;
+
+    ~Target();
+
+    [[ nodiscard ]] std::string_view    triple () const noexcept;
+    [[ nodiscard ]] llvm::TargetMachine & machine() const noexcept { return *machine_; }
+
+    /**
+     * Runs the default pipeline of the new pass manager, e.g. mem2reg, inlining, GVN and DCE.
+     * Module is internalized first, all the definitions but the exported functions get the
+     * internal linkage, thus the pipeline is free to inline and remove them, whereas the
+     * contract functions, which are called only by the Adamnite VM, are preserved.
+     */
+    void optimize
+    (
+        llvm::Module                            & module_,
+        Compiler::OptimizationLevel       const   level,
+        std::unordered_set< std::string > const & exportedFunctions
+    );
+
+private:
+    struct Pipeline;
+
+    explicit Target( std::unique_ptr< llvm::TargetMachine > machine ) noexcept;
+
+    std::unique_ptr< llvm::TargetMachine > machine_;
+
+    /** Pipelines indexed by the optimization level, created on first use. */
+    std::array< std::unique_ptr< Pipeline >, static_cast< std::size_t >( Compiler::OptimizationLevel::Oz ) + 1U > pipelines_;
+
+    /** Functions preserved by the pipeline which is currently running. */
+    std::unordered_set< std::string > const * exportedFunctions_{ nullptr };
+};
+
+} // namespace A1::LLVM
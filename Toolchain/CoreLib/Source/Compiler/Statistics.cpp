@@ -0,0 +1,166 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/Compiler/Statistics.hpp>
+
+#include "Utils/Utils.hpp"
+
+#include <fmt/format.h>
+
+namespace A1::Compiler
+{
+
+namespace
+{
+    [[ nodiscard ]]
+    std::size_t heapBytes( std::string const & str ) noexcept
+    {
+        // Short strings are stored inline, within the string object itself
+        return str.capacity() > std::string{}.capacity() ? str.capacity() + 1U : 0U;
+    }
+} // namespace
+
+void Statistics::countToken( Token const & token )
+{
+    auto const kind
+    {
+        std::visit
+        (
+            Overload
+            {
+                []( ReservedToken const reservedToken ) noexcept -> std::string_view
+                {
+                    return reservedToken >= ReservedToken::KwAddress ? "keyword" : "operator";
+                },
+                []< typename T >( T const & ) noexcept -> std::string_view
+                {
+                    return T::toString();
+                }
+            },
+            token.value()
+        )
+    };
+
+    ++tokens[ kind ];
+}
+
+std::size_t Statistics::countNodes( AST::Node const & root )
+{
+    nodes.clear();
+    nodesCount = 0U;
+    astBytes   = 0U;
+
+    std::vector< AST::Node const * > stack{ &root };
+    while ( !stack.empty() )
+    {
+        auto const * node{ stack.back() };
+        stack.pop_back();
+
+        ++nodesCount;
+        astBytes += sizeof( AST::Node ) + node->children().capacity() * sizeof( AST::Node::Pointer );
+
+        auto const kind
+        {
+            std::visit
+            (
+                Overload
+                {
+                    []( AST::NodeType const type ) noexcept -> std::string_view { return AST::toString( type ); },
+                    [ & ]( Identifier const & identifier ) noexcept -> std::string_view
+                    {
+                        astBytes += heapBytes( identifier.name );
+                        return "Identifier";
+                    },
+                    [ & ]( StringLiteral const & str ) noexcept -> std::string_view
+                    {
+                        astBytes += heapBytes( str.value );
+                        return "StringLiteral";
+                    },
+                    []( TypeID        const ) noexcept -> std::string_view { return "TypeID";  },
+                    []( AST::Boolean  const ) noexcept -> std::string_view { return "Boolean"; },
+                    []( Number        const ) noexcept -> std::string_view { return "Number";  }
+                },
+                node->value()
+            )
+        };
+        ++nodes[ kind ];
+
+        for ( auto const & child : node->children() )
+        {
+            if ( child != nullptr ) { stack.push_back( child.get() ); }
+        }
+    }
+
+    return nodesCount;
+}
+
+void Statistics::record( std::string_view const name, Clock::time_point const start, std::size_t const items, std::string_view const unit )
+{
+    record( name, Clock::now() - start, items, unit );
+}
+
+void Statistics::record( std::string_view const name, Clock::duration const duration, std::size_t const items, std::string_view const unit )
+{
+    phases.push_back
+    (
+        Phase
+        {
+            .name     = name,
+            .duration = duration,
+            .items    = items,
+            .unit     = unit
+        }
+    );
+}
+
+void print( Statistics const & statistics, std::FILE * stream )
+{
+    using Milliseconds = std::chrono::duration< double, std::milli >;
+    using Seconds      = std::chrono::duration< double >;
+
+    fmt::print( stream, "\nStatistics:\n" );
+
+    fmt::print( stream, "  Phases:\n" );
+    Statistics::Clock::duration total{};
+    for ( auto const & phase : statistics.phases )
+    {
+        total += phase.duration;
+
+        auto const milliseconds{ std::chrono::duration_cast< Milliseconds >( phase.duration ).count() };
+        fmt::print( stream, "    {:<20} {:>12.3f} ms", phase.name, milliseconds );
+
+        if ( !phase.unit.empty() )
+        {
+            auto const seconds{ std::chrono::duration_cast< Seconds >( phase.duration ).count() };
+            fmt::print( stream, " {:>10} {:<14}", phase.items, phase.unit );
+            if ( seconds > 0.0 )
+            {
+                fmt::print( stream, " {:>14.0f} {}/s", static_cast< double >( phase.items ) / seconds, phase.unit );
+            }
+        }
+        fmt::print( stream, "\n" );
+    }
+    fmt::print( stream, "    {:<20} {:>12.3f} ms\n", "total", std::chrono::duration_cast< Milliseconds >( total ).count() );
+
+    fmt::print( stream, "  Tokens:\n" );
+    for ( auto const & [ kind, count ] : statistics.tokens )
+    {
+        fmt::print( stream, "    {:<28} {:>10}\n", kind, count );
+    }
+
+    fmt::print( stream, "  AST nodes: {} (~{} bytes)\n", statistics.nodesCount, statistics.astBytes );
+    for ( auto const & [ kind, count ] : statistics.nodes )
+    {
+        fmt::print( stream, "    {:<28} {:>10}\n", kind, count );
+    }
+
+    fmt::print( stream, "  LLVM IR:\n" );
+    fmt::print( stream, "    {:<28} {:>10}\n", "functions"   , statistics.llvmFunctions    );
+    fmt::print( stream, "    {:<28} {:>10}\n", "instructions", statistics.llvmInstructions );
+}
+
+} // namespace A1::Compiler
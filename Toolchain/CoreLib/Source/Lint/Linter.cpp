@@ -0,0 +1,167 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/Lint/Linter.hpp>
+
+#include "Utils/ThreadPool.hpp"
+
+#include <algorithm>
+#include <future>
+#include <tuple>
+
+namespace A1::Lint
+{
+
+namespace
+{
+    using AST::Node;
+    using AST::NodeType;
+
+    /**
+     * Diagnostics of the same position are ordered by the rule, as the rules registered
+     * for different node types report them in the order the nodes are visited in.
+     */
+    void sortByPosition( std::vector< Diagnostic > & diagnostics )
+    {
+        std::stable_sort
+        (
+            std::begin( diagnostics ),
+            std::end  ( diagnostics ),
+            []( Diagnostic const & lhs, Diagnostic const & rhs ) noexcept
+            {
+                return
+                    std::tie( lhs.errorInfo.lineNumber, lhs.errorInfo.columnNumber, lhs.rule ) <
+                    std::tie( rhs.errorInfo.lineNumber, rhs.errorInfo.columnNumber, rhs.rule );
+            }
+        );
+    }
+} // namespace
+
+void Linter::addRule( std::unique_ptr< Rule > rule )
+{
+    for ( auto const type : rule->nodeTypes() )
+    {
+        auto & rules{ dispatchTable_[ static_cast< std::size_t >( type ) ] };
+        if ( std::find( std::begin( rules ), std::end( rules ), rule.get() ) == std::end( rules ) )
+        {
+            rules.push_back( rule.get() );
+        }
+    }
+    rules_.push_back( std::move( rule ) );
+}
+
+void Linter::dispatch( Node const & node, Reporter & reporter ) const
+{
+    if ( node.is_not< NodeType >() ) { return; }
+
+    for ( auto const * rule : dispatchTable_[ static_cast< std::size_t >( node.get< NodeType >() ) ] )
+    {
+        reporter.rule_ = rule->name();
+        rule->check( node, reporter );
+    }
+}
+
+std::vector< Diagnostic > Linter::run( Node const & root, AST::NodeIndex const * index, std::size_t const threadsCount ) const
+{
+    std::vector< Diagnostic > diagnostics;
+    Reporter reporter{ diagnostics };
+
+    if ( index != nullptr )
+    {
+        for ( auto i{ 0U }; i < std::size( dispatchTable_ ); ++i )
+        {
+            if ( dispatchTable_[ i ].empty() ) { continue; }
+
+            for ( auto const * node : index->find( static_cast< NodeType >( i ) ) )
+            {
+                dispatch( *node, reporter );
+            }
+        }
+
+        sortByPosition( diagnostics );
+        return diagnostics;
+    }
+
+    auto const lintSubtree
+    {
+        [ this ]( Node const & subtree, Reporter & subtreeReporter )
+        {
+            std::vector< Node const * > stack{ &subtree };
+            while ( !stack.empty() )
+            {
+                auto const * node{ stack.back() };
+                stack.pop_back();
+
+                dispatch( *node, subtreeReporter );
+
+                auto const & children{ node->children() };
+                for ( auto it{ std::rbegin( children ) }; it != std::rend( children ); ++it )
+                {
+                    if ( *it != nullptr ) { stack.push_back( it->get() ); }
+                }
+            }
+        }
+    };
+
+    auto const isModule{ root.is< NodeType >() && root.get< NodeType >() == NodeType::ModuleDefinition };
+    if ( !isModule || threadsCount <= 1U )
+    {
+        lintSubtree( root, reporter );
+
+        sortByPosition( diagnostics );
+        return diagnostics;
+    }
+
+    /**
+     * Top-level definitions do not share any nodes, thus each one of them is
+     * linted as a separate task, into its own list of diagnostics.
+     */
+    dispatch( root, reporter );
+
+    std::vector< Node const * > definitions;
+    for ( auto const & child : root.children() )
+    {
+        if ( child != nullptr ) { definitions.push_back( child.get() ); }
+    }
+
+    ThreadPool threadPool{ std::min( threadsCount, std::max< std::size_t >( std::size( definitions ), 1U ) ) };
+
+    std::vector< std::future< std::vector< Diagnostic > > > results;
+    results.reserve( std::size( definitions ) );
+    for ( auto const * definition : definitions )
+    {
+        results.push_back
+        (
+            threadPool.submit
+            (
+                [ &lintSubtree, definition ]
+                {
+                    std::vector< Diagnostic > definitionDiagnostics;
+                    Reporter definitionReporter{ definitionDiagnostics };
+                    lintSubtree( *definition, definitionReporter );
+                    return definitionDiagnostics;
+                }
+            )
+        );
+    }
+
+    for ( auto & result : results )
+    {
+        auto definitionDiagnostics{ result.get() };
+        diagnostics.insert
+        (
+            std::end( diagnostics ),
+            std::make_move_iterator( std::begin( definitionDiagnostics ) ),
+            std::make_move_iterator( std::end  ( definitionDiagnostics ) )
+        );
+    }
+
+    sortByPosition( diagnostics );
+    return diagnostics;
+}
+
+} // namespace A1::Lint
@@ -0,0 +1,254 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/Lint/Linter.hpp>
+
+#include <fmt/format.h>
+
+#include <unordered_map>
+#include <unordered_set>
+
+namespace A1::Lint
+{
+
+namespace
+{
+    using AST::Node;
+    using AST::NodeType;
+
+    [[ nodiscard ]]
+    bool is( Node const * node, NodeType const type ) noexcept
+    {
+        return node != nullptr && node->is< NodeType >() && node->get< NodeType >() == type;
+    }
+
+    /**
+     * Name of the variable, function, contract etc. being defined,
+     * which is the first child of the definition node.
+     */
+    [[ nodiscard ]]
+    std::string_view definedName( Node const & definition ) noexcept
+    {
+        auto const & children{ definition.children() };
+        if ( children.empty() || children[ 0U ] == nullptr || children[ 0U ]->is_not< Identifier >() ) { return {}; }
+        return children[ 0U ]->get< Identifier >().name;
+    }
+
+    /**
+     * Checks whether the identifier refers to a variable, rather than
+     * introducing a new name or naming a member of a contract.
+     */
+    [[ nodiscard ]]
+    bool isReference( Node const & identifier ) noexcept
+    {
+        auto const * parent{ identifier.parent() };
+        if ( parent == nullptr ) { return true; }
+
+        auto const isFirstChild{ parent->children()[ 0U ].get() == &identifier };
+        if
+        (
+            isFirstChild &&
+            (
+                is( parent, NodeType::VariableDefinition          ) ||
+                is( parent, NodeType::FunctionParameterDefinition ) ||
+                is( parent, NodeType::FunctionDefinition          )
+            )
+        )
+        {
+            return false;
+        }
+        return !( is( parent, NodeType::MemberCall ) && !isFirstChild );
+    }
+
+    [[ nodiscard ]]
+    bool isScope( Node const * node ) noexcept
+    {
+        return is( node, NodeType::ContractDefinition ) || is( node, NodeType::ClassDefinition );
+    }
+
+    struct UnusedVariableRule final : Rule
+    {
+        [[ nodiscard ]] std::string_view name() const noexcept override { return "unused-variable"; }
+
+        [[ nodiscard ]] std::vector< NodeType > nodeTypes() const override { return { NodeType::FunctionDefinition }; }
+
+        /**
+         * Variables are function scoped, thus they can be referenced anywhere within the function.
+         * Definitions and references are collected in a single walk over the function.
+         */
+        void check( Node const & function, Reporter & reporter ) const override
+        {
+            std::vector< Node const * >            definitions;
+            std::unordered_set< std::string_view > references;
+
+            std::vector< Node const * > stack{ &function };
+            while ( !stack.empty() )
+            {
+                auto const * current{ stack.back() };
+                stack.pop_back();
+
+                if ( current->is< Identifier >() && isReference( *current ) )
+                {
+                    references.insert( current->get< Identifier >().name );
+                }
+                else if ( is( current, NodeType::VariableDefinition ) && !definedName( *current ).empty() )
+                {
+                    definitions.push_back( current );
+                }
+
+                for ( auto const & child : current->children() )
+                {
+                    // Nested functions and contracts are checked on their own
+                    if ( child != nullptr && !is( child.get(), NodeType::FunctionDefinition ) && !isScope( child.get() ) )
+                    {
+                        stack.push_back( child.get() );
+                    }
+                }
+            }
+
+            for ( auto const * definition : definitions )
+            {
+                if ( auto const variable{ definedName( *definition ) }; !references.contains( variable ) )
+                {
+                    reporter.report( *definition, fmt::format( "Variable '{}' is never used", variable ) );
+                }
+            }
+        }
+    };
+
+    struct ShadowedNameRule final : Rule
+    {
+        [[ nodiscard ]] std::string_view name() const noexcept override { return "shadowed-name"; }
+
+        [[ nodiscard ]] std::vector< NodeType > nodeTypes() const override { return { NodeType::ModuleDefinition }; }
+
+        /**
+         * Module-level names are collected once, then the variables of all the functions,
+         * including the ones of the contracts, are checked in a single walk over the module.
+         */
+        void check( Node const & module, Reporter & reporter ) const override
+        {
+            std::unordered_map< std::string_view, std::size_t > moduleNames;
+            for ( auto const & definition : module.children() )
+            {
+                if
+                (
+                    is( definition.get(), NodeType::VariableDefinition ) ||
+                    is( definition.get(), NodeType::FunctionDefinition ) ||
+                    isScope( definition.get() )
+                )
+                {
+                    ++moduleNames[ definedName( *definition ) ];
+                }
+            }
+
+            struct Visit
+            {
+                Node const * node;
+                Node const * function;
+            };
+
+            std::vector< Visit > stack{ { &module, nullptr } };
+            while ( !stack.empty() )
+            {
+                auto const [ current, function ]{ stack.back() };
+                stack.pop_back();
+
+                if ( function != nullptr && is( current, NodeType::VariableDefinition ) )
+                {
+                    check( *current, *function, module, moduleNames, reporter );
+                }
+
+                auto const * childFunction
+                {
+                    is( current, NodeType::FunctionDefinition ) ? current : isScope( current ) ? nullptr : function
+                };
+                for ( auto const & child : current->children() )
+                {
+                    if ( child != nullptr ) { stack.push_back( { child.get(), childFunction } ); }
+                }
+            }
+        }
+
+    private:
+        static void check
+        (
+            Node                                                const & variableDefinition,
+            Node                                                const & function,
+            Node                                                const & module,
+            std::unordered_map< std::string_view, std::size_t > const & moduleNames,
+            Reporter                                                  & reporter
+        )
+        {
+            auto const variable{ definedName( variableDefinition ) };
+            if ( variable.empty() ) { return; }
+
+            for ( auto const & child : function.children() )
+            {
+                if ( is( child.get(), NodeType::FunctionParameterDefinition ) && definedName( *child ) == variable )
+                {
+                    reporter.report( variableDefinition, fmt::format( "Variable '{}' shadows the function parameter", variable ) );
+                    return;
+                }
+            }
+
+            // Module-level function does not shadow its own variables
+            auto const it{ moduleNames.find( variable ) };
+            auto const isOwnName{ function.parent() == &module && definedName( function ) == variable };
+            if ( it != std::end( moduleNames ) && it->second > ( isOwnName ? 1U : 0U ) )
+            {
+                reporter.report( variableDefinition, fmt::format( "Variable '{}' shadows the module-level definition", variable ) );
+            }
+        }
+    };
+
+    struct MissingInitRule final : Rule
+    {
+        [[ nodiscard ]] std::string_view name() const noexcept override { return "missing-init"; }
+
+        [[ nodiscard ]] std::vector< NodeType > nodeTypes() const override { return { NodeType::ContractDefinition }; }
+
+        void check( Node const & node, Reporter & reporter ) const override
+        {
+            auto hasUninitializedMembers{ false };
+            for ( auto const & child : node.children() )
+            {
+                if ( is( child.get(), NodeType::FunctionDefinition ) && definedName( *child ) == "__init__" )
+                {
+                    return;
+                }
+
+                if ( is( child.get(), NodeType::VariableDefinition ) )
+                {
+                    // Data member is either [ name, type ] or [ name, type, value ] or [ name, value ]
+                    auto const & definition{ child->children() };
+                    hasUninitializedMembers |= std::size( definition ) < 2U || definition.back()->is< TypeID >();
+                }
+            }
+
+            if ( hasUninitializedMembers )
+            {
+                reporter.report
+                (
+                    node,
+                    fmt::format( "Contract '{}' has data members without initial values, but no '__init__' function", definedName( node ) )
+                );
+            }
+        }
+    };
+} // namespace
+
+std::vector< std::unique_ptr< Rule > > builtinRules()
+{
+    std::vector< std::unique_ptr< Rule > > rules;
+    rules.push_back( std::make_unique< UnusedVariableRule >() );
+    rules.push_back( std::make_unique< ShadowedNameRule   >() );
+    rules.push_back( std::make_unique< MissingInitRule    >() );
+    return rules;
+}
+
+} // namespace A1::Lint
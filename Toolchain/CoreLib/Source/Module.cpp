@@ -6,15 +6,25 @@
  */
 
 #include <CoreLib/AST/AST.hpp>
+#include <CoreLib/AST/ASTOptimizer.hpp>
 #include <CoreLib/AST/ASTPrinter.hpp>
+#include <CoreLib/Compiler/Cache.hpp>
 #include <CoreLib/Compiler/Compiler.hpp>
 #include <CoreLib/Module.hpp>
 #include <CoreLib/Tokenizer/Tokenizer.hpp>
 #include <CoreLib/Utils/Stream.hpp>
 
+#include "Utils/ThreadPool.hpp"
+
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <future>
+#include <map>
 #include <memory>
+#include <optional>
+#include <set>
+#include <vector>
 
 namespace A1
 {
@@ -22,15 +32,131 @@ namespace A1
 namespace
 {
     using FilePtr = std::unique_ptr< std::FILE, decltype( &std::fclose ) >;
+    using Path    = std::filesystem::path;
 
     /**
      * A1 programming language requires its source files
      * to have '.ao' extension.
      */
     constexpr auto requiredFileExtension{ ".ao" };
+
+    struct ParsedModule
+    {
+        AST::Node::Pointer root;
+
+        /**
+         * Modules imported from the source files found next to the importing one,
+         * mapped from the name used in the import statement to the module path.
+         * Other imports, e.g. 'core', are left to the linker.
+         */
+        std::map< std::string, Path, std::less<> > imports;
+
+        /** Paths the other imports have been looked up at, none of which has been found. */
+        std::vector< Path > unresolvedImports;
+    };
+
+    [[ nodiscard ]]
+    FilePtr open( Path const & path )
+    {
+        if ( FilePtr f{ std::fopen( path.c_str(), "r" ), &std::fclose }; f != nullptr )
+        {
+            return f;
+        }
+        throw std::runtime_error( fmt::format( "File '{}' not found", path.filename().string() ) );
+    }
+
+    /**
+     * Makes the path unique, so that the module imported from different
+     * modules, possibly through different relative paths, is parsed once.
+     */
+    [[ nodiscard ]]
+    Path normalize( Path const & path )
+    {
+        std::error_code errorCode;
+        auto canonical{ std::filesystem::weakly_canonical( path, errorCode ) };
+        return errorCode ? path.lexically_normal() : canonical;
+    }
+
+    [[ nodiscard ]]
+    std::string_view importedModuleName( AST::Node::Pointer const & node ) noexcept
+    {
+        if
+        (
+            node != nullptr &&
+            node->is< AST::NodeType >() && node->get< AST::NodeType >() == AST::NodeType::StatementImport &&
+            std::size( node->children() ) == 1U && node->children()[ 0U ]->is< Identifier >()
+        )
+        {
+            return node->children()[ 0U ]->get< Identifier >().name;
+        }
+        return {};
+    }
+
+    [[ nodiscard ]]
+    ParsedModule parseFile( Path const & path )
+    {
+        auto f    { open( path ) };
+        auto token{ tokenize( Stream{ f.get() } ) };
+
+        ParsedModule module{ .root = AST::parse( token ), .imports = {}, .unresolvedImports = {} };
+        for ( auto const & statement : module.root->children() )
+        {
+            if ( auto const name{ importedModuleName( statement ) }; !name.empty() )
+            {
+                auto importedPath{ path.parent_path() / name };
+                importedPath += requiredFileExtension;
+
+                if ( std::filesystem::is_regular_file( importedPath ) )
+                {
+                    module.imports.emplace( name, normalize( importedPath ) );
+                }
+                else
+                {
+                    module.unresolvedImports.push_back( normalize( importedPath ) );
+                }
+            }
+        }
+        return module;
+    }
+
+    /**
+     * Orders the modules so that each module comes after all the modules it imports.
+     */
+    void sortTopologically
+    (
+        Path const & path,
+        std::map< Path, ParsedModule > const & modules,
+        std::map< Path, bool > & visited, // Set to true once all the imports are sorted
+        std::vector< Path > & order
+    )
+    {
+        if ( auto const it{ visited.find( path ) }; it != std::end( visited ) )
+        {
+            if ( !it->second )
+            {
+                throw std::runtime_error( fmt::format( "Module '{}' is imported circularly", path.filename().string() ) );
+            }
+            return;
+        }
+
+        visited[ path ] = false;
+        for ( auto const & [ name, importedPath ] : modules.at( path ).imports )
+        {
+            sortTopologically( importedPath, modules, visited, order );
+        }
+        visited[ path ] = true;
+
+        order.push_back( path );
+    }
 } // namespace
 
-bool load( Compiler::Settings settings, std::filesystem::path const inputFile )
+AST::Node::Pointer parseModule
+(
+    std::filesystem::path const inputFile,
+    Compiler::Statistics * statistics,
+    std::vector< std::filesystem::path > * importedFiles,
+    std::vector< std::filesystem::path > * unresolvedImports
+)
 {
     if ( inputFile.extension() != requiredFileExtension )
     {
@@ -45,26 +171,255 @@ bool load( Compiler::Settings settings, std::filesystem::path const inputFile )
         );
     }
 
-    if ( FilePtr f{ std::fopen( inputFile.c_str(), "r" ), &std::fclose }; f != nullptr )
+    using Clock = Compiler::Statistics::Clock;
+
+    auto const start   { Clock::now() };
+    auto const mainPath{ normalize( inputFile ) };
+
+    std::map< Path, ParsedModule > modules;
+    modules.emplace( mainPath, parseFile( mainPath ) );
+
+    /**
+     * Imported modules are parsed level by level, where modules of the same level
+     * do not depend on each other and are parsed in parallel. Module imported from
+     * multiple places, e.g. in case of diamond imports, is parsed only once.
+     */
+    std::optional< ThreadPool > threadPool;
+
+    std::set< Path > pending;
+    for ( auto const & [ name, path ] : modules.at( mainPath ).imports ) { pending.insert( path ); }
+
+    while ( !pending.empty() )
+    {
+        if ( !threadPool ) { threadPool.emplace(); }
+
+        std::vector< std::pair< Path, std::future< ParsedModule > > > results;
+        for ( auto const & path : pending )
+        {
+            results.emplace_back( path, threadPool->submit( [ path ]{ return parseFile( path ); } ) );
+        }
+        pending.clear();
+
+        for ( auto & [ path, result ] : results )
+        {
+            modules.emplace( path, result.get() );
+        }
+
+        for ( auto const & [ path, result ] : results )
+        {
+            for ( auto const & [ name, importedPath ] : modules.at( path ).imports )
+            {
+                if ( !modules.contains( importedPath ) ) { pending.insert( importedPath ); }
+            }
+        }
+    }
+
+    if ( importedFiles != nullptr )
+    {
+        for ( auto const & [ path, module ] : modules )
+        {
+            if ( path != mainPath ) { importedFiles->push_back( path ); }
+        }
+    }
+
+    if ( unresolvedImports != nullptr )
+    {
+        for ( auto const & [ path, module ] : modules )
+        {
+            for ( auto const & importPath : module.unresolvedImports )
+            {
+                if ( std::find( std::begin( *unresolvedImports ), std::end( *unresolvedImports ), importPath ) == std::end( *unresolvedImports ) )
+                {
+                    unresolvedImports->push_back( importPath );
+                }
+            }
+        }
+    }
+
+    AST::Node::Pointer rootNode;
+    if ( modules.size() == 1U )
+    {
+        rootNode = std::move( modules.at( mainPath ).root );
+    }
+    else
+    {
+        std::map< Path, bool > visited;
+        std::vector< Path >    order;
+        sortTopologically( mainPath, modules, visited, order );
+
+        /**
+         * Modules are merged into a single one, with the statements of the imported
+         * modules preceding the statements of the modules importing them.
+         */
+        std::vector< AST::Node::Pointer > statements;
+        for ( auto const & path : order )
+        {
+            auto & module{ modules.at( path ) };
+            for ( auto & statement : module.root->releaseChildren() )
+            {
+                if ( auto const name{ importedModuleName( statement ) }; module.imports.contains( name ) )
+                {
+                    continue;
+                }
+                statements.push_back( std::move( statement ) );
+            }
+        }
+
+        rootNode = std::make_unique< AST::Node >
+        (
+            AST::NodeType::ModuleDefinition,
+            std::move( statements ),
+            modules.at( mainPath ).root->errorInfo()
+        );
+    }
+
+    if ( statistics != nullptr )
+    {
+        auto const parsing{ Clock::now() - start };
+
+        /**
+         * Tokens are produced on demand while parsing, thus they are counted in a separate pass
+         * over the main module and the imported ones in order to time tokenization alone.
+         */
+        auto const tokenizationStart{ Clock::now() };
+
+        std::size_t tokensCount{ 0U };
+        for ( auto const & [ path, module ] : modules )
+        {
+            auto const f{ open( path ) };
+            for ( auto it{ tokenize( Stream{ f.get() } ) }; it->is_not< Eof >(); ++it )
+            {
+                statistics->countToken( *it );
+                ++tokensCount;
+            }
+        }
+
+        statistics->record( "tokenization", tokenizationStart, tokensCount, "tokens" );
+        statistics->record( "parsing", parsing, statistics->countNodes( *rootNode ), "nodes" );
+    }
+
+    return rootNode;
+}
+
+bool load( Compiler::Settings settings, std::filesystem::path const inputFile )
+{
+    using Clock = Compiler::Statistics::Clock;
+
+    auto * statistics{ settings.statistics };
+
+    // AST and LLVM IR are written out by the compilation itself, thus it cannot be skipped
+    auto * cache{ settings.outputAST || settings.outputIR ? nullptr : settings.cache };
+
+    std::optional< std::string > cacheKey;
+    if ( cache != nullptr )
+    {
+        auto const start{ Clock::now() };
+
+        cacheKey = cache->key( settings, inputFile );
+        auto const hit{ cacheKey && cache->restore( *cacheKey, inputFile, settings.executableFilename ) };
+
+        if ( statistics != nullptr )
+        {
+            statistics->record( hit ? "cache hit" : "cache miss", start );
+        }
+        if ( hit ) { return true; }
+    }
+
+    std::vector< std::filesystem::path > importedFiles;
+    std::vector< std::filesystem::path > unresolvedImports;
+    auto rootNode{ parseModule( inputFile, statistics, &importedFiles, &unresolvedImports ) };
+
+    auto start{ Clock::now() };
+    rootNode = AST::optimize( std::move( rootNode ) );
+    if ( statistics != nullptr )
     {
-        auto token   { tokenize( Stream{ f.get() } ) };
-        auto rootNode{ AST::parse( token ) };
+        // Nodes are counted once the phase is timed, the count takes a walk over the whole AST
+        auto const optimization{ Clock::now() - start };
+        statistics->record( "optimization", optimization, statistics->countNodes( *rootNode ), "nodes" );
+    }
 
-        if ( settings.outputAST )
+    if ( settings.outputAST )
+    {
+        // Machine-readable formats are written without any decoration
+        if ( settings.astFormat == AST::PrintFormat::Text )
         {
             std::printf( "\nAST:\n" );
             AST::print( rootNode );
             std::printf( "\n" );
         }
+        else
+        {
+            std::fflush( stdout );
+            AST::print( rootNode, stdout, settings.astFormat );
+            std::fflush( stdout );
+        }
+    }
+
+    auto const executableFilename{ settings.executableFilename };
+    if ( !compile( std::move( settings ), rootNode ) ) { return false; }
+
+    if ( cacheKey )
+    {
+        start = Clock::now();
+        cache->store( *cacheKey, inputFile, importedFiles, unresolvedImports, executableFilename );
+        if ( statistics != nullptr )
+        {
+            statistics->record( "cache store", start );
+        }
+    }
+    return true;
+}
+
+std::vector< LoadResult > loadAll
+(
+    Compiler::Settings      const & settings,
+    std::vector< LoadJob >  const & jobs,
+    std::size_t             const   workersCount
+)
+{
+    auto const loadJob
+    {
+        [ &settings ]( LoadJob const & job )
+        {
+            LoadResult result;
+            result.inputFile = job.inputFile;
+
+            auto jobSettings{ settings };
+            jobSettings.executableFilename = job.executableFilename;
+            if ( settings.statistics != nullptr ) { jobSettings.statistics = &result.statistics; }
+
+            try
+            {
+                if ( !load( std::move( jobSettings ), job.inputFile ) ) { result.error = "Compilation failed"; }
+            }
+            catch ( std::exception const & ex )
+            {
+                result.error = ex.what();
+            }
+            return result;
+        }
+    };
+
+    std::vector< LoadResult > results;
+    results.reserve( std::size( jobs ) );
 
-        return compile( std::move( settings ), rootNode );
+    if ( workersCount <= 1U || std::size( jobs ) <= 1U )
+    {
+        for ( auto const & job : jobs ) { results.push_back( loadJob( job ) ); }
+        return results;
     }
-    else
+
+    ThreadPool threadPool{ std::min( workersCount, std::size( jobs ) ) };
+
+    std::vector< std::future< LoadResult > > futures;
+    futures.reserve( std::size( jobs ) );
+    for ( auto const & job : jobs )
     {
-        throw std::runtime_error( fmt::format( "File '{}' not found", inputFile.filename().string() ) );
+        futures.push_back( threadPool.submit( [ &loadJob, &job ]{ return loadJob( job ); } ) );
     }
 
-    return false;
+    for ( auto & future : futures ) { results.push_back( future.get() ); }
+    return results;
 }
 
-} // namespace A1
\ No newline at end of file
+} // namespace A1
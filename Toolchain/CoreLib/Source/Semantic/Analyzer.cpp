@@ -0,0 +1,939 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/Errors/SemanticError.hpp>
+#include <CoreLib/Semantic/Analyzer.hpp>
+
+#include "Utils/Utils.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace A1::Semantic
+{
+
+namespace
+{
+    using AST::Node;
+    using AST::NodeType;
+
+    /** Built-in values and functions of the runtime, e.g. 'balances[address]' or 'caller_address()'. */
+    constexpr std::array< std::string_view, 4U > runtimeBuiltIns
+    {
+        "balances", "block_timestamp", "caller_address", "contract_address"
+    };
+
+    /** Built-in functions of the compiler, see CodegenBuiltin.cpp. */
+    constexpr std::array< std::string_view, 5U > builtInFunctions
+    {
+        "abort", "is_utf8", "len", "memcmp", "print"
+    };
+
+    [[ nodiscard ]]
+    bool contains( auto const & names, std::string_view const name ) noexcept
+    {
+        return std::find( std::begin( names ), std::end( names ), name ) != std::end( names );
+    }
+
+    /**
+     * Type of the value the built-in function returns, as it is lowered by the code generation,
+     * null if it returns nothing. Length is typed by the analysis of its argument instead.
+     */
+    [[ nodiscard ]]
+    TypeID getBuiltInReturnTypeID( std::string_view const name ) noexcept
+    {
+        if ( name == "caller_address" || name == "contract_address" ) { return Registry::getAddressHandle(); }
+        if ( name == "block_timestamp"                              ) { return Registry::getU64Handle    (); }
+        if ( name == "is_utf8"                                      ) { return Registry::getI64Handle    (); }
+        if ( name == "memcmp"                                       ) { return Registry::getI32Handle    (); }
+        return nullptr;
+    }
+
+    [[ nodiscard ]]
+    bool is( Node::Pointer const & node, NodeType const type ) noexcept
+    {
+        return node != nullptr && node->is< NodeType >() && node->get< NodeType >() == type;
+    }
+
+    [[ nodiscard ]]
+    bool isArithmetic( NodeType const type ) noexcept
+    {
+        return type >= NodeType::Exponent && type <= NodeType::BitwiseNot;
+    }
+
+    [[ nodiscard ]]
+    bool isComparison( NodeType const type ) noexcept
+    {
+        return type >= NodeType::Equality && type <= NodeType::IsNotIdentical;
+    }
+
+    [[ nodiscard ]]
+    bool isAssignment( NodeType const type ) noexcept
+    {
+        return type >= NodeType::Assign && type <= NodeType::AssignBitwiseXor;
+    }
+
+    /**
+     * Values of unknown type are compatible with any other value,
+     * since they are checked at the later phases.
+     */
+    [[ nodiscard ]]
+    bool areCompatible( TypeID const lhs, TypeID const rhs ) noexcept
+    {
+        return
+            lhs == nullptr || rhs == nullptr || lhs == rhs ||
+            ( Registry::isNumeric( lhs ) && Registry::isNumeric( rhs ) );
+    }
+
+    /**
+     * Map keys are hashed by their bytes, thus keys are limited to the fixed-size
+     * types, which are passed to the runtime by value.
+     */
+    [[ nodiscard ]]
+    bool isMapKey( TypeID const typeID ) noexcept
+    {
+        return typeID == Registry::getAddressHandle() || ( Registry::isNumeric( typeID ) && !Registry::isWide( typeID ) );
+    }
+
+    /**
+     * Operands of the same sized integer type keep their type, operation involving
+     * 256-bit integer results in its type, since num cannot hold the result, and
+     * any other combination of numeric operands results in num.
+     */
+    [[ nodiscard ]]
+    TypeID getArithmeticType( TypeID const lhs, TypeID const rhs ) noexcept
+    {
+        if ( lhs == nullptr || rhs == nullptr ) { return nullptr; }
+
+             if ( Registry::isWide( lhs ) ) { return lhs; }
+        else if ( Registry::isWide( rhs ) ) { return rhs; }
+
+        return lhs == rhs && lhs != Registry::getBoolHandle() ? lhs : Registry::getNumHandle();
+    }
+
+    [[ nodiscard ]]
+    TypeID getLiteralType( Node::Pointer const & node ) noexcept
+    {
+             if ( node->is< AST::Boolean  >() ) { return Registry::getBoolHandle(); }
+        else if ( node->is< Number        >() ) { return Registry::getNumHandle (); }
+        else if ( node->is< StringLiteral >() ) { return Registry::getStrHandle (); }
+        else if ( node->is< TypeID        >() ) { return node->get< TypeID >();     }
+
+        return nullptr;
+    }
+
+    [[ nodiscard ]]
+    std::string_view getName( Node::Pointer const & node ) noexcept
+    {
+        return node != nullptr && node->is< Identifier >() ? std::string_view{ node->get< Identifier >().name } : std::string_view{};
+    }
+
+    [[ nodiscard ]]
+    bool isColumnar( TypeID const typeID ) noexcept
+    {
+        auto const * array{ typeID != nullptr ? std::get_if< ArrayType >( typeID ) : nullptr };
+        return array != nullptr && array->layout == ArrayLayout::StructOfArrays;
+    }
+
+    /** Strings are indexed and sliced by the offsets of their bytes. */
+    void checkStringIndex( Node const & index, TypeID const typeID )
+    {
+        if ( typeID != nullptr && !Registry::isNumeric( typeID ) )
+        {
+            throw SemanticError
+            {
+                index.errorInfo(),
+                fmt::format( "Cannot index string by value of type '{}'", Registry::toStringView( typeID ) )
+            };
+        }
+    }
+
+    class Analyzer
+    {
+    public:
+        [[ nodiscard ]]
+        SymbolTable analyze( Node & moduleNode )
+        {
+            declare( moduleNode );
+
+            for ( auto const & node : moduleNode.children() )
+            {
+                if ( node != nullptr ) { analyzeStatement( *node ); }
+            }
+            return std::move( symbols_ );
+        }
+
+    private:
+        using Scope = std::unordered_map< std::string, TypeID >;
+
+        /**
+         * Gathers signatures of all the functions and contracts up front,
+         * so that they can be referenced before their definition.
+         */
+        void declare( Node const & moduleNode )
+        {
+            for ( auto const & node : moduleNode.children() )
+            {
+                if ( is( node, NodeType::FunctionDefinition ) )
+                {
+                    declareFunction( *node, symbols_.functions, nullptr );
+                }
+                else if ( is( node, NodeType::ContractDefinition ) || is( node, NodeType::ClassDefinition ) )
+                {
+                    declareContract( *node );
+                }
+            }
+        }
+
+        void declareContract( Node const & node )
+        {
+            auto const & children{ node.children() };
+            auto const   name    { getName( children[ 0U ] ) };
+
+            if ( symbols_.contracts.contains( name ) )
+            {
+                throw SemanticError{ node.errorInfo(), fmt::format( "Contract '{}' is already defined", name ) };
+            }
+
+            auto & contract{ symbols_.contracts[ std::string{ name } ] };
+            contract.typeID = Registry::getContractHandle( name );
+
+            for ( auto i{ 1U }; i < std::size( children ); ++i )
+            {
+                auto const & child{ children[ i ] };
+                if ( is( child, NodeType::VariableDefinition ) )
+                {
+                    auto const & definition{ child->children() };
+
+                    // Type of the data member is either declared or deduced from the initial value
+                    contract.dataMembers[ std::string{ getName( definition[ 0U ] ) } ] =
+                    {
+                        .typeID = getLiteralType( definition[ 1U ] ),
+                        .index  = std::size( contract.dataMembers )
+                    };
+                }
+                else if ( is( child, NodeType::FunctionDefinition ) )
+                {
+                    declareFunction( *child, contract.functions, contract.typeID );
+                }
+            }
+        }
+
+        void declareFunction( Node const & node, SymbolTable::Table< SymbolTable::Function > & functions, TypeID const contractTypeID )
+        {
+            auto const & children{ node.children() };
+            auto const   name    { getName( children[ 0U ] ) };
+
+            if ( functions.contains( name ) )
+            {
+                throw SemanticError{ node.errorInfo(), fmt::format( "Function '{}' is already defined", name ) };
+            }
+
+            SymbolTable::Function function;
+            for ( auto i{ 1U }; i < std::size( children ); ++i )
+            {
+                auto const & child{ children[ i ] };
+                if ( is( child, NodeType::FunctionParameterDefinition ) )
+                {
+                    auto const & parameter{ child->children() };
+
+                    // Only 'self' parameter of the contract's function is allowed to omit the type
+                    function.parameters.push_back
+                    ({
+                        .name   = std::string{ getName( parameter[ 0U ] ) },
+                        .typeID = std::size( parameter ) > 1U ? parameter[ 1U ]->get< TypeID >() : contractTypeID
+                    });
+                }
+                else if ( child->is< TypeID >() )
+                {
+                    function.returnTypeID = child->get< TypeID >();
+                }
+            }
+
+            functions[ std::string{ name } ] = std::move( function );
+        }
+
+        void analyzeStatement( Node & node )
+        {
+            if ( node.is_not< NodeType >() )
+            {
+                analyzeExpression( node );
+                return;
+            }
+
+            auto const & children{ node.children() };
+            switch ( node.get< NodeType >() )
+            {
+                case NodeType::FunctionDefinition:
+                {
+                    auto const & function{ symbols_.functions.at( std::string{ getName( children[ 0U ] ) } ) };
+                    analyzeFunction( node, function );
+                    break;
+                }
+                case NodeType::ContractDefinition:
+                case NodeType::ClassDefinition:
+                {
+                    analyzeContract( node );
+                    break;
+                }
+                case NodeType::VariableDefinition:
+                {
+                    analyzeVariableDefinition( node );
+                    break;
+                }
+                case NodeType::StatementIf:
+                case NodeType::StatementElif:
+                case NodeType::StatementWhile:
+                {
+                    analyzeExpression( *children[ 0U ] );
+                    for ( auto i{ 1U }; i < std::size( children ); ++i )
+                    {
+                        analyzeStatement( *children[ i ] );
+                    }
+                    break;
+                }
+                case NodeType::StatementElse:
+                {
+                    for ( auto const & child : children )
+                    {
+                        analyzeStatement( *child );
+                    }
+                    break;
+                }
+                case NodeType::StatementReturn:
+                {
+                    if ( children.empty() ) { break; }
+
+                    auto const typeID{ analyzeExpression( *children[ 0U ] ) };
+                    if ( currentFunction_ != nullptr && !areCompatible( currentFunction_->returnTypeID, typeID ) )
+                    {
+                        throw SemanticError
+                        {
+                            children[ 0U ]->errorInfo(),
+                            fmt::format
+                            (
+                                "Cannot return value of type '{}' from function returning '{}'",
+                                Registry::toStringView( typeID ),
+                                Registry::toStringView( currentFunction_->returnTypeID )
+                            )
+                        };
+                    }
+                    break;
+                }
+                case NodeType::StatementImport:
+                case NodeType::StatementPass:
+                {
+                    break;
+                }
+                default:
+                {
+                    analyzeExpression( node );
+                    break;
+                }
+            }
+        }
+
+        void analyzeContract( Node & node )
+        {
+            auto const & children{ node.children() };
+            auto const & contract{ symbols_.contracts.at( std::string{ getName( children[ 0U ] ) } ) };
+
+            currentContract_ = &contract;
+            for ( auto i{ 1U }; i < std::size( children ); ++i )
+            {
+                auto const & child{ children[ i ] };
+                if ( is( child, NodeType::FunctionDefinition ) )
+                {
+                    analyzeFunction( *child, contract.functions.at( std::string{ getName( child->children()[ 0U ] ) } ) );
+                }
+                else if ( is( child, NodeType::VariableDefinition ) )
+                {
+                    // Data members are initialized out of any scope
+                    auto scope{ std::exchange( scope_, {} ) };
+                    analyzeVariableDefinition( *child );
+                    scope_ = std::move( scope );
+                }
+            }
+            currentContract_ = nullptr;
+        }
+
+        void analyzeFunction( Node & node, SymbolTable::Function const & function )
+        {
+            auto scope{ std::exchange( scope_, {} ) };
+            for ( auto const & parameter : function.parameters )
+            {
+                scope_[ parameter.name ] = parameter.typeID;
+            }
+
+            currentFunction_ = &function;
+            for ( auto const & child : node.children() )
+            {
+                if ( is( child, NodeType::FunctionParameterDefinition ) || child->is< Identifier >() || child->is< TypeID >() ) { continue; }
+                analyzeStatement( *child );
+            }
+            currentFunction_ = nullptr;
+
+            scope_ = std::move( scope );
+        }
+
+        void analyzeVariableDefinition( Node & node )
+        {
+            auto const & children{ node.children() };
+            auto const   name    { getName( children[ 0U ] ) };
+
+            TypeID declaredTypeID{ nullptr };
+            TypeID typeID        { nullptr };
+
+            for ( auto i{ 1U }; i < std::size( children ); ++i )
+            {
+                if ( children[ i ]->is< TypeID >() )
+                {
+                    declaredTypeID = children[ i ]->get< TypeID >();
+                    if ( auto const * map{ std::get_if< MapType >( declaredTypeID ) }; map != nullptr && !isMapKey( map->keyTypeID ) )
+                    {
+                        throw SemanticError
+                        {
+                            children[ i ]->errorInfo(),
+                            fmt::format( "Map key of type '{}' is not supported", Registry::toStringView( map->keyTypeID ) )
+                        };
+                    }
+                    if ( isColumnar( declaredTypeID ) && !symbols_.contracts.contains( Registry::toStringView( std::get< ArrayType >( *declaredTypeID ).innerTypeID ) ) )
+                    {
+                        throw SemanticError
+                        {
+                            children[ i ]->errorInfo(),
+                            fmt::format( "Array of type '{}' is not supported, struct-of-arrays layout requires class elements", Registry::toStringView( declaredTypeID ) )
+                        };
+                    }
+                }
+                else
+                {
+                    typeID = analyzeExpression( *children[ i ] );
+                    if ( !areCompatible( declaredTypeID, typeID ) )
+                    {
+                        throw SemanticError
+                        {
+                            children[ i ]->errorInfo(),
+                            fmt::format
+                            (
+                                "Cannot initialize variable '{}' of type '{}' with value of type '{}'",
+                                name,
+                                Registry::toStringView( declaredTypeID ),
+                                Registry::toStringView( typeID )
+                            )
+                        };
+                    }
+                }
+            }
+
+            if ( declaredTypeID != nullptr ) { typeID = declaredTypeID; }
+
+            children[ 0U ]->typeID( typeID );
+            scope_[ std::string{ name } ] = typeID;
+        }
+
+        TypeID analyzeExpression( Node & node )
+        {
+            auto const typeID
+            {
+                std::visit
+                (
+                    Overload
+                    {
+                        [ &, this ]( NodeType      const   type       ) { return analyzeOperation( node, type ); },
+                        [ &, this ]( Identifier    const & identifier ) { return lookup( node, identifier.name ); },
+                        [         ]( TypeID        const              ) { return TypeID{ nullptr }; },
+                        [         ]( AST::Boolean  const              ) { return Registry::getBoolHandle(); },
+                        [         ]( Number        const              ) { return Registry::getNumHandle (); },
+                        [         ]( StringLiteral const &            ) { return Registry::getStrHandle (); }
+                    },
+                    node.value()
+                )
+            };
+
+            node.typeID( typeID );
+            return typeID;
+        }
+
+        TypeID analyzeOperation( Node & node, NodeType const type )
+        {
+            auto const & children{ node.children() };
+
+            if ( isArithmetic( type ) )
+            {
+                TypeID typeID{ nullptr };
+                for ( auto const & child : children )
+                {
+                    auto const operandTypeID{ analyzeExpression( *child ) };
+                    if ( operandTypeID != nullptr && !Registry::isNumeric( operandTypeID ) )
+                    {
+                        throw SemanticError
+                        {
+                            child->errorInfo(),
+                            fmt::format( "Arithmetic operation cannot be applied to value of type '{}'", Registry::toStringView( operandTypeID ) )
+                        };
+                    }
+                    typeID = typeID == nullptr ? operandTypeID : getArithmeticType( typeID, operandTypeID );
+                }
+                return std::size( children ) == 1U ? getArithmeticType( typeID, typeID ) : typeID;
+            }
+            else if ( isComparison( type ) )
+            {
+                auto const lhs{ analyzeExpression( *children[ 0U ] ) };
+                auto const rhs{ analyzeExpression( *children[ 1U ] ) };
+
+                if ( !areCompatible( lhs, rhs ) )
+                {
+                    throw SemanticError
+                    {
+                        node.errorInfo(),
+                        fmt::format( "Cannot compare values of types '{}' and '{}'", Registry::toStringView( lhs ), Registry::toStringView( rhs ) )
+                    };
+                }
+                if
+                (
+                    ( lhs == Registry::getStrHandle() || rhs == Registry::getStrHandle() ) &&
+                    type != NodeType::Equality && type != NodeType::Inequality
+                )
+                {
+                    throw SemanticError{ node.errorInfo(), "Strings are compared for equality only" };
+                }
+                return Registry::getBoolHandle();
+            }
+            else if ( isAssignment( type ) )
+            {
+                auto const lhs{ analyzeExpression( *children[ 0U ] ) };
+                auto const rhs{ analyzeExpression( *children[ 1U ] ) };
+
+                checkAssignable( children[ 0U ] );
+
+                auto const isCompatible
+                {
+                    type == NodeType::Assign
+                        ? areCompatible( lhs, rhs )
+                        : ( lhs == nullptr || Registry::isNumeric( lhs ) ) && ( rhs == nullptr || Registry::isNumeric( rhs ) )
+                };
+
+                if ( !isCompatible )
+                {
+                    throw SemanticError
+                    {
+                        node.errorInfo(),
+                        fmt::format( "Cannot assign value of type '{}' to '{}'", Registry::toStringView( rhs ), Registry::toStringView( lhs ) )
+                    };
+                }
+                return lhs;
+            }
+
+            switch ( type )
+            {
+                case NodeType::Parentheses:
+                {
+                    TypeID typeID{ nullptr };
+                    for ( auto const & child : children )
+                    {
+                        typeID = analyzeExpression( *child );
+                    }
+                    return std::size( children ) == 1U ? typeID : nullptr;
+                }
+                case NodeType::LogicalNot:
+                case NodeType::LogicalAnd:
+                case NodeType::LogicalOr:
+                case NodeType::IsMemberOf:
+                case NodeType::IsNotMemberOf:
+                {
+                    for ( auto const & child : children )
+                    {
+                        analyzeExpression( *child );
+                    }
+                    return Registry::getBoolHandle();
+                }
+                case NodeType::Call      : return analyzeCall      ( node );
+                case NodeType::MemberCall: return analyzeMemberCall( node );
+                case NodeType::Index     : return analyzeIndex     ( node, false /* isDataMemberAccess */ );
+                case NodeType::Slice     : return analyzeSlice     ( node );
+                default:
+                {
+                    for ( auto const & child : children )
+                    {
+                        if ( child != nullptr ) { analyzeExpression( *child ); }
+                    }
+                    return nullptr;
+                }
+            }
+        }
+
+        TypeID analyzeCall( Node & node )
+        {
+            auto const & children{ node.children() };
+            auto const   name    { getName( children[ 0U ] ) };
+
+            if ( auto const contract{ symbols_.contracts.find( name ) }; contract != std::end( symbols_.contracts ) )
+            {
+                analyzeArguments( node, 1U );
+                return contract->second.typeID;
+            }
+
+            SymbolTable::Function const * function{ nullptr };
+            if ( currentContract_ != nullptr )
+            {
+                if ( auto const it{ currentContract_->functions.find( name ) }; it != std::end( currentContract_->functions ) ) { function = &it->second; }
+            }
+            if ( function == nullptr )
+            {
+                if ( auto const it{ symbols_.functions.find( name ) }; it != std::end( symbols_.functions ) ) { function = &it->second; }
+            }
+
+            if ( function == nullptr )
+            {
+                if ( !contains( builtInFunctions, name ) && !contains( runtimeBuiltIns, name ) )
+                {
+                    throw SemanticError{ children[ 0U ]->errorInfo(), fmt::format( "Unknown function '{}'", name ) };
+                }
+
+                analyzeArguments( node, 1U );
+                if ( name == "print" && std::size( children ) == 2U )
+                {
+                    checkPrintable( *children[ 1U ] );
+                }
+                if ( name == "len" && std::size( children ) == 2U )
+                {
+                    auto const argumentTypeID{ children[ 1U ]->typeID() };
+                    if
+                    (
+                        argumentTypeID != nullptr &&
+                        ( std::holds_alternative< ArrayType >( *argumentTypeID ) || argumentTypeID == Registry::getStrHandle() )
+                    )
+                    {
+                        return Registry::getU64Handle();
+                    }
+                }
+                return getBuiltInReturnTypeID( name );
+            }
+
+            checkArguments( node, name, *function, 1U, 0U );
+            return function->returnTypeID;
+        }
+
+        TypeID analyzeMemberCall( Node & node )
+        {
+            auto const & children{ node.children() };
+            auto const   typeID
+            {
+                is( children[ 0U ], NodeType::Index ) && children[ 1U ]->is< Identifier >()
+                    ? analyzeIndex     ( *children[ 0U ], true /* isDataMemberAccess */ )
+                    : analyzeExpression( *children[ 0U ] )
+            };
+            children[ 0U ]->typeID( typeID );
+            auto const & member  { children[ 1U ] };
+
+            if ( auto const * array{ typeID != nullptr ? std::get_if< ArrayType >( typeID ) : nullptr }; array != nullptr && is( member, NodeType::Call ) )
+            {
+                analyzeAppend( *member, *array, typeID );
+                return nullptr;
+            }
+
+            SymbolTable::Contract const * contract{ nullptr };
+            if ( typeID != nullptr && std::holds_alternative< ContractType >( *typeID ) )
+            {
+                if ( auto const it{ symbols_.contracts.find( Registry::toStringView( typeID ) ) }; it != std::end( symbols_.contracts ) )
+                {
+                    contract = &it->second;
+                }
+            }
+
+            if ( member->is< Identifier >() )
+            {
+                if ( contract == nullptr ) { return nullptr; }
+
+                auto const & name{ member->get< Identifier >().name };
+                if ( auto const it{ contract->dataMembers.find( name ) }; it != std::end( contract->dataMembers ) )
+                {
+                    member->typeID( it->second.typeID );
+                    return it->second.typeID;
+                }
+                throw SemanticError
+                {
+                    member->errorInfo(),
+                    fmt::format( "Contract '{}' has no data member '{}'", Registry::toStringView( typeID ), name )
+                };
+            }
+            else if ( is( member, NodeType::Call ) )
+            {
+                if ( contract == nullptr )
+                {
+                    analyzeArguments( *member, 1U );
+                    return nullptr;
+                }
+
+                auto const name{ getName( member->children()[ 0U ] ) };
+                if ( auto const it{ contract->functions.find( name ) }; it != std::end( contract->functions ) )
+                {
+                    // Contract instance is passed implicitly as 'self' parameter
+                    auto const & parameters{ it->second.parameters };
+                    auto const   hasSelf   { !parameters.empty() && parameters[ 0U ].name == "self" };
+
+                    checkArguments( *member, name, it->second, 1U, hasSelf ? 1U : 0U );
+                    member->typeID( it->second.returnTypeID );
+                    return it->second.returnTypeID;
+                }
+                throw SemanticError
+                {
+                    member->errorInfo(),
+                    fmt::format( "Contract '{}' has no function '{}'", Registry::toStringView( typeID ), name )
+                };
+            }
+
+            analyzeExpression( *member );
+            return nullptr;
+        }
+
+        /**
+         * Element of the struct-of-arrays array is spread over the columns, thus it is only
+         * accessed by its data member, e.g. 'proposals[i].count', which is read from the column.
+         */
+        TypeID analyzeIndex( Node & node, bool const isDataMemberAccess )
+        {
+            auto const & children{ node.children() };
+
+            auto const baseTypeID{ analyzeExpression( *children[ 0U ] ) };
+            auto const keyTypeID { analyzeExpression( *children[ 1U ] ) };
+
+            if ( baseTypeID != nullptr )
+            {
+                if ( baseTypeID == Registry::getStrHandle() )
+                {
+                    // Subscript of the string is its byte
+                    checkStringIndex( *children[ 1U ], keyTypeID );
+                    return Registry::getU8Handle();
+                }
+                if ( auto const * array{ std::get_if< ArrayType >( baseTypeID ) } )
+                {
+                    if ( array->layout == ArrayLayout::StructOfArrays && !isDataMemberAccess )
+                    {
+                        throw SemanticError
+                        {
+                            node.errorInfo(),
+                            fmt::format( "Element of array of type '{}' is accessed by its data members only", Registry::toStringView( baseTypeID ) )
+                        };
+                    }
+                    if ( keyTypeID != nullptr && !Registry::isNumeric( keyTypeID ) )
+                    {
+                        throw SemanticError
+                        {
+                            children[ 1U ]->errorInfo(),
+                            fmt::format( "Cannot index array by value of type '{}'", Registry::toStringView( keyTypeID ) )
+                        };
+                    }
+                    return array->innerTypeID;
+                }
+                if ( auto const * map  { std::get_if< MapType   >( baseTypeID ) } )
+                {
+                    if ( !areCompatible( map->keyTypeID, keyTypeID ) )
+                    {
+                        throw SemanticError
+                        {
+                            children[ 1U ]->errorInfo(),
+                            fmt::format
+                            (
+                                "Cannot index map with key of type '{}' by value of type '{}'",
+                                Registry::toStringView( map->keyTypeID ),
+                                Registry::toStringView( keyTypeID )
+                            )
+                        };
+                    }
+                    return map->valueTypeID;
+                }
+            }
+
+            // Balance of the account is read by the runtime, which holds it as 64-bit integer
+            return getName( children[ 0U ] ) == "balances" ? Registry::getU64Handle() : nullptr;
+        }
+
+        /** Numbers and strings are printed, there is no format for the values of the other types. */
+        static void checkPrintable( Node const & argument )
+        {
+            auto const typeID{ argument.typeID() };
+            if ( Registry::isNumeric( typeID ) || typeID == Registry::getStrHandle() ) { return; }
+
+            throw SemanticError
+            {
+                argument.errorInfo(),
+                typeID == nullptr
+                    ? std::string{ "Cannot print value of unknown type" }
+                    : fmt::format( "Cannot print value of type '{}'", Registry::toStringView( typeID ) )
+            };
+        }
+
+        /** Slice of the string is the string, which shares the bytes of the sliced one. */
+        TypeID analyzeSlice( Node & node )
+        {
+            auto const & children{ node.children() };
+
+            auto const baseTypeID{ analyzeExpression( *children[ 0U ] ) };
+            checkStringIndex( *children[ 1U ], analyzeExpression( *children[ 1U ] ) );
+            checkStringIndex( *children[ 2U ], analyzeExpression( *children[ 2U ] ) );
+
+            if ( baseTypeID != nullptr && baseTypeID != Registry::getStrHandle() )
+            {
+                throw SemanticError
+                {
+                    children[ 0U ]->errorInfo(),
+                    fmt::format( "Cannot slice value of type '{}'", Registry::toStringView( baseTypeID ) )
+                };
+            }
+            return Registry::getStrHandle();
+        }
+
+        /** Array has the only function, 'append', which takes the element. */
+        void analyzeAppend( Node & member, ArrayType const & array, TypeID const typeID )
+        {
+            auto const & children{ member.children() };
+            auto const   name    { getName( children[ 0U ] ) };
+            if ( name != "append" )
+            {
+                throw SemanticError
+                {
+                    member.errorInfo(),
+                    fmt::format( "Type '{}' has no function '{}'", Registry::toStringView( typeID ), name )
+                };
+            }
+
+            if ( std::size( children ) != 2U )
+            {
+                throw SemanticError
+                {
+                    member.errorInfo(),
+                    fmt::format( "Function '{}' expects {} argument(s) ({} given)", name, 1U, std::size( children ) - 1U )
+                };
+            }
+
+            if ( auto const elementTypeID{ analyzeExpression( *children[ 1U ] ) }; !areCompatible( array.innerTypeID, elementTypeID ) )
+            {
+                throw SemanticError
+                {
+                    children[ 1U ]->errorInfo(),
+                    fmt::format( "Cannot append value of type '{}' to '{}'", Registry::toStringView( elementTypeID ), Registry::toStringView( typeID ) )
+                };
+            }
+        }
+
+        /**
+         * Value is stored into the variable, the data member or the element of the array or the map,
+         * whereas the strings are immutable and any other expression has no storage to write to.
+         */
+        void checkAssignable( Node::Pointer const & target ) const
+        {
+            auto const isAssignable
+            {
+                target->is< Identifier >() ||
+                ( is( target, NodeType::MemberCall ) && target->children()[ 1U ]->is< Identifier >() ) ||
+                ( is( target, NodeType::Index      ) && target->children()[ 0U ]->typeID() != Registry::getStrHandle() )
+            };
+
+            if ( !isAssignable )
+            {
+                throw SemanticError{ target->errorInfo(), "Left-hand side of the assignment is not assignable" };
+            }
+        }
+
+        void analyzeArguments( Node & node, std::size_t const first )
+        {
+            auto const & children{ node.children() };
+            for ( auto i{ first }; i < std::size( children ); ++i )
+            {
+                analyzeExpression( *children[ i ] );
+            }
+        }
+
+        void checkArguments
+        (
+            Node                        & node,
+            std::string_view      const   name,
+            SymbolTable::Function const & function,
+            std::size_t           const   firstArgument,
+            std::size_t           const   firstParameter
+        )
+        {
+            auto const & children      { node.children() };
+            auto const   argumentsCount{ std::size( children ) - firstArgument };
+            auto const   expectedCount { std::size( function.parameters ) - firstParameter };
+
+            // Callee is typed with its signature, which tells the code generator the types of the parameters
+            std::vector< TypeID > parameterTypeIDs;
+            for ( auto const & parameter : function.parameters ) { parameterTypeIDs.push_back( parameter.typeID ); }
+            children[ 0U ]->typeID( Registry::getFunctionHandle( function.returnTypeID, parameterTypeIDs ) );
+
+            if ( argumentsCount != expectedCount )
+            {
+                throw SemanticError
+                {
+                    node.errorInfo(),
+                    fmt::format( "Function '{}' expects {} argument(s) ({} given)", name, expectedCount, argumentsCount )
+                };
+            }
+
+            for ( std::size_t i{ 0U }; i < argumentsCount; ++i )
+            {
+                auto const & argument { children[ firstArgument + i ] };
+                auto const & parameter{ function.parameters[ firstParameter + i ] };
+
+                auto const typeID{ analyzeExpression( *argument ) };
+                if ( !areCompatible( parameter.typeID, typeID ) )
+                {
+                    throw SemanticError
+                    {
+                        argument->errorInfo(),
+                        fmt::format
+                        (
+                            "Cannot pass value of type '{}' as parameter '{}' of type '{}'",
+                            Registry::toStringView( typeID ),
+                            parameter.name,
+                            Registry::toStringView( parameter.typeID )
+                        )
+                    };
+                }
+            }
+        }
+
+        /**
+         * Any name other than the built-in value of the runtime has to be defined before its use.
+         */
+        [[ nodiscard ]]
+        TypeID lookup( Node const & node, std::string_view const name ) const
+        {
+            if ( auto const it{ scope_.find( std::string{ name } ) }; it != std::end( scope_ ) ) { return it->second; }
+            if ( contains( runtimeBuiltIns, name ) ) { return nullptr; }
+
+            throw SemanticError{ node.errorInfo(), fmt::format( "Unknown identifier '{}'", name ) };
+        }
+
+        SymbolTable symbols_;
+
+        /**
+         * Variables visible in the module's top level or in the function's body, since
+         * A1 has no block scope and functions do not see the module's variables.
+         */
+        Scope scope_;
+
+        SymbolTable::Contract const * currentContract_{ nullptr };
+        SymbolTable::Function const * currentFunction_{ nullptr };
+    };
+} // namespace
+
+SymbolTable analyze( AST::Node & moduleNode )
+{
+    return Analyzer{}.analyze( moduleNode );
+}
+
+} // namespace A1::Semantic
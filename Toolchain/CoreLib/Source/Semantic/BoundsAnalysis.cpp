@@ -0,0 +1,276 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/Semantic/BoundsAnalysis.hpp>
+#include <CoreLib/Types.hpp>
+
+#include <map>
+#include <optional>
+#include <string_view>
+
+namespace A1::Semantic
+{
+
+namespace
+{
+    using AST::Node;
+    using AST::NodeType;
+
+    [[ nodiscard ]]
+    bool is( Node const & node, NodeType const type ) noexcept
+    {
+        return node.is< NodeType >() && node.get< NodeType >() == type;
+    }
+
+    [[ nodiscard ]]
+    bool isWrite( Node const & node ) noexcept
+    {
+        return node.is< NodeType >() && node.get< NodeType >() >= NodeType::Assign && node.get< NodeType >() <= NodeType::AssignBitwiseXor;
+    }
+
+    [[ nodiscard ]]
+    std::string_view getName( Node const & node ) noexcept
+    {
+        return node.is< Identifier >() ? std::string_view{ node.get< Identifier >().name } : std::string_view{};
+    }
+
+    [[ nodiscard ]]
+    bool isNonNegativeInteger( Node const & node ) noexcept
+    {
+        return node.is< Number >() && node.get< Number >().decimals == 0U && node.get< Number >().value >= 0;
+    }
+
+    /**
+     * Incremented index stays non-negative, unless its type wraps around to negative values
+     * in practice, i.e. the signed type narrower than 64 bits. Unannotated variables are num,
+     * or are narrowed by the width inference only to the types which hold all their values.
+     */
+    [[ nodiscard ]]
+    bool keepsNonNegative( TypeID const type ) noexcept
+    {
+        return
+            type == nullptr || !Registry::isSigned( type ) ||
+            type == Registry::getNumHandle() || type == Registry::getI64Handle() || type == Registry::getI256Handle();
+    }
+
+    /** Array is either a variable, e.g. 'values', or a data member, e.g. 'self.values'. */
+    [[ nodiscard ]]
+    bool isArray( Node const & node ) noexcept
+    {
+        if ( node.is< Identifier >() ) { return true; }
+
+        auto const & children{ node.children() };
+        return is( node, NodeType::MemberCall ) && std::size( children ) == 2U && children[ 0U ]->is< Identifier >() && children[ 1U ]->is< Identifier >();
+    }
+
+    /** Loop condition 'i < len(A)' bounds the subscripts 'A[i]'. */
+    struct Bound
+    {
+        std::string_view   index;
+        Node       const * array{ nullptr };
+    };
+
+    /**
+     * Analyzes a single scope, i.e. the module's top-level statements or the function's
+     * body, as A1 has no block scope and functions do not see the module's variables.
+     */
+    class ScopeAnalysis
+    {
+    public:
+        explicit ScopeAnalysis( std::unordered_set< Node const * > & subscripts ) noexcept
+        : subscripts_{ subscripts }
+        {}
+
+        void run( Node const & scope )
+        {
+            for ( auto const & child : scope.children() )
+            {
+                if ( child != nullptr ) { collect( *child ); }
+            }
+
+            for ( auto const & child : scope.children() )
+            {
+                if ( child != nullptr ) { visit( *child ); }
+            }
+        }
+
+    private:
+        std::unordered_set< Node const * > & subscripts_;
+
+        /** Variables of the scope, mapped to whether they are never negative. */
+        std::map< std::string_view, bool > nonNegative_;
+
+        void collect( Node const & node )
+        {
+            if ( is( node, NodeType::FunctionDefinition ) || is( node, NodeType::ContractDefinition ) ) { return; }
+
+            auto const & children{ node.children() };
+            if ( is( node, NodeType::FunctionParameterDefinition ) )
+            {
+                // Arguments may be negative
+                nonNegative_[ getName( *children[ 0U ] ) ] = false;
+            }
+            else if ( is( node, NodeType::VariableDefinition ) )
+            {
+                // Variable annotated without initialization is zero-initialized
+                auto const name      { getName( *children[ 0U ] ) };
+                auto const init      { children.back().get() };
+                auto const annotation{ std::size( children ) > 1U && children[ 1U ]->is< TypeID >() ? children[ 1U ]->get< TypeID >() : nullptr };
+                auto const isNonNegative{ ( init->is< TypeID >() || isNonNegativeInteger( *init ) ) && keepsNonNegative( annotation ) };
+
+                // Redefined variables are not analyzed
+                auto const [ it, isInserted ]{ nonNegative_.try_emplace( name, isNonNegative ) };
+                if ( !isInserted ) { it->second = false; }
+            }
+            else if ( isWrite( node ) && std::size( children ) == 2U )
+            {
+                auto const isIncrement
+                {
+                    ( is( node, NodeType::Assign ) || is( node, NodeType::AssignAddition ) ) && isNonNegativeInteger( *children[ 1U ] )
+                };
+                if ( !isIncrement )
+                {
+                    nonNegative_[ getName( *children[ 0U ] ) ] = false;
+                }
+                else
+                {
+                    // Variable defined by the assignment is analyzed as if it was defined by 'let'
+                    nonNegative_.try_emplace( getName( *children[ 0U ] ), true );
+                }
+            }
+
+            for ( auto const & child : children )
+            {
+                if ( child != nullptr ) { collect( *child ); }
+            }
+        }
+
+        void visit( Node const & node )
+        {
+            if ( is( node, NodeType::FunctionDefinition ) || is( node, NodeType::ContractDefinition ) ) { return; }
+
+            if ( is( node, NodeType::StatementWhile ) ) { analyzeLoop( node ); }
+
+            for ( auto const & child : node.children() )
+            {
+                if ( child != nullptr ) { visit( *child ); }
+            }
+        }
+
+        void analyzeLoop( Node const & loop )
+        {
+            auto const & children{ loop.children() };
+
+            auto const bound{ getBound( *children[ 0U ] ) };
+            if ( !bound ) { return; }
+
+            // Bound holds at the beginning of each iteration, up to the first statement which may break it
+            for ( auto i{ 1U }; i < std::size( children ); ++i )
+            {
+                if ( children[ i ] == nullptr ) { continue; }
+                if ( breaks( *children[ i ], *bound ) ) { break; }
+
+                mark( *children[ i ], *bound );
+            }
+        }
+
+        [[ nodiscard ]]
+        std::optional< Bound > getBound( Node const & condition ) const
+        {
+            auto const & operands{ condition.children() };
+            if ( std::size( operands ) != 2U ) { return std::nullopt; }
+
+            Node const * index { nullptr };
+            Node const * length{ nullptr };
+
+                 if ( is( condition, NodeType::LessThan    ) ) { index = operands[ 0U ].get(); length = operands[ 1U ].get(); }
+            else if ( is( condition, NodeType::GreaterThan ) ) { index = operands[ 1U ].get(); length = operands[ 0U ].get(); }
+            else { return std::nullopt; }
+
+            auto const it{ nonNegative_.find( getName( *index ) ) };
+            if ( it == std::end( nonNegative_ ) || !it->second ) { return std::nullopt; }
+
+            auto const & call{ length->children() };
+            if ( !is( *length, NodeType::Call ) || std::size( call ) != 2U || getName( *call[ 0U ] ) != "len" || !isArray( *call[ 1U ] ) )
+            {
+                return std::nullopt;
+            }
+            return Bound{ .index = it->first, .array = call[ 1U ].get() };
+        }
+
+        [[ nodiscard ]]
+        static bool breaks( Node const & node, Bound const & bound )
+        {
+            auto const & children{ node.children() };
+            if ( isWrite( node ) && !children.empty() )
+            {
+                if ( getName( *children[ 0U ] ) == bound.index || AST::equal( *children[ 0U ], *bound.array ) ) { return true; }
+            }
+            else if ( is( node, NodeType::VariableDefinition ) )
+            {
+                auto const name{ getName( *children[ 0U ] ) };
+                if ( name == bound.index || name == getName( *bound.array ) ) { return true; }
+            }
+            else if ( is( node, NodeType::Call ) && !children.empty() )
+            {
+                if ( auto const name{ getName( *children[ 0U ] ) }; name != "len" && name != "print" ) { return true; }
+            }
+            else if ( is( node, NodeType::MemberCall ) && std::size( children ) == 2U && is( *children[ 1U ], NodeType::Call ) )
+            {
+                if ( getName( *children[ 1U ]->children()[ 0U ] ) != "append" ) { return true; }
+            }
+
+            for ( auto const & child : children )
+            {
+                if ( child != nullptr && breaks( *child, bound ) ) { return true; }
+            }
+            return false;
+        }
+
+        void mark( Node const & node, Bound const & bound )
+        {
+            auto const & children{ node.children() };
+            if ( is( node, NodeType::Index ) && std::size( children ) == 2U )
+            {
+                if ( getName( *children[ 1U ] ) == bound.index && AST::equal( *children[ 0U ], *bound.array ) )
+                {
+                    subscripts_.insert( &node );
+                }
+            }
+
+            for ( auto const & child : children )
+            {
+                if ( child != nullptr ) { mark( *child, bound ); }
+            }
+        }
+    };
+
+    void analyzeScopes( Node const & node, std::unordered_set< Node const * > & subscripts )
+    {
+        if ( is( node, NodeType::ModuleDefinition ) || is( node, NodeType::FunctionDefinition ) )
+        {
+            ScopeAnalysis{ subscripts }.run( node );
+        }
+
+        for ( auto const & child : node.children() )
+        {
+            if ( child != nullptr && ( is( *child, NodeType::ContractDefinition ) || is( *child, NodeType::FunctionDefinition ) ) )
+            {
+                analyzeScopes( *child, subscripts );
+            }
+        }
+    }
+} // namespace
+
+std::unordered_set< AST::Node const * > findInBoundsSubscripts( AST::Node const & moduleNode )
+{
+    std::unordered_set< AST::Node const * > subscripts;
+    analyzeScopes( moduleNode, subscripts );
+    return subscripts;
+}
+
+} // namespace A1::Semantic
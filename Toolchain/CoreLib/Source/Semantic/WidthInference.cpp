@@ -0,0 +1,303 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/Semantic/WidthInference.hpp>
+#include <CoreLib/Types.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace A1::Semantic
+{
+
+namespace
+{
+    using AST::Node;
+    using AST::NodeType;
+
+    using Value = Number::Type;
+
+    /**
+     * Values beyond 32 bits are not worth narrowing, limiting
+     * the ranges also keeps the bounds arithmetic from overflowing.
+     */
+    constexpr Value minValue{ std::numeric_limits< std::int32_t >::min() };
+    constexpr Value maxValue{ std::numeric_limits< std::int32_t >::max() };
+
+    [[ nodiscard ]]
+    bool is( Node const & node, NodeType const type ) noexcept
+    {
+        return node.is< NodeType >() && node.get< NodeType >() == type;
+    }
+
+    [[ nodiscard ]]
+    std::string_view getName( Node const & node ) noexcept
+    {
+        return node.is< Identifier >() ? std::string_view{ node.get< Identifier >().name } : std::string_view{};
+    }
+
+    /** Value of the integer literal, possibly negated. Decimal literals are not integers, even if their fraction is zero. */
+    [[ nodiscard ]]
+    std::optional< Value > getConstant( Node const & node ) noexcept
+    {
+        if ( node.is< Number >() && node.get< Number >().decimals == 0U ) { return node.get< Number >().value; }
+
+        if ( is( node, NodeType::UnaryMinus ) && std::size( node.children() ) == 1U )
+        {
+            if ( auto const value{ getConstant( *node.children()[ 0U ] ) }; value && node.children()[ 0U ]->is< Number >() ) { return -*value; }
+        }
+        return std::nullopt;
+    }
+
+    struct Range
+    {
+        Value min{ 0 };
+        Value max{ 0 };
+
+        bool isBounded{ true };
+
+        void include( Value const value ) noexcept
+        {
+            min = std::min( min, value );
+            max = std::max( max, value );
+            if ( min < minValue || max > maxValue ) { isBounded = false; }
+        }
+    };
+
+    [[ nodiscard ]]
+    TypeID getNarrowestType( Range const & range ) noexcept
+    {
+        if ( !range.isBounded ) { return nullptr; }
+
+        auto const fits{ [ &range ]< typename T >( T ) { return range.min >= std::numeric_limits< T >::min() && range.max <= std::numeric_limits< T >::max(); } };
+
+             if ( fits( std::int8_t { 0 } ) ) { return Registry::getI8Handle (); }
+        else if ( fits( std::int16_t{ 0 } ) ) { return Registry::getI16Handle(); }
+        else if ( fits( std::int32_t{ 0 } ) ) { return Registry::getI32Handle(); }
+
+        return nullptr;
+    }
+
+    /**
+     * Infers widths of the variables of a single scope, i.e. of the module's
+     * top-level statements or of the function's body. Nested functions are
+     * separate scopes, as their local variables are not visible outside of them.
+     */
+    class ScopeInference
+    {
+    public:
+        void run( Node & scope )
+        {
+            for ( auto const & child : scope.children() )
+            {
+                if ( child != nullptr ) { visit( *child ); }
+            }
+
+            // Loop condition bounds the variable only if the loop does not otherwise write to it
+            for ( auto const & [ loop, name ] : boundedLoopWrites_ )
+            {
+                if ( loopWritesCount_[ { loop, name } ] != 1U )
+                {
+                    variables_[ name ].range.isBounded = false;
+                }
+            }
+
+            for ( auto & [ name, variable ] : variables_ )
+            {
+                if ( auto const typeID{ getNarrowestType( variable.range ) }; typeID != nullptr )
+                {
+                    variable.identifier->typeID( typeID );
+                }
+            }
+        }
+
+    private:
+        struct Variable
+        {
+            Node  * identifier{ nullptr };
+            Range   range     {};
+        };
+
+        using LoopWrite = std::pair< Node const *, std::string_view >;
+
+        std::map< std::string_view, Variable > variables_;
+
+        std::vector< Node const * > loops_;
+
+        std::vector< LoopWrite >          boundedLoopWrites_;
+        std::map< LoopWrite, std::size_t > loopWritesCount_;
+
+        void visit( Node & node )
+        {
+            if ( is( node, NodeType::FunctionDefinition ) || is( node, NodeType::ContractDefinition ) ) { return; }
+
+            if ( is( node, NodeType::VariableDefinition ) )
+            {
+                define( node );
+            }
+            else if ( node.is< NodeType >() && node.get< NodeType >() >= NodeType::Assign && node.get< NodeType >() <= NodeType::AssignBitwiseXor )
+            {
+                write( node );
+            }
+
+            auto const isLoop{ is( node, NodeType::StatementWhile ) };
+            if ( isLoop ) { loops_.push_back( &node ); }
+
+            for ( auto const & child : node.children() )
+            {
+                if ( child != nullptr ) { visit( *child ); }
+            }
+
+            if ( isLoop ) { loops_.pop_back(); }
+        }
+
+        void define( Node & node )
+        {
+            auto const & children{ node.children() };
+            auto const   name    { getName( *children[ 0U ] ) };
+
+            if ( auto const it{ variables_.find( name ) }; it != std::end( variables_ ) )
+            {
+                // Redefined variables are left as they are
+                it->second.range.isBounded = false;
+                return;
+            }
+
+            // Only variables without type annotation, initialized with integer literal, are narrowed
+            if ( std::size( children ) != 2U ) { return; }
+
+            if ( auto const value{ getConstant( *children[ 1U ] ) } )
+            {
+                variables_[ name ] =
+                {
+                    .identifier = children[ 0U ].get(),
+                    .range      = { .min = *value, .max = *value, .isBounded = *value >= minValue && *value <= maxValue }
+                };
+            }
+        }
+
+        void write( Node const & node )
+        {
+            auto const & children{ node.children() };
+            if ( std::size( children ) != 2U ) { return; }
+
+            auto const name{ getName( *children[ 0U ] ) };
+            auto const it  { variables_.find( name ) };
+            if ( it == std::end( variables_ ) ) { return; }
+
+            auto & range{ it->second.range };
+            for ( auto const * loop : loops_ )
+            {
+                ++loopWritesCount_[ { loop, name } ];
+            }
+
+            auto const value{ getConstant( *children[ 1U ] ) };
+            if ( !range.isBounded || !value )
+            {
+                range.isBounded = false;
+                return;
+            }
+
+            switch ( node.get< NodeType >() )
+            {
+                case NodeType::Assign:
+                {
+                    range.include( *value );
+                    break;
+                }
+                case NodeType::AssignAddition:
+                case NodeType::AssignSubtraction:
+                {
+                    auto const step{ is( node, NodeType::AssignAddition ) ? *value : -*value };
+                    if ( step < minValue || step > maxValue )
+                    {
+                        range.isBounded = false;
+                    }
+                    else if ( loops_.empty() )
+                    {
+                        // Executed at most once per execution of the scope
+                        range.include( step > 0 ? range.max + step : range.min + step );
+                    }
+                    else if ( auto const bound{ getLoopBound( *loops_.back(), name, step ) } )
+                    {
+                        range.include( *bound );
+                        boundedLoopWrites_.emplace_back( loops_.back(), name );
+                    }
+                    else
+                    {
+                        range.isBounded = false;
+                    }
+                    break;
+                }
+                default:
+                {
+                    range.isBounded = false;
+                    break;
+                }
+            }
+        }
+
+        /**
+         * Loop condition comparing the variable with a literal, e.g. 'i < 10', bounds
+         * the values of the variable which is stepped towards the literal once per iteration.
+         * Returns the furthest value the variable reaches, if bounded.
+         */
+        [[ nodiscard ]]
+        static std::optional< Value > getLoopBound( Node const & loop, std::string_view const name, Value const step ) noexcept
+        {
+            auto const & condition{ loop.children()[ 0U ] };
+            if ( condition == nullptr || condition->is_not< NodeType >() || std::size( condition->children() ) != 2U ) { return std::nullopt; }
+
+            auto const & operands{ condition->children() };
+            if ( getName( *operands[ 0U ] ) != name ) { return std::nullopt; }
+
+            auto const limit{ getConstant( *operands[ 1U ] ) };
+            if ( !limit || *limit < minValue || *limit > maxValue ) { return std::nullopt; }
+
+            switch ( condition->get< NodeType >() )
+            {
+                case NodeType::LessThan        : if ( step > 0 ) { return *limit - 1 + step; } break;
+                case NodeType::LessThanEqual   : if ( step > 0 ) { return *limit     + step; } break;
+                case NodeType::GreaterThan     : if ( step < 0 ) { return *limit + 1 + step; } break;
+                case NodeType::GreaterThanEqual: if ( step < 0 ) { return *limit     + step; } break;
+
+                default:
+                    break;
+            }
+            return std::nullopt;
+        }
+    };
+
+    void inferScopes( Node & node )
+    {
+        if ( is( node, NodeType::ModuleDefinition ) || is( node, NodeType::FunctionDefinition ) )
+        {
+            ScopeInference{}.run( node );
+        }
+
+        for ( auto const & child : node.children() )
+        {
+            if ( child != nullptr && ( is( *child, NodeType::ContractDefinition ) || is( *child, NodeType::FunctionDefinition ) ) )
+            {
+                inferScopes( *child );
+            }
+        }
+    }
+} // namespace
+
+void inferIntegerWidths( AST::Node & moduleNode )
+{
+    inferScopes( moduleNode );
+}
+
+} // namespace A1::Semantic
@@ -85,6 +85,7 @@ namespace
                 StringifiedToken{ "i16"     , ReservedToken::KwI16      },
                 StringifiedToken{ "i32"     , ReservedToken::KwI32      },
                 StringifiedToken{ "i64"     , ReservedToken::KwI64      },
+                StringifiedToken{ "i256"    , ReservedToken::KwI256     },
                 StringifiedToken{ "lambda"  , ReservedToken::KwLambda   },
                 StringifiedToken{ "let"     , ReservedToken::KwLet      },
                 StringifiedToken{ "map"     , ReservedToken::KwMap      },
@@ -102,6 +103,7 @@ namespace
                 StringifiedToken{ "u16"     , ReservedToken::KwU16      },
                 StringifiedToken{ "u32"     , ReservedToken::KwU32      },
                 StringifiedToken{ "u64"     , ReservedToken::KwU64      },
+                StringifiedToken{ "u256"    , ReservedToken::KwU256     },
                 StringifiedToken{ "while"   , ReservedToken::KwWhile    },
                 StringifiedToken{ "with"    , ReservedToken::KwWith     },
                 StringifiedToken{ "yield"   , ReservedToken::KwYield    }
@@ -198,7 +200,8 @@ bool isTypeSpecifier( ReservedToken const token ) noexcept
            token == ReservedToken::KwI8      || token == ReservedToken::KwU8   ||
            token == ReservedToken::KwI16     || token == ReservedToken::KwU16  ||
            token == ReservedToken::KwI32     || token == ReservedToken::KwU32  ||
-           token == ReservedToken::KwI64     || token == ReservedToken::KwU64;
+           token == ReservedToken::KwI64     || token == ReservedToken::KwU64  ||
+           token == ReservedToken::KwI256    || token == ReservedToken::KwU256;
 }
 
 std::string_view toStringView( ReservedToken const token ) noexcept
@@ -12,6 +12,23 @@
 namespace A1
 {
 
+std::string Number::toDecimalString() const
+{
+    auto result{ std::to_string( value ) };
+    if ( decimals == 0U ) { return result; }
+
+    // Leading zeros of the fraction are not part of the value, e.g. 0.05 is 5 with 2 decimals
+    auto const isNegative{ value < 0 };
+    auto const digits    { std::size( result ) - ( isNegative ? 1U : 0U ) };
+    if ( digits <= decimals )
+    {
+        result.insert( isNegative ? 1U : 0U, decimals - digits + 1U, '0' );
+    }
+
+    result.insert( std::size( result ) - decimals, 1U, '.' );
+    return result;
+}
+
 std::string Token::toString() const noexcept
 {
     return std::visit
@@ -28,7 +45,7 @@ std::string Token::toString() const noexcept
             },
             []( Number const number )
             {
-                return std::to_string( number.value );
+                return number.toDecimalString();
             },
             []( StringLiteral const & str )
             {
@@ -49,6 +49,40 @@ namespace
         if ( c ) { stream.push( *c ); }
     }
 
+    /**
+     * Decimal literal is parsed as the integer of all its digits and the count of the digits
+     * after the decimal point, thus no precision is lost until the number is generated.
+     */
+    [[ nodiscard ]] Number getNumber( std::string digits, Stream const & stream )
+    {
+        Number number;
+        if ( auto const point{ digits.find( '.' ) }; point != std::string::npos )
+        {
+            auto const decimals{ std::size( digits ) - point - 1U };
+            if ( decimals == 0U || digits.find( '.', point + 1U ) != std::string::npos )
+            {
+                throw ParsingError{ stream.errorInfo(), "Invalid number" };
+            }
+            else if ( decimals > Number::maxDecimals )
+            {
+                throw ParsingError{ stream.errorInfo(), "Number has more decimal places than num can hold" };
+            }
+
+            digits.erase( point, 1U );
+            number.decimals = static_cast< std::uint8_t >( decimals );
+        }
+
+        if
+        (
+            auto const [ ptr, ec ]{ std::from_chars( digits.data(), digits.data() + digits.size(), number.value ) };
+            ec != std::errc{} || ptr != digits.data() + digits.size()
+        )
+        {
+            throw ParsingError{ stream.errorInfo(), "Invalid number" };
+        }
+        return number;
+    }
+
     [[ nodiscard ]] Token getWord( Stream & stream )
     {
         std::string result;
@@ -93,17 +127,7 @@ namespace
         {
             if ( std::isdigit( result.front() ) )
             {
-                Number number;
-                if
-                (
-                    auto const [ ptr, ec ]{ std::from_chars( result.data(), result.data() + result.size(), number.value ) };
-                    ec != std::errc{}
-                )
-                {
-                    throw ParsingError{ stream.errorInfo(), "Invalid number" };
-                }
-
-                return Token{ number, stream.errorInfo() };
+                return Token{ getNumber( std::move( result ), stream ), stream.errorInfo() };
             }
 
             return Token{ Identifier{ std::move( result ) }, stream.errorInfo() };
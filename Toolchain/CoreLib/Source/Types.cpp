@@ -9,19 +9,171 @@
 
 #include "Utils/Utils.hpp"
 
+#include <fmt/format.h>
+
+#include <array>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+
 namespace A1::Registry
 {
 
 namespace
 {
-    Type address;
+    constexpr auto primitiveTypesCount{ static_cast< std::size_t >( PrimitiveType::Count ) };
+
+    /**
+     * Primitive types are stored contiguously in the order of their declaration,
+     * so that the index of the primitive type is derived from its handle alone.
+     */
+    std::array< Type const, primitiveTypesCount > const primitives
+    {
+        PrimitiveType::Unknown,
+        PrimitiveType::Address,
+        PrimitiveType::Bool, PrimitiveType::Num, PrimitiveType::Str,
+        PrimitiveType::I8, PrimitiveType::I16, PrimitiveType::I32, PrimitiveType::I64, PrimitiveType::I256,
+        PrimitiveType::U8, PrimitiveType::U16, PrimitiveType::U32, PrimitiveType::U64, PrimitiveType::U256
+    };
+
+    [[ nodiscard ]]
+    TypeID getPrimitiveHandle( PrimitiveType const type ) noexcept
+    {
+        return &primitives[ static_cast< std::size_t >( type ) ];
+    }
+
+    struct TypeHash
+    {
+        [[ nodiscard ]] std::size_t operator()( Type const & type ) const noexcept
+        {
+            std::hash< TypeID > const hash;
+            return std::visit
+            (
+                Overload
+                {
+                    [ & ]( PrimitiveType const   t ) noexcept { return static_cast< std::size_t >( t ); },
+                    [ & ]( ArrayType     const   t ) noexcept { return hashCombine( hash( t.innerTypeID ), static_cast< std::size_t >( t.layout ) ); },
+                    [ & ]( ContractType  const & t ) noexcept { return std::hash< std::string >{}( t.name ); },
+                    [ & ]( FunctionType  const & t ) noexcept
+                    {
+                        auto seed{ hash( t.returnTypeID ) };
+                        for ( auto const parameter : t.parameterTypeIDs )
+                        {
+                            seed = hashCombine( seed, hash( parameter.typeID ) );
+                        }
+                        return seed;
+                    },
+                    [ & ]( MapType const t ) noexcept { return hashCombine( hash( t.keyTypeID ), hash( t.valueTypeID ) ); }
+                },
+                type
+            ) ^ type.index();
+        }
+    };
+
+    /**
+     * Interned compound type along with its name and dense index. Type is the first member
+     * of the standard layout entry, thus the entry is reached from the handle alone.
+     */
+    struct Entry
+    {
+        Type        type;
+        std::string name {};
+        std::size_t index{ 0U };
+    };
+    static_assert( std::is_standard_layout_v< Entry > );
+
+    struct EntryHash
+    {
+        [[ nodiscard ]] std::size_t operator()( Entry const & entry ) const noexcept { return TypeHash{}( entry.type ); }
+    };
+
+    struct EntryEqual
+    {
+        [[ nodiscard ]] bool operator()( Entry const & lhs, Entry const & rhs ) const noexcept { return lhs.type == rhs.type; }
+    };
+
+    /**
+     * Table of the compound types. Elements of the unordered containers do not move
+     * when the containers grow, thus pointers to them are used as type handles.
+     * Lookups of already interned types, by far the most common case, take the shared lock only.
+     * Entries never change once interned, so their names and indices are read without the lock.
+     */
+    struct TypeTable
+    {
+        std::shared_mutex                                  mutex;
+        std::unordered_set< Entry, EntryHash, EntryEqual > entries;
+    };
+
+    [[ nodiscard ]]
+    Entry const & getEntry( TypeID const id ) noexcept
+    {
+        return *reinterpret_cast< Entry const * >( id );
+    }
+
+    [[ nodiscard ]]
+    TypeTable & typeTable() noexcept
+    {
+        static TypeTable table;
+        return table;
+    }
+
+    [[ nodiscard ]]
+    std::string makeName( Type const & type )
+    {
+        return std::visit
+        (
+            Overload
+            {
+                []( PrimitiveType const     ) { return std::string{}; },
+                []( ArrayType     const   t )
+                {
+                    return t.layout == ArrayLayout::StructOfArrays
+                        ? fmt::format( "array[{}, soa]", toStringView( t.innerTypeID ) )
+                        : fmt::format( "array[{}]"     , toStringView( t.innerTypeID ) );
+                },
+                []( ContractType  const & t ) { return t.name; },
+                []( FunctionType  const & t )
+                {
+                    std::string name{ "def(" };
+                    for ( auto i{ 0U }; i < std::size( t.parameterTypeIDs ); ++i )
+                    {
+                        if ( i != 0U ) { name += ", "; }
+                        name += toStringView( t.parameterTypeIDs[ i ].typeID );
+                    }
+                    name += ')';
+
+                    if ( t.returnTypeID != nullptr ) { name += fmt::format( " -> {}", toStringView( t.returnTypeID ) ); }
+                    return name;
+                },
+                []( MapType const t ) { return fmt::format( "map[{}, {}]", toStringView( t.keyTypeID ), toStringView( t.valueTypeID ) ); }
+            },
+            type
+        );
+    }
+
+    [[ nodiscard ]]
+    TypeID intern( Type type )
+    {
+        auto & table{ typeTable() };
+        Entry entry{ .type = std::move( type ) };
+        {
+            std::shared_lock lock{ table.mutex };
+            if ( auto const it{ table.entries.find( entry ) }; it != std::end( table.entries ) )
+            {
+                return &it->type;
+            }
+        }
 
-    Type bool_;
-    Type num;
-    Type str;
+        // Name is made before taking the exclusive lock, as it looks up names of the component types
+        entry.name = makeName( entry.type );
 
-    Type i8, i16, i32, i64;
-    Type u8, u16, u32, u64;
+        std::unique_lock lock{ table.mutex };
+        entry.index = primitiveTypesCount + std::size( table.entries );
+        return &table.entries.insert( std::move( entry ) ).first->type;
+    }
 } // namespace
 
 TypeID getHandle( Type const & type ) noexcept
@@ -45,11 +197,15 @@ TypeID getHandle( Type const & type ) noexcept
                     case PrimitiveType::I32: return getI32Handle();
                     case PrimitiveType::I64: return getI64Handle();
 
+                    case PrimitiveType::I256: return getI256Handle();
+
                     case PrimitiveType::U8 : return getU8Handle ();
                     case PrimitiveType::U16: return getU16Handle();
                     case PrimitiveType::U32: return getU32Handle();
                     case PrimitiveType::U64: return getU64Handle();
 
+                    case PrimitiveType::U256: return getU256Handle();
+
                     case PrimitiveType::Unknown:
                     case PrimitiveType::Count:
                         return nullptr;
@@ -57,47 +213,134 @@ TypeID getHandle( Type const & type ) noexcept
 
                 return nullptr;
             },
-            []( ArrayType const ) noexcept -> TypeID
+            []( ArrayType const t ) noexcept -> TypeID
             {
-                return nullptr;
+                return getArrayHandle( t.innerTypeID, t.layout );
             },
-            []( FunctionType const ) noexcept -> TypeID
+            []( ContractType const & t ) noexcept -> TypeID
             {
-                return nullptr;
+                return getContractHandle( t.name );
             },
-            []( MapType const ) noexcept -> TypeID
+            []( FunctionType const & t ) noexcept -> TypeID
             {
-                return nullptr;
+                std::vector< TypeID > parameterTypes;
+                for ( auto const parameter : t.parameterTypeIDs ) { parameterTypes.push_back( parameter.typeID ); }
+                return getFunctionHandle( t.returnTypeID, parameterTypes );
+            },
+            []( MapType const t ) noexcept -> TypeID
+            {
+                return getMapHandle( t.keyTypeID, t.valueTypeID );
             }
         },
         type
     );
 }
 
-TypeID getArrayHandle( TypeID const ) noexcept
+TypeID getArrayHandle( TypeID const inner, ArrayLayout const layout ) noexcept
+{
+    if ( inner == nullptr ) { return nullptr; }
+    return intern( ArrayType{ .innerTypeID = inner, .layout = layout } );
+}
+
+TypeID getMapHandle( TypeID const key, TypeID const value ) noexcept
+{
+    if ( key == nullptr || value == nullptr ) { return nullptr; }
+    return intern( MapType{ .keyTypeID = key, .valueTypeID = value } );
+}
+
+TypeID getFunctionHandle( TypeID const returnType, std::vector< TypeID > const & parameterTypes ) noexcept
+{
+    FunctionType function{ .returnTypeID = returnType };
+    for ( auto const parameterType : parameterTypes )
+    {
+        if ( parameterType == nullptr ) { return nullptr; }
+        function.parameterTypeIDs.push_back( { .typeID = parameterType } );
+    }
+    return intern( std::move( function ) );
+}
+
+TypeID getContractHandle( std::string_view const name )
+{
+    return intern( ContractType{ .name = std::string{ name } } );
+}
+
+TypeID getAddressHandle() noexcept { return getPrimitiveHandle( PrimitiveType::Address ); }
+
+TypeID getBoolHandle() noexcept { return getPrimitiveHandle( PrimitiveType::Bool ); }
+TypeID getNumHandle () noexcept { return getPrimitiveHandle( PrimitiveType::Num  ); }
+TypeID getStrHandle () noexcept { return getPrimitiveHandle( PrimitiveType::Str  ); }
+
+TypeID getI8Handle () noexcept { return getPrimitiveHandle( PrimitiveType::I8  ); }
+TypeID getI16Handle() noexcept { return getPrimitiveHandle( PrimitiveType::I16 ); }
+TypeID getI32Handle() noexcept { return getPrimitiveHandle( PrimitiveType::I32 ); }
+TypeID getI64Handle() noexcept { return getPrimitiveHandle( PrimitiveType::I64 ); }
+
+TypeID getI256Handle() noexcept { return getPrimitiveHandle( PrimitiveType::I256 ); }
+
+TypeID getU8Handle () noexcept { return getPrimitiveHandle( PrimitiveType::U8  ); }
+TypeID getU16Handle() noexcept { return getPrimitiveHandle( PrimitiveType::U16 ); }
+TypeID getU32Handle() noexcept { return getPrimitiveHandle( PrimitiveType::U32 ); }
+TypeID getU64Handle() noexcept { return getPrimitiveHandle( PrimitiveType::U64 ); }
+
+TypeID getU256Handle() noexcept { return getPrimitiveHandle( PrimitiveType::U256 ); }
+
+std::size_t getIndex( TypeID const id ) noexcept
 {
-    return nullptr;
+    if ( id == nullptr ) { return 0U; }
+
+    std::less< TypeID > const less;
+    if ( !less( id, std::data( primitives ) ) && less( id, std::data( primitives ) + primitiveTypesCount ) )
+    {
+        return static_cast< std::size_t >( id - std::data( primitives ) );
+    }
+
+    return getEntry( id ).index;
 }
 
-TypeID getMapHandle( TypeID const, TypeID const ) noexcept
+bool isNumeric( TypeID const id ) noexcept
 {
-    return nullptr;
+    return
+        id == getBoolHandle() || id == getNumHandle() ||
+        id == getI8Handle  () || id == getI16Handle() || id == getI32Handle() || id == getI64Handle() ||
+        id == getU8Handle  () || id == getU16Handle() || id == getU32Handle() || id == getU64Handle() ||
+        isWide( id );
 }
 
-TypeID getAddressHandle() noexcept { return &address; }
+bool isSigned( TypeID const id ) noexcept
+{
+    return
+        id == getNumHandle() ||
+        id == getI8Handle () || id == getI16Handle() || id == getI32Handle() || id == getI64Handle() ||
+        id == getI256Handle();
+}
 
-TypeID getBoolHandle() noexcept { return &bool_; }
-TypeID getNumHandle () noexcept { return &num;   }
-TypeID getStrHandle () noexcept { return &str;   }
+bool isWide( TypeID const id ) noexcept
+{
+    return id == getI256Handle() || id == getU256Handle();
+}
 
-TypeID getI8Handle () noexcept { return &i8;  }
-TypeID getI16Handle() noexcept { return &i16; }
-TypeID getI32Handle() noexcept { return &i32; }
-TypeID getI64Handle() noexcept { return &i64; }
+std::string_view toStringView( TypeID const id ) noexcept
+{
+         if ( id == getAddressHandle() ) { return "address"; }
+    else if ( id == getBoolHandle   () ) { return "bool";    }
+    else if ( id == getNumHandle    () ) { return "num";     }
+    else if ( id == getStrHandle    () ) { return "str";     }
+    else if ( id == getI8Handle     () ) { return "i8";      }
+    else if ( id == getI16Handle    () ) { return "i16";     }
+    else if ( id == getI32Handle    () ) { return "i32";     }
+    else if ( id == getI64Handle    () ) { return "i64";     }
+    else if ( id == getI256Handle   () ) { return "i256";    }
+    else if ( id == getU8Handle     () ) { return "u8";      }
+    else if ( id == getU16Handle    () ) { return "u16";     }
+    else if ( id == getU32Handle    () ) { return "u32";     }
+    else if ( id == getU64Handle    () ) { return "u64";     }
+    else if ( id == getU256Handle   () ) { return "u256";    }
+    else if ( id != nullptr )
+    {
+        return getEntry( id ).name;
+    }
 
-TypeID getU8Handle () noexcept { return &u8;  }
-TypeID getU16Handle() noexcept { return &u16; }
-TypeID getU32Handle() noexcept { return &u32; }
-TypeID getU64Handle() noexcept { return &u64; }
+    return "null";
+}
 
 } // namespace A1::Registry
\ No newline at end of file
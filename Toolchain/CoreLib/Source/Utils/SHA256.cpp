@@ -0,0 +1,121 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include "SHA256.hpp"
+
+#include <fmt/format.h>
+
+#include <bit>
+
+namespace A1
+{
+
+namespace
+{
+    constexpr std::array< std::uint32_t, 64U > roundConstants
+    {
+        0x428a2f98U, 0x71374491U, 0xb5c0fbcfU, 0xe9b5dba5U, 0x3956c25bU, 0x59f111f1U, 0x923f82a4U, 0xab1c5ed5U,
+        0xd807aa98U, 0x12835b01U, 0x243185beU, 0x550c7dc3U, 0x72be5d74U, 0x80deb1feU, 0x9bdc06a7U, 0xc19bf174U,
+        0xe49b69c1U, 0xefbe4786U, 0x0fc19dc6U, 0x240ca1ccU, 0x2de92c6fU, 0x4a7484aaU, 0x5cb0a9dcU, 0x76f988daU,
+        0x983e5152U, 0xa831c66dU, 0xb00327c8U, 0xbf597fc7U, 0xc6e00bf3U, 0xd5a79147U, 0x06ca6351U, 0x14292967U,
+        0x27b70a85U, 0x2e1b2138U, 0x4d2c6dfcU, 0x53380d13U, 0x650a7354U, 0x766a0abbU, 0x81c2c92eU, 0x92722c85U,
+        0xa2bfe8a1U, 0xa81a664bU, 0xc24b8b70U, 0xc76c51a3U, 0xd192e819U, 0xd6990624U, 0xf40e3585U, 0x106aa070U,
+        0x19a4c116U, 0x1e376c08U, 0x2748774cU, 0x34b0bcb5U, 0x391c0cb3U, 0x4ed8aa4aU, 0x5b9cca4fU, 0x682e6ff3U,
+        0x748f82eeU, 0x78a5636fU, 0x84c87814U, 0x8cc70208U, 0x90befffaU, 0xa4506cebU, 0xbef9a3f7U, 0xc67178f2U
+    };
+} // namespace
+
+SHA256 & SHA256::update( std::string_view const data ) noexcept
+{
+    for ( auto const c : data )
+    {
+        block_[ blockSize_++ ] = static_cast< std::uint8_t >( c );
+        if ( blockSize_ == std::size( block_ ) )
+        {
+            compress();
+            blockSize_ = 0U;
+        }
+    }
+    length_ += std::size( data );
+    return *this;
+}
+
+std::string SHA256::hex() noexcept
+{
+    static constexpr auto bitsPerByte{ 8U };
+
+    // Message is padded with a single set bit, zeros and its length in bits, up to the multiple of the block size
+    auto const length{ length_ * bitsPerByte };
+
+    static constexpr char padding{ static_cast< char >( 0x80 ) };
+    update( { &padding, 1U } );
+    while ( blockSize_ != std::size( block_ ) - sizeof( length ) )
+    {
+        update( { "\0", 1U } );
+    }
+    for ( auto i{ 0U }; i < sizeof( length ); ++i )
+    {
+        auto const byte{ static_cast< char >( length >> ( ( sizeof( length ) - 1U - i ) * bitsPerByte ) ) };
+        update( { &byte, 1U } );
+    }
+
+    std::string result;
+    for ( auto const word : state_ )
+    {
+        result += fmt::format( "{:08x}", word );
+    }
+    return result;
+}
+
+void SHA256::compress() noexcept
+{
+    std::array< std::uint32_t, 64U > words{};
+    for ( auto i{ 0U }; i < 16U; ++i )
+    {
+        words[ i ] = static_cast< std::uint32_t >( block_[ i * 4U      ] ) << 24U |
+                     static_cast< std::uint32_t >( block_[ i * 4U + 1U ] ) << 16U |
+                     static_cast< std::uint32_t >( block_[ i * 4U + 2U ] ) <<  8U |
+                     static_cast< std::uint32_t >( block_[ i * 4U + 3U ] );
+    }
+    for ( auto i{ 16U }; i < 64U; ++i )
+    {
+        auto const s0{ std::rotr( words[ i - 15U ],  7 ) ^ std::rotr( words[ i - 15U ], 18 ) ^ ( words[ i - 15U ] >>  3U ) };
+        auto const s1{ std::rotr( words[ i -  2U ], 17 ) ^ std::rotr( words[ i -  2U ], 19 ) ^ ( words[ i -  2U ] >> 10U ) };
+        words[ i ] = words[ i - 16U ] + s0 + words[ i - 7U ] + s1;
+    }
+
+    auto [ a, b, c, d, e, f, g, h ]{ state_ };
+    for ( auto i{ 0U }; i < 64U; ++i )
+    {
+        auto const s1   { std::rotr( e, 6 ) ^ std::rotr( e, 11 ) ^ std::rotr( e, 25 ) };
+        auto const ch   { ( e & f ) ^ ( ~e & g ) };
+        auto const temp1{ h + s1 + ch + roundConstants[ i ] + words[ i ] };
+        auto const s0   { std::rotr( a, 2 ) ^ std::rotr( a, 13 ) ^ std::rotr( a, 22 ) };
+        auto const maj  { ( a & b ) ^ ( a & c ) ^ ( b & c ) };
+        auto const temp2{ s0 + maj };
+
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+
+    state_[ 0U ] += a;
+    state_[ 1U ] += b;
+    state_[ 2U ] += c;
+    state_[ 3U ] += d;
+    state_[ 4U ] += e;
+    state_[ 5U ] += f;
+    state_[ 6U ] += g;
+    state_[ 7U ] += h;
+}
+
+} // namespace A1
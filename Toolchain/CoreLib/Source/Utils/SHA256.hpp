@@ -0,0 +1,44 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace A1
+{
+
+/**
+ * SHA-256 digest of the data, which is fed in chunks, e.g. the contents of several files.
+ * Used for content addressing, where the hash of the contents has to be collision resistant.
+ */
+class SHA256 final
+{
+public:
+    SHA256 & update( std::string_view const data ) noexcept;
+
+    /** Finishes the digest and returns it as the lowercase hexadecimal string. */
+    [[ nodiscard ]] std::string hex() noexcept;
+
+private:
+    void compress() noexcept;
+
+    std::array< std::uint32_t, 8U > state_
+    {
+        0x6a09e667U, 0xbb67ae85U, 0x3c6ef372U, 0xa54ff53aU,
+        0x510e527fU, 0x9b05688cU, 0x1f83d9abU, 0x5be0cd19U
+    };
+
+    std::array< std::uint8_t, 64U > block_{};
+    std::size_t                     blockSize_{ 0U };
+    std::uint64_t                   length_   { 0U };
+};
+
+} // namespace A1
@@ -0,0 +1,99 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace A1
+{
+
+/**
+ * Fixed-size pool of worker threads executing the submitted tasks in FIFO order.
+ * Exceptions thrown by a task are propagated through the future returned on submission.
+ */
+class ThreadPool
+{
+public:
+    explicit ThreadPool( std::size_t threadsCount = std::thread::hardware_concurrency() )
+    {
+        threadsCount = std::max< std::size_t >( threadsCount, 1U );
+
+        workers_.reserve( threadsCount );
+        for ( auto i{ 0U }; i < threadsCount; ++i )
+        {
+            workers_.emplace_back( [ this ]{ work(); } );
+        }
+    }
+
+    ThreadPool( ThreadPool const & ) = delete;
+    ThreadPool & operator=( ThreadPool const & ) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::scoped_lock lock{ mutex_ };
+            stopped_ = true;
+        }
+        condition_.notify_all();
+
+        for ( auto & worker : workers_ ) { worker.join(); }
+    }
+
+    template< typename Function >
+    [[ nodiscard ]] auto submit( Function && function ) -> std::future< std::invoke_result_t< Function > >
+    {
+        // std::function requires copyable callables, thus the task is shared
+        auto task{ std::make_shared< std::packaged_task< std::invoke_result_t< Function >() > >( std::forward< Function >( function ) ) };
+        auto result{ task->get_future() };
+        {
+            std::scoped_lock lock{ mutex_ };
+            tasks_.emplace( [ task ]{ ( *task )(); } );
+        }
+        condition_.notify_one();
+        return result;
+    }
+
+    [[ nodiscard ]] std::size_t size() const noexcept { return workers_.size(); }
+
+private:
+    void work()
+    {
+        while ( true )
+        {
+            std::function< void() > task;
+            {
+                std::unique_lock lock{ mutex_ };
+                condition_.wait( lock, [ this ]{ return stopped_ || !tasks_.empty(); } );
+
+                if ( stopped_ && tasks_.empty() ) { return; }
+
+                task = std::move( tasks_.front() );
+                tasks_.pop();
+            }
+            task();
+        }
+    }
+
+    std::vector< std::thread >            workers_;
+    std::queue< std::function< void() > > tasks_;
+
+    std::mutex              mutex_;
+    std::condition_variable condition_;
+    bool                    stopped_{ false };
+};
+
+} // namespace A1
@@ -7,10 +7,27 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 namespace A1
 {
 
 template< typename ... Ts > struct Overload : Ts... { using Ts::operator()...; };
 template< typename ... Ts > Overload( Ts ... ) -> Overload< Ts ... >;
 
-} // namespace A1
\ No newline at end of file
+/**
+ * Mixes the value into the seed, so that the result depends on the order
+ * in which values are combined.
+ */
+[[ nodiscard ]]
+constexpr std::size_t hashCombine( std::size_t const seed, std::size_t const value ) noexcept
+{
+    // 64-bit finalizer of the SplitMix64 generator
+    std::uint64_t x{ seed ^ ( value + 0x9e3779b97f4a7c15ULL + ( seed << 6U ) + ( seed >> 2U ) ) };
+    x = ( x ^ ( x >> 30U ) ) * 0xbf58476d1ce4e5b9ULL;
+    x = ( x ^ ( x >> 27U ) ) * 0x94d049bb133111ebULL;
+    return static_cast< std::size_t >( x ^ ( x >> 31U ) );
+}
+
+} // namespace A1
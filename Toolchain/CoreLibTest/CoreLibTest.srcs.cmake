@@ -1,10 +1,25 @@
 set( SOURCES
+    ${CMAKE_CURRENT_LIST_DIR}/Source/AST/ASTHashTest.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/Source/AST/ASTNodeIndexTest.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/Source/AST/ASTOptimizerTest.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/Source/AST/ASTPrinterTest.cpp
     ${CMAKE_CURRENT_LIST_DIR}/Source/AST/ASTTest.cpp
 
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Compiler/CacheTest.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Compiler/StatisticsTest.cpp
+
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Lint/LinterTest.cpp
+
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Semantic/AnalyzerTest.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Semantic/BoundsAnalysisTest.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/Source/Semantic/WidthInferenceTest.cpp
+
     ${CMAKE_CURRENT_LIST_DIR}/Source/Tokenizer/ReservedTokenTest.cpp
     ${CMAKE_CURRENT_LIST_DIR}/Source/Tokenizer/TokenizerTest.cpp
 
+    ${CMAKE_CURRENT_LIST_DIR}/Source/ModuleTest.cpp
     ${CMAKE_CURRENT_LIST_DIR}/Source/TestUtils.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/Source/TypesTest.cpp
 )
 
 if( ENABLE_LLVM )
@@ -0,0 +1,120 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/AST/AST.hpp>
+#include <CoreLib/AST/ASTInterner.hpp>
+#include <CoreLib/Tokenizer/Tokenizer.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+    [[ nodiscard ]] A1::AST::Node::Pointer parse( std::string_view const expression )
+    {
+        auto token{ A1::tokenize( A1::Stream{ expression } ) };
+        return A1::AST::parse( token );
+    }
+
+    struct TestParameter
+    {
+        std::string_view lhs;
+        std::string_view rhs;
+
+        bool expectedEqual;
+
+        friend std::ostream & operator<<( std::ostream & os, TestParameter const & param )
+        {
+            return os << param.lhs << " <=> " << param.rhs;
+        }
+    };
+
+    struct ASTHashTestFixture : ::testing::TestWithParam< TestParameter > {};
+} // namespace
+
+TEST_P( ASTHashTestFixture, structuralEquality )
+{
+    auto const [ lhs, rhs, expectedEqual ]{ GetParam() };
+
+    auto const lhsRoot{ parse( lhs ) };
+    auto const rhsRoot{ parse( rhs ) };
+
+    EXPECT_EQ( A1::AST::equal( *lhsRoot, *rhsRoot ), expectedEqual );
+    if ( expectedEqual )
+    {
+        EXPECT_EQ( lhsRoot->hash(), rhsRoot->hash() );
+    }
+
+    A1::AST::Interner interner;
+    auto const lhsCanonical{ interner.intern( *lhsRoot ) };
+    auto const rhsCanonical{ interner.intern( *rhsRoot ) };
+
+    EXPECT_EQ( lhsCanonical == rhsCanonical, expectedEqual );
+}
+
+INSTANTIATE_TEST_SUITE_P
+(
+    ASTHashTest,
+    ASTHashTestFixture,
+    ::testing::Values
+    (
+        TestParameter{ .lhs = ""                 , .rhs = ""                 , .expectedEqual = true  },
+        TestParameter{ .lhs = "var = 5 + 5"      , .rhs = "var = 5 + 5"      , .expectedEqual = true  },
+        TestParameter{ .lhs = "var = 5 + 5"      , .rhs = "var = 5 + 6"      , .expectedEqual = false },
+        TestParameter{ .lhs = "var = 5 + 5"      , .rhs = "var = 5 - 5"      , .expectedEqual = false },
+        TestParameter{ .lhs = "var = 5 + 5"      , .rhs = "foo = 5 + 5"      , .expectedEqual = false },
+        TestParameter{ .lhs = "var = 1 + 2 * 3"  , .rhs = "var = (1 + 2) * 3", .expectedEqual = false },
+        TestParameter{ .lhs = "var = \"5\""      , .rhs = "var = 5"          , .expectedEqual = false },
+        TestParameter{ .lhs = "var = True"       , .rhs = "var = 1"          , .expectedEqual = false },
+        TestParameter
+        {
+            .lhs =
+                "def func(a: num) -> num:\n"
+                "    return a * 2\n",
+            .rhs =
+                "def func(a: num) -> num:\n"
+                "    return a * 2\n",
+            .expectedEqual = true
+        },
+        TestParameter
+        {
+            .lhs =
+                "def func(a: num) -> num:\n"
+                "    return a * 2\n",
+            .rhs =
+                "def func(a: str) -> num:\n"
+                "    return a * 2\n",
+            .expectedEqual = false
+        }
+    )
+);
+
+TEST( ASTHashTest, sharesCommonSubexpressions )
+{
+    auto const root{ parse( "var1 = (a + b) * (a + b)\nvar2 = (a + b) * (a + b)" ) };
+
+    A1::AST::Interner interner;
+    interner.intern( *root );
+
+    auto const & statements{ root->children() };
+    ASSERT_EQ( std::size( statements ), 2U );
+
+    auto const & lhsProduct{ statements[ 0 ]->children()[ 1 ] };
+    auto const & rhsProduct{ statements[ 1 ]->children()[ 1 ] };
+
+    EXPECT_EQ( interner.canonical( *lhsProduct ), interner.canonical( *rhsProduct ) );
+    EXPECT_EQ
+    (
+        interner.canonical( *lhsProduct->children()[ 0 ] ),
+        interner.canonical( *lhsProduct->children()[ 1 ] )
+    );
+
+    /**
+     * Unique subtrees: module, 2 assignments, 2 variable identifiers,
+     * a, b, a + b, parentheses around it and the product.
+     */
+    EXPECT_EQ( interner.uniqueCount(), 10U );
+}
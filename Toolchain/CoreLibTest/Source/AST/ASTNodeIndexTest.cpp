@@ -0,0 +1,142 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/AST/AST.hpp>
+#include <CoreLib/Errors/ParsingError.hpp>
+#include <CoreLib/Tokenizer/Tokenizer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <map>
+
+namespace
+{
+    using namespace A1::AST;
+
+    struct TestParameter
+    {
+        std::string_view input;
+
+        /** Expected number of nodes per node type, node types not listed are not expected. */
+        std::map< NodeType, std::size_t > expectedCounts;
+
+        friend std::ostream & operator<<( std::ostream & os, TestParameter const & param )
+        {
+            return os << param.input;
+        }
+    };
+
+    struct ASTNodeIndexTestFixture : ::testing::TestWithParam< TestParameter > {};
+} // namespace
+
+TEST_P( ASTNodeIndexTestFixture, indexing )
+{
+    auto const & [ input, expectedCounts ]{ GetParam() };
+
+    NodeIndex index;
+
+    auto token{ A1::tokenize( A1::Stream{ input } ) };
+    auto root { parse( token, &index ) };
+
+    ASSERT_NE( root, nullptr );
+    EXPECT_EQ( root->parent(), nullptr );
+
+    for ( auto i{ 0U }; i < static_cast< unsigned >( NodeType::Count ); ++i )
+    {
+        auto const type{ static_cast< NodeType >( i ) };
+        auto const it  { expectedCounts.find( type ) };
+
+        EXPECT_EQ( index.count( type ), it != std::end( expectedCounts ) ? it->second : 0U ) << toString( type );
+
+        for ( auto const * node : index.find( type ) )
+        {
+            EXPECT_EQ( node->get< NodeType >(), type );
+
+            // Every indexed node is reachable from the root through parent links
+            auto const * top{ node };
+            while ( top->parent() != nullptr )
+            {
+                auto const & siblings{ top->parent()->children() };
+                EXPECT_NE( std::find_if( std::begin( siblings ), std::end( siblings ), [ top ]( auto const & s ){ return s.get() == top; } ), std::end( siblings ) );
+                top = top->parent();
+            }
+            EXPECT_EQ( top, root.get() );
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P
+(
+    ASTNodeIndexTest,
+    ASTNodeIndexTestFixture,
+    ::testing::Values
+    (
+        TestParameter
+        {
+            .input          = "",
+            .expectedCounts = { { NodeType::ModuleDefinition, 1U } }
+        },
+        TestParameter
+        {
+            .input          = "a = b + c * d",
+            .expectedCounts =
+            {
+                { NodeType::ModuleDefinition, 1U },
+                { NodeType::Assign          , 1U },
+                { NodeType::Addition        , 1U },
+                { NodeType::Multiplication  , 1U }
+            }
+        },
+        TestParameter
+        {
+            .input =
+                "def func(x: num) -> num:\n"
+                "    if x > 0:\n"
+                "        return foo(x)\n"
+                "    return bar(x)",
+            .expectedCounts =
+            {
+                { NodeType::ModuleDefinition           , 1U },
+                { NodeType::FunctionDefinition         , 1U },
+                { NodeType::FunctionParameterDefinition, 1U },
+                { NodeType::StatementIf                , 1U },
+                { NodeType::GreaterThan                , 1U },
+                { NodeType::StatementReturn            , 2U },
+                { NodeType::Call                       , 2U }
+            }
+        }
+    )
+);
+
+TEST( ASTNodeIndexTest, siblings )
+{
+    auto token{ A1::tokenize( A1::Stream{ "a = 1\nb = 2\nc = 3" } ) };
+    auto root { parse( token ) };
+
+    auto const & statements{ root->children() };
+    ASSERT_EQ( std::size( statements ), 3U );
+
+    EXPECT_EQ( statements[ 0U ]->previousSibling(), nullptr );
+    EXPECT_EQ( statements[ 0U ]->nextSibling    (), statements[ 1U ].get() );
+    EXPECT_EQ( statements[ 1U ]->previousSibling(), statements[ 0U ].get() );
+    EXPECT_EQ( statements[ 1U ]->nextSibling    (), statements[ 2U ].get() );
+    EXPECT_EQ( statements[ 2U ]->nextSibling    (), nullptr );
+
+    auto children{ root->releaseChildren() };
+    EXPECT_EQ( children[ 0U ]->parent     (), nullptr );
+    EXPECT_EQ( children[ 0U ]->nextSibling(), nullptr );
+}
+
+TEST( ASTNodeIndexTest, clearedOnError )
+{
+    NodeIndex index;
+
+    auto token{ A1::tokenize( A1::Stream{ "a = 1 + 2\nb = (" } ) };
+    EXPECT_THROW( [[ maybe_unused ]] auto const root{ parse( token, &index ) }, A1::ParsingError );
+
+    EXPECT_EQ( index.count( NodeType::Addition ), 0U );
+}
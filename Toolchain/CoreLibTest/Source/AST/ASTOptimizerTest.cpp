@@ -0,0 +1,436 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/AST/AST.hpp>
+#include <CoreLib/AST/ASTOptimizer.hpp>
+#include <CoreLib/Tokenizer/Tokenizer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+namespace
+{
+    using Node     = A1::AST::Node;
+    using NodeType = A1::AST::NodeType;
+    using NodePtr  = A1::AST::Node const *;
+
+    void match( NodePtr const actual, NodePtr const expected )
+    {
+        if ( actual == nullptr || expected == nullptr )
+        {
+            ASSERT_EQ( actual, expected );
+            return;
+        }
+
+        EXPECT_EQ( actual->value(), expected->value() );
+
+        auto const & actualChildren  { actual  ->children() };
+        auto const & expectedChildren{ expected->children() };
+
+        auto const actualChildrenCount  { std::size( actualChildren   ) };
+        auto const expectedChildrenCount{ std::size( expectedChildren ) };
+
+        ASSERT_EQ( actualChildrenCount, expectedChildrenCount )
+            << "Actual node children count: "     << actualChildrenCount
+            << ", expected node children count: " << expectedChildrenCount;
+
+        for ( auto i{ 0U }; i < actualChildrenCount; ++i )
+        {
+            match( actualChildren[ i ].get(), expectedChildren[ i ].get() );
+        }
+    }
+
+    template< typename ... Ts >
+    std::vector< std::unique_ptr< Node > > makeChildren( Ts && ... nodes )
+    {
+        std::vector< std::unique_ptr< Node > > children;
+        children.reserve( sizeof...( Ts ) );
+
+        (
+            [ & ]
+            {
+                children.push_back( std::move( nodes ) );
+            }(), ...
+        );
+
+        return children;
+    }
+
+    struct TestParameter
+    {
+        std::string_view expression;
+
+        /**
+         * NOTE: Needs to be std::shared_ptr instead of std::unique_ptr
+         *       because GTest performs copy internally.
+         */
+        std::shared_ptr< Node > expectedRoot;
+
+        friend std::ostream & operator<<( std::ostream & os, TestParameter const & param )
+        {
+            return os << param.expression;
+        }
+    };
+
+    struct ASTOptimizerTestFixture : ::testing::TestWithParam< TestParameter > {};
+} // namespace
+
+TEST_P( ASTOptimizerTestFixture, optimization )
+{
+    auto const [ expression, expectedRoot ]{ GetParam() };
+
+    auto token     { A1::tokenize( A1::Stream{ expression } ) };
+    auto actualRoot{ A1::AST::optimize( A1::AST::parse( token ) ) };
+
+    match( actualRoot.get(), expectedRoot.get() );
+}
+
+INSTANTIATE_TEST_SUITE_P
+(
+    ASTOptimizerTest,
+    ASTOptimizerTestFixture,
+    ::testing::Values
+    (
+        TestParameter
+        {
+            .expression   = "var = 2 + 3 * (4 - 1)",
+            .expectedRoot = std::make_shared< Node >
+            (
+                NodeType::ModuleDefinition,
+                makeChildren
+                (
+                    std::make_unique< Node >
+                    (
+                        NodeType::Assign,
+                        makeChildren
+                        (
+                            std::make_unique< Node >( A1::Identifier{ .name = "var" } ),
+                            std::make_unique< Node >( A1::Number{ .value = 11 } )
+                        )
+                    )
+                )
+            )
+        },
+        TestParameter
+        {
+            .expression   = "var = 9223372036854775807 + 1",
+            .expectedRoot = std::make_shared< Node >
+            (
+                NodeType::ModuleDefinition,
+                makeChildren
+                (
+                    std::make_unique< Node >
+                    (
+                        NodeType::Assign,
+                        makeChildren
+                        (
+                            std::make_unique< Node >( A1::Identifier{ .name = "var" } ),
+                            std::make_unique< Node >( A1::Number{ .value = std::numeric_limits< A1::Number::Type >::min() } )
+                        )
+                    )
+                )
+            )
+        },
+        TestParameter
+        {
+            .expression   = "var = -1 < 0",
+            .expectedRoot = std::make_shared< Node >
+            (
+                NodeType::ModuleDefinition,
+                makeChildren
+                (
+                    std::make_unique< Node >
+                    (
+                        NodeType::Assign,
+                        makeChildren
+                        (
+                            std::make_unique< Node >( A1::Identifier{ .name = "var" } ),
+                            std::make_unique< Node >( A1::AST::Boolean{ true } )
+                        )
+                    )
+                )
+            )
+        },
+        TestParameter
+        {
+            .expression   = "var = -7 // 2 + (5 >> 1)",
+            .expectedRoot = std::make_shared< Node >
+            (
+                NodeType::ModuleDefinition,
+                makeChildren
+                (
+                    std::make_unique< Node >
+                    (
+                        NodeType::Assign,
+                        makeChildren
+                        (
+                            std::make_unique< Node >( A1::Identifier{ .name = "var" } ),
+                            std::make_unique< Node >( A1::Number{ .value = -1 } )
+                        )
+                    )
+                )
+            )
+        },
+        TestParameter
+        {
+            .expression   = "var = 5 / (1 - 1)",
+            .expectedRoot = std::make_shared< Node >
+            (
+                NodeType::ModuleDefinition,
+                makeChildren
+                (
+                    std::make_unique< Node >
+                    (
+                        NodeType::Assign,
+                        makeChildren
+                        (
+                            std::make_unique< Node >( A1::Identifier{ .name = "var" } ),
+                            std::make_unique< Node >
+                            (
+                                NodeType::Division,
+                                makeChildren
+                                (
+                                    std::make_unique< Node >( A1::Number{ .value = 5 } ),
+                                    std::make_unique< Node >( A1::Number{ .value = 0 } )
+                                )
+                            )
+                        )
+                    )
+                )
+            )
+        },
+        TestParameter
+        {
+            .expression   = "var = 7 / 2 + 8 / 4",
+            .expectedRoot = std::make_shared< Node >
+            (
+                NodeType::ModuleDefinition,
+                makeChildren
+                (
+                    std::make_unique< Node >
+                    (
+                        NodeType::Assign,
+                        makeChildren
+                        (
+                            std::make_unique< Node >( A1::Identifier{ .name = "var" } ),
+                            std::make_unique< Node >
+                            (
+                                NodeType::Addition,
+                                makeChildren
+                                (
+                                    std::make_unique< Node >
+                                    (
+                                        NodeType::Division,
+                                        makeChildren
+                                        (
+                                            std::make_unique< Node >( A1::Number{ .value = 7 } ),
+                                            std::make_unique< Node >( A1::Number{ .value = 2 } )
+                                        )
+                                    ),
+                                    std::make_unique< Node >( A1::Number{ .value = 2 } )
+                                )
+                            )
+                        )
+                    )
+                )
+            )
+        },
+        TestParameter
+        {
+            .expression   = "var = 1 < 2 && !False",
+            .expectedRoot = std::make_shared< Node >
+            (
+                NodeType::ModuleDefinition,
+                makeChildren
+                (
+                    std::make_unique< Node >
+                    (
+                        NodeType::Assign,
+                        makeChildren
+                        (
+                            std::make_unique< Node >( A1::Identifier{ .name = "var" } ),
+                            std::make_unique< Node >( true )
+                        )
+                    )
+                )
+            )
+        },
+        TestParameter
+        {
+            .expression =
+                "let a = 2\n"
+                "let b = a * 3\n"
+                "print(b + x)\n",
+            .expectedRoot = std::make_shared< Node >
+            (
+                NodeType::ModuleDefinition,
+                makeChildren
+                (
+                    std::make_unique< Node >
+                    (
+                        NodeType::Call,
+                        makeChildren
+                        (
+                            std::make_unique< Node >( A1::Identifier{ .name = "print" } ),
+                            std::make_unique< Node >
+                            (
+                                NodeType::Addition,
+                                makeChildren
+                                (
+                                    std::make_unique< Node >( A1::Number{ .value = 6 } ),
+                                    std::make_unique< Node >( A1::Identifier{ .name = "x" } )
+                                )
+                            )
+                        )
+                    )
+                )
+            )
+        },
+        TestParameter
+        {
+            .expression =
+                "let a = 2\n"
+                "a += 1\n"
+                "print(a)\n",
+            .expectedRoot = std::make_shared< Node >
+            (
+                NodeType::ModuleDefinition,
+                makeChildren
+                (
+                    std::make_unique< Node >
+                    (
+                        NodeType::VariableDefinition,
+                        makeChildren
+                        (
+                            std::make_unique< Node >( A1::Identifier{ .name = "a" } ),
+                            std::make_unique< Node >( A1::Number{ .value = 2 } )
+                        )
+                    ),
+                    std::make_unique< Node >
+                    (
+                        NodeType::AssignAddition,
+                        makeChildren
+                        (
+                            std::make_unique< Node >( A1::Identifier{ .name = "a" } ),
+                            std::make_unique< Node >( A1::Number{ .value = 1 } )
+                        )
+                    ),
+                    std::make_unique< Node >
+                    (
+                        NodeType::Call,
+                        makeChildren
+                        (
+                            std::make_unique< Node >( A1::Identifier{ .name = "print" } ),
+                            std::make_unique< Node >( A1::Identifier{ .name = "a" } )
+                        )
+                    )
+                )
+            )
+        },
+        TestParameter
+        {
+            .expression =
+                "if 1 > 2:\n"
+                "    print(1)\n"
+                "elif True:\n"
+                "    print(2)\n"
+                "else:\n"
+                "    print(3)\n",
+            .expectedRoot = std::make_shared< Node >
+            (
+                NodeType::ModuleDefinition,
+                makeChildren
+                (
+                    std::make_unique< Node >
+                    (
+                        NodeType::Call,
+                        makeChildren
+                        (
+                            std::make_unique< Node >( A1::Identifier{ .name = "print" } ),
+                            std::make_unique< Node >( A1::Number{ .value = 2 } )
+                        )
+                    )
+                )
+            )
+        },
+        TestParameter
+        {
+            .expression =
+                "if x:\n"
+                "    print(1)\n"
+                "elif False:\n"
+                "    print(2)\n"
+                "elif y:\n"
+                "    print(3)\n",
+            .expectedRoot = std::make_shared< Node >
+            (
+                NodeType::ModuleDefinition,
+                makeChildren
+                (
+                    std::make_unique< Node >
+                    (
+                        NodeType::StatementIf,
+                        makeChildren
+                        (
+                            std::make_unique< Node >( A1::Identifier{ .name = "x" } ),
+                            std::make_unique< Node >
+                            (
+                                NodeType::Call,
+                                makeChildren
+                                (
+                                    std::make_unique< Node >( A1::Identifier{ .name = "print" } ),
+                                    std::make_unique< Node >( A1::Number{ .value = 1 } )
+                                )
+                            ),
+                            std::make_unique< Node >
+                            (
+                                NodeType::StatementElif,
+                                makeChildren
+                                (
+                                    std::make_unique< Node >( A1::Identifier{ .name = "y" } ),
+                                    std::make_unique< Node >
+                                    (
+                                        NodeType::Call,
+                                        makeChildren
+                                        (
+                                            std::make_unique< Node >( A1::Identifier{ .name = "print" } ),
+                                            std::make_unique< Node >( A1::Number{ .value = 3 } )
+                                        )
+                                    )
+                                )
+                            )
+                        )
+                    )
+                )
+            )
+        },
+        TestParameter
+        {
+            .expression =
+                "def func():\n"
+                "    while 0:\n"
+                "        print(1)\n",
+            .expectedRoot = std::make_shared< Node >
+            (
+                NodeType::ModuleDefinition,
+                makeChildren
+                (
+                    std::make_unique< Node >
+                    (
+                        NodeType::FunctionDefinition,
+                        makeChildren
+                        (
+                            std::make_unique< Node >( A1::Identifier{ .name = "func" } ),
+                            std::make_unique< Node >( NodeType::StatementPass )
+                        )
+                    )
+                )
+            )
+        }
+    )
+);
@@ -0,0 +1,88 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/AST/AST.hpp>
+#include <CoreLib/AST/ASTPrinter.hpp>
+#include <CoreLib/Tokenizer/Tokenizer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace
+{
+    using namespace std::string_literals;
+
+    struct TestParameter
+    {
+        std::string_view     input;
+        A1::AST::PrintFormat format;
+        std::string          expectedOutput;
+
+        friend std::ostream & operator<<( std::ostream & os, TestParameter const & param )
+        {
+            return os << param.input;
+        }
+    };
+
+    struct ASTPrinterTestFixture : ::testing::TestWithParam< TestParameter > {};
+} // namespace
+
+TEST_P( ASTPrinterTestFixture, printing )
+{
+    auto const & [ input, format, expectedOutput ]{ GetParam() };
+
+    auto token{ A1::tokenize( A1::Stream{ input } ) };
+    auto root { A1::AST::parse( token ) };
+
+    std::string output;
+    A1::AST::print( root, output, format );
+
+    EXPECT_EQ( output, expectedOutput );
+}
+
+INSTANTIATE_TEST_SUITE_P
+(
+    ASTPrinterTest,
+    ASTPrinterTestFixture,
+    ::testing::Values
+    (
+        TestParameter
+        {
+            .input  = "let x: num = 1 + True",
+            .format = A1::AST::PrintFormat::Text,
+            .expectedOutput =
+                "ModuleDefinition\n"
+                "  VariableDefinition\n"
+                "    Identifier = 'x'\n"
+                "    TypeID = num\n"
+                "    Addition\n"
+                "      Number = '1'\n"
+                "      Boolean = 'true'\n"
+        },
+        TestParameter
+        {
+            .input  = "print(\"a\\\"b\")",
+            .format = A1::AST::PrintFormat::JSON,
+            .expectedOutput =
+                R"({"kind":"ModuleDefinition","line":1,"column":6,"children":[)"
+                R"({"kind":"Call","line":1,"column":7,"children":[)"
+                R"({"kind":"Identifier","line":1,"column":6,"value":"print"},)"
+                R"({"kind":"StringLiteral","line":1,"column":13,"value":"a\"b"}]}]})" "\n"
+        },
+        TestParameter
+        {
+            .input  = "-x",
+            .format = A1::AST::PrintFormat::Binary,
+            .expectedOutput =
+                "A1AST\x01"s
+                "\x00\x3C\x01\x00\x00\x00"s
+                "\x00\x07\x01\x00\x00\x00"s
+                "\x01\x01\x00\x00\x00x"s
+        }
+    )
+);
@@ -385,7 +385,7 @@ INSTANTIATE_TEST_SUITE_P
                         makeChildren
                         (
                             std::make_unique< Node >( A1::Identifier{ .name = "func" } ),
-                            std::make_unique< Node >( A1::Number{ .value = 1 } ),
+                            std::make_unique< Node >( A1::Number{ .value = 14, .decimals = 1U } ),
                             std::make_unique< Node >( A1::StringLiteral{ .value = "This is random string" } ),
                             std::make_unique< Node >( A1::Number{ .value = 5 } )
                         )
@@ -469,7 +469,7 @@ INSTANTIATE_TEST_SUITE_P
                                 makeChildren
                                 (
                                     std::make_unique< Node >( A1::Identifier{ .name = "func" } ),
-                                    std::make_unique< Node >( A1::Number{ .value = 1 } ),
+                                    std::make_unique< Node >( A1::Number{ .value = 14, .decimals = 1U } ),
                                     std::make_unique< Node >( A1::StringLiteral{ .value = "This is random string" } ),
                                     std::make_unique< Node >( A1::Number{ .value = 5 } )
                                 )
@@ -520,6 +520,99 @@ INSTANTIATE_TEST_SUITE_P
             )
         },
         TestParameter
+        {
+            .expression   = "var[1] - var[2]",
+            .expectedRoot = std::make_shared< Node >
+            (
+                NodeType::ModuleDefinition,
+                makeChildren
+                (
+                    std::make_unique< Node >
+                    (
+                        NodeType::Subtraction,
+                        makeChildren
+                        (
+                            std::make_unique< Node >
+                            (
+                                NodeType::Index,
+                                makeChildren
+                                (
+                                    std::make_unique< Node >( A1::Identifier{ .name = "var" } ),
+                                    std::make_unique< Node >( A1::Number{ .value = 1 }        )
+                                )
+                            ),
+                            std::make_unique< Node >
+                            (
+                                NodeType::Index,
+                                makeChildren
+                                (
+                                    std::make_unique< Node >( A1::Identifier{ .name = "var" } ),
+                                    std::make_unique< Node >( A1::Number{ .value = 2 }        )
+                                )
+                            )
+                        )
+                    )
+                )
+            )
+        },
+        TestParameter
+        {
+            .expression   = "var[1].count",
+            .expectedRoot = std::make_shared< Node >
+            (
+                NodeType::ModuleDefinition,
+                makeChildren
+                (
+                    std::make_unique< Node >
+                    (
+                        NodeType::MemberCall,
+                        makeChildren
+                        (
+                            std::make_unique< Node >
+                            (
+                                NodeType::Index,
+                                makeChildren
+                                (
+                                    std::make_unique< Node >( A1::Identifier{ .name = "var" } ),
+                                    std::make_unique< Node >( A1::Number{ .value = 1 }        )
+                                )
+                            ),
+                            std::make_unique< Node >( A1::Identifier{ .name = "count" } )
+                        )
+                    )
+                )
+            )
+        },
+        TestParameter
+        {
+            .expression   = "var[1:n - 1]",
+            .expectedRoot = std::make_shared< Node >
+            (
+                NodeType::ModuleDefinition,
+                makeChildren
+                (
+                    std::make_unique< Node >
+                    (
+                        NodeType::Slice,
+                        makeChildren
+                        (
+                            std::make_unique< Node >( A1::Identifier{ .name = "var" } ),
+                            std::make_unique< Node >( A1::Number{ .value = 1 }        ),
+                            std::make_unique< Node >
+                            (
+                                NodeType::Subtraction,
+                                makeChildren
+                                (
+                                    std::make_unique< Node >( A1::Identifier{ .name = "n" } ),
+                                    std::make_unique< Node >( A1::Number{ .value = 1 }      )
+                                )
+                            )
+                        )
+                    )
+                )
+            )
+        },
+        TestParameter
         {
             .expression   = "var[func()]",
             .expectedRoot = std::make_shared< Node >
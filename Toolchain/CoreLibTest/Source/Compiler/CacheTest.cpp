@@ -0,0 +1,205 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/Compiler/Cache.hpp>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct CacheTest : ::testing::Test
+    {
+        void SetUp() override
+        {
+            // Each test case gets its own directory, so that test cases can run in parallel
+            directory_ = std::filesystem::temp_directory_path() / fmt::format( "A1CacheTest_{}", ::testing::UnitTest::GetInstance()->current_test_info()->name() );
+            std::filesystem::remove_all( directory_ );
+            std::filesystem::create_directories( directory_ / "src" );
+        }
+
+        void TearDown() override
+        {
+            std::filesystem::remove_all( directory_ );
+        }
+
+    protected:
+        std::filesystem::path write( std::string_view const name, std::string_view const contents ) const
+        {
+            auto const path{ directory_ / name };
+            std::ofstream{ path, std::ios::binary } << contents;
+            return path;
+        }
+
+        [[ nodiscard ]] std::string read( std::filesystem::path const & path ) const
+        {
+            std::ifstream stream{ path, std::ios::binary };
+            return { std::istreambuf_iterator< char >{ stream }, std::istreambuf_iterator< char >{} };
+        }
+
+        std::filesystem::path directory_;
+    };
+} // namespace
+
+TEST_F( CacheTest, restoresStoredExecutable )
+{
+    A1::Compiler::Cache const cache{ directory_ / "cache", "1.0" };
+
+    auto const input   { write( "src/main.ao", "import lib\nprint(triple(2))" ) };
+    auto const imported{ write( "src/lib.ao" , "def triple(a: num) -> num:\n    return a * 3" ) };
+    auto const compiled{ write( "main"       , std::string{ "\x7f" "ELF\0binary", 11U } ) };
+    auto const restored{ directory_ / "restored" };
+
+    auto const key{ cache.key( A1::Compiler::Settings{}, input ) };
+    ASSERT_TRUE ( key.has_value() );
+    EXPECT_FALSE( cache.restore( *key, input, restored ) );
+
+    cache.store( *key, input, { imported }, {}, compiled );
+    ASSERT_TRUE( cache.restore( *key, input, restored ) );
+    EXPECT_EQ  ( read( restored ), read( compiled ) );
+
+    // Any change of the imported file invalidates the entry, even though the key is the same
+    write( "src/lib.ao", "def triple(a: num) -> num:\n    return a * 30" );
+    EXPECT_FALSE( cache.restore( *key, input, restored ) );
+}
+
+TEST_F( CacheTest, missesOnceUnresolvedImportIsCreated )
+{
+    A1::Compiler::Cache const cache{ directory_ / "cache", "1.0" };
+
+    // 'core' is left to the linker, as there is no 'core.ao' next to the source file
+    auto const input   { write( "src/main.ao", "import core\nprint(1)" ) };
+    auto const compiled{ write( "main", "binary" ) };
+    auto const restored{ directory_ / "restored" };
+    auto const key     { *cache.key( A1::Compiler::Settings{}, input ) };
+
+    cache.store( key, input, {}, { directory_ / "src/core.ao" }, compiled );
+    ASSERT_TRUE( cache.restore( key, input, restored ) );
+
+    // Module created since shadows the one of the linker, even though the source file is the same
+    write( "src/core.ao", "def one() -> num:\n    return 1" );
+    EXPECT_FALSE( cache.restore( key, input, restored ) );
+}
+
+TEST_F( CacheTest, keyDependsOnSourceVersionAndSettings )
+{
+    auto const input{ write( "src/main.ao", "print(1)" ) };
+
+    A1::Compiler::Settings settings;
+    auto const key{ A1::Compiler::Cache{ directory_, "1.0" }.key( settings, input ) };
+
+    // Output file and statistics do not affect the executable
+    settings.executableFilename = "other";
+    EXPECT_EQ( A1::Compiler::Cache( directory_, "1.0" ).key( settings, input ), key );
+
+    settings.optimizationLevel = A1::Compiler::OptimizationLevel::O2;
+    EXPECT_NE( A1::Compiler::Cache( directory_, "1.0" ).key( settings, input ), key );
+    EXPECT_NE( A1::Compiler::Cache( directory_, "1.1" ).key( A1::Compiler::Settings{}, input ), key );
+
+    write( "src/main.ao", "print(2)" );
+    EXPECT_NE( A1::Compiler::Cache( directory_, "1.0" ).key( A1::Compiler::Settings{}, input ), key );
+    EXPECT_FALSE( A1::Compiler::Cache( directory_, "1.0" ).key( A1::Compiler::Settings{}, directory_ / "missing.ao" ).has_value() );
+}
+
+TEST_F( CacheTest, evictsLeastRecentlyUsedEntries )
+{
+    auto const cacheDirectory{ directory_ / "cache" };
+    A1::Compiler::Cache const cache{ cacheDirectory, "1.0", 2500U };
+
+    auto const compiled{ write( "main", std::string( 1000U, 'x' ) ) };
+    auto const restored{ directory_ / "restored" };
+
+    std::vector< std::filesystem::path > inputs;
+    std::vector< std::string           > keys;
+    for ( auto const * source : { "print(1)", "print(2)", "print(3)" } )
+    {
+        inputs.push_back( write( fmt::format( "src/{}.ao", std::size( keys ) ), source ) );
+        keys  .push_back( *cache.key( A1::Compiler::Settings{}, inputs.back() ) );
+    }
+
+    // Entries are aged explicitly, as the resolution of the file times depends on the file system
+    auto const now{ std::filesystem::file_time_type::clock::now() };
+    cache.store( keys[ 0U ], inputs[ 0U ], {}, {}, compiled );
+    std::filesystem::last_write_time( cacheDirectory / keys[ 0U ], now - std::chrono::hours{ 2 } );
+    cache.store( keys[ 1U ], inputs[ 1U ], {}, {}, compiled );
+    std::filesystem::last_write_time( cacheDirectory / keys[ 1U ], now - std::chrono::hours{ 1 } );
+
+    // Restoring the older entry makes the other one the least recently used
+    ASSERT_TRUE( cache.restore( keys[ 0U ], inputs[ 0U ], restored ) );
+    cache.store( keys[ 2U ], inputs[ 2U ], {}, {}, compiled );
+
+    EXPECT_TRUE ( cache.restore( keys[ 0U ], inputs[ 0U ], restored ) );
+    EXPECT_FALSE( cache.restore( keys[ 1U ], inputs[ 1U ], restored ) );
+    EXPECT_TRUE ( cache.restore( keys[ 2U ], inputs[ 2U ], restored ) );
+}
+
+TEST_F( CacheTest, keepsTemporaryFilesBeingWritten )
+{
+    auto const cacheDirectory{ directory_ / "cache" };
+    A1::Compiler::Cache const cache{ cacheDirectory, "1.0", 1500U };
+
+    auto const compiled{ write( "main", std::string( 1000U, 'x' ) ) };
+    auto const input   { write( "src/main.ao", "print(1)" ) };
+
+    // Temporary files of other writers, the stale one is left behind by the writer which has crashed
+    std::filesystem::create_directories( cacheDirectory );
+    auto const inFlight{ write( "cache/entry.tmp-1-2-3", std::string( 1000U, 'x' ) ) };
+    auto const stale   { write( "cache/entry.tmp-4-5-6", std::string( 1000U, 'x' ) ) };
+    std::filesystem::last_write_time( stale, std::filesystem::file_time_type::clock::now() - std::chrono::hours{ 2 } );
+
+    auto const key{ *cache.key( A1::Compiler::Settings{}, input ) };
+    cache.store( key, input, {}, {}, compiled );
+
+    EXPECT_TRUE ( std::filesystem::exists( inFlight ) );
+    EXPECT_FALSE( std::filesystem::exists( stale    ) );
+    EXPECT_TRUE ( cache.restore( key, input, directory_ / "restored" ) );
+}
+
+TEST_F( CacheTest, sharesEntriesBetweenThreads )
+{
+    A1::Compiler::Cache const cache{ directory_ / "cache", "1.0" };
+
+    auto const input   { write( "src/main.ao", "print(1)" ) };
+    auto const compiled{ write( "main", std::string( 100000U, 'x' ) ) };
+    auto const key     { *cache.key( A1::Compiler::Settings{}, input ) };
+
+    std::vector< std::future< bool > > results;
+    for ( auto i{ 0U }; i < 8U; ++i )
+    {
+        results.push_back
+        (
+            std::async
+            (
+                std::launch::async,
+                [ &, i ]
+                {
+                    cache.store( key, input, {}, {}, compiled );
+
+                    // Readers see either the complete entry or none
+                    auto const restored{ directory_ / fmt::format( "restored{}", i ) };
+                    return cache.restore( key, input, restored ) && read( restored ) == read( compiled );
+                }
+            )
+        );
+    }
+
+    for ( auto & result : results )
+    {
+        EXPECT_TRUE( result.get() );
+    }
+
+    // Temporary files are renamed into the entry, none of them is left behind
+    EXPECT_EQ( std::distance( std::filesystem::directory_iterator{ directory_ / "cache" }, std::filesystem::directory_iterator{} ), 1 );
+}
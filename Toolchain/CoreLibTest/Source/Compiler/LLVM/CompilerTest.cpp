@@ -6,14 +6,20 @@
  */
 
 #include <CoreLib/AST/AST.hpp>
+#include <CoreLib/Compiler/Compiler.hpp>
 #include <CoreLib/Compiler/LLVM/Compiler.hpp>
+#include <CoreLib/Module.hpp>
 #include <CoreLib/Tokenizer/Tokenizer.hpp>
 
 #include <fmt/format.h>
 #include <gtest/gtest.h>
 
 #include <array>
+#include <filesystem>
+#include <fstream>
+#include <future>
 #include <string>
+#include <vector>
 
 namespace
 {
@@ -54,6 +60,12 @@ namespace
         /** Output of the compiled executable file. */
         std::string_view expectedOutput;
 
+        /** Level of the LLVM IR optimization the source code is compiled with. */
+        A1::Compiler::OptimizationLevel optimizationLevel{ A1::Compiler::OptimizationLevel::O0 };
+
+        /** Number of threads the contracts and functions are compiled on. */
+        std::size_t threadsCount{ 1U };
+
         friend std::ostream & operator<<( std::ostream & os, TestParameter const & param )
         {
             return os << param.input;
@@ -65,13 +77,18 @@ namespace
 
 TEST_P( LLVMCompilerTestFixture, compilation )
 {
-    auto const [ input, expectedOutput ]{ GetParam() };
+    auto const [ input, expectedOutput, optimizationLevel, threadsCount ]{ GetParam() };
 
     auto token   { A1::tokenize( A1::Stream{ input } ) };
     auto rootNode{ A1::AST::parse( token ) };
 
     static constexpr auto executableFilename{ "out" };
-    A1::Compiler::Settings settings{ .executableFilename = executableFilename };
+    A1::Compiler::Settings settings
+    {
+        .executableFilename = executableFilename,
+        .optimizationLevel  = optimizationLevel,
+        .threadsCount       = threadsCount
+    };
 
     ASSERT_TRUE( A1::LLVM::compile( std::move( settings ), rootNode ) )
         << "Compilation should have succeded";
@@ -381,6 +398,7 @@ INSTANTIATE_TEST_SUITE_P
                 "2\n"
                 "1\n"
                 "0\n"
+                "-1\n"
                 "4"
         },
         TestParameter
@@ -418,6 +436,655 @@ INSTANTIATE_TEST_SUITE_P
                 "5\n"
                 "3\n"
                 "5"
+        },
+        TestParameter
+        {
+            .input =
+                "let a: i8 = -1\n"
+                "let b: u8 = 255\n"
+                "let c: u8 = 1\n"
+                "let d: i8 = 127\n"
+                "d += 1\n"
+                "print(a < 0)\n"
+                "print(b > c)\n"
+                "print(b / c)\n"
+                "print(d)",
+            .expectedOutput =
+                "1\n"
+                "1\n"
+                "255\n"
+                "-128"
+        },
+        TestParameter
+        {
+            .input =
+                "let x: u64 = 4000000000\n"
+                "let y: u64 = 0\n"
+                "y -= 1\n"
+                "let z: i64 = 5000000000\n"
+                "let w: u32 = 4294967295\n"
+                "print(x)\n"
+                "print(y)\n"
+                "print(z)\n"
+                "print(w)\n"
+                "print(1000000000000)\n"
+                "print(-z)",
+            .expectedOutput =
+                "4000000000\n"
+                "18446744073709551615\n"
+                "5000000000\n"
+                "4294967295\n"
+                "1000000000000\n"
+                "-5000000000"
+        },
+        TestParameter
+        {
+            // Comparisons of the constants are folded, the ones of the mutated variable are generated
+            .input =
+                "let a = 0\n"
+                "a -= 1\n"
+                "print(-1 < 0)\n"
+                "print(a < 0)\n"
+                "print(-2 >= -1)\n"
+                "print(a - 1 >= a)",
+            .expectedOutput =
+                "1\n"
+                "1\n"
+                "0\n"
+                "0"
+        },
+        TestParameter
+        {
+            .input =
+                "contract Flags:\n"
+                "    let a: bool = True\n"
+                "    let small: u8 = 7\n"
+                "    let b: bool\n"
+                "    let big: num = 42\n"
+                "    let c: bool = True\n"
+                "\n"
+                "    def set(self, x: num):\n"
+                "        self.b = True\n"
+                "        self.a = False\n"
+                "\n"
+                "let var = Flags()\n"
+                "print(var.a)\n"
+                "print(var.b)\n"
+                "print(var.small)\n"
+                "print(var.big)\n"
+                "var.set(1)\n"
+                "print(var.a)\n"
+                "print(var.b)\n"
+                "print(var.c)",
+            .expectedOutput =
+                "1\n"
+                "0\n"
+                "7\n"
+                "42\n"
+                "0\n"
+                "1\n"
+                "1"
+        },
+        TestParameter
+        {
+            .input =
+                "let i = 0\n"
+                "let total = 0\n"
+                "while i < 100:\n"
+                "    i += 1\n"
+                "    total = total + i * i\n"
+                "print(i)\n"
+                "print(total)",
+            .expectedOutput =
+                "100\n"
+                "338350"
+        },
+        TestParameter
+        {
+            .input =
+                "let one: u256 = 1\n"
+                "let a: u256 = one << 200\n"
+                "let b: u256 = 12345678901\n"
+                "let c: u256 = a * b + 7\n"
+                "print(c)\n"
+                "print(c / b)\n"
+                "print(c % b)\n"
+                "print(c >> 190)\n"
+                "print(c / 5)\n"
+                "print(a / 0)\n"
+                "print(one - 2)\n"
+                "let s: i256 = -5\n"
+                "print(s * a)\n"
+                "print(s / 2)\n"
+                "print(s % 3)",
+            .expectedOutput =
+                "19838741108222420424322577743558104835768610884383259683634165659467783\n"
+                "1606938044258990275541962092341162602522202993782792835301376\n"
+                "7\n"
+                "12641975194624\n"
+                "3967748221644484084864515548711620967153722176876651936726833131893556\n"
+                "0\n"
+                "115792089237316195423570985008687907853269984665640564039457584007913129639935\n"
+                "-8034690221294951377709810461705813012611014968913964176506880\n"
+                "-2\n"
+                "-2"
+        },
+        TestParameter
+        {
+            .input =
+                "let price = 1.25\n"
+                "let quantity = 3\n"
+                "print(price * quantity)\n"
+                "print(price * price)\n"
+                "print(price / 0.5)\n"
+                "print(7 / 2)\n"
+                "print(7 // 2)\n"
+                "print(1 / 3)\n"
+                "print(-0.05 - 1.45)\n"
+                "let total = 0.1\n"
+                "total += 0.2\n"
+                "print(total)\n"
+                "print(total > 0.25)",
+            .expectedOutput =
+                "3.75\n"
+                "1.5625\n"
+                "2.5\n"
+                "3.5\n"
+                "3\n"
+                "0.333333\n"
+                "-1.5\n"
+                "0.3\n"
+                "1"
+        },
+        TestParameter
+        {
+            .input =
+                "contract Bank:\n"
+                "    let balances: map[num, num]\n"
+                "    let deposits: map[u8, i32]\n"
+                "\n"
+                "    def deposit(self, owner: num, amount: num):\n"
+                "        self.balances[owner] += amount\n"
+                "        self.deposits[owner] += 1\n"
+                "\n"
+                "    def balance(self, owner: num) -> num:\n"
+                "        return self.balances[owner]\n"
+                "\n"
+                "    def count(self, owner: num) -> i32:\n"
+                "        return self.deposits[owner]\n"
+                "\n"
+                "let bank = Bank()\n"
+                "bank.deposit(1, 2.5)\n"
+                "bank.deposit(2, 10)\n"
+                "bank.deposit(1, 0.25)\n"
+                "print(bank.balance(1))\n"
+                "print(bank.balance(2))\n"
+                "print(bank.balance(3))\n"
+                "print(bank.count(1))\n"
+                "let squares: map[u16, num]\n"
+                "let i = 0\n"
+                "while i < 1000:\n"
+                "    squares[i] = i * i\n"
+                "    i += 1\n"
+                "print(squares[999] - squares[998])\n"
+                "print(squares[1000])",
+            .expectedOutput =
+                "2.75\n"
+                "10\n"
+                "0\n"
+                "2\n"
+                "1997\n"
+                "0"
+        },
+        TestParameter
+        {
+            // Nested map and the map argument are created by the first insertion, which updates their handles
+            .input =
+                "def put(x: map[u64, u64]):\n"
+                "    x[3] = 9\n"
+                "\n"
+                "let m: map[u64, map[u64, u64]]\n"
+                "m[1][2] = 7\n"
+                "print(m[1][2])\n"
+                "let e: map[u64, u64]\n"
+                "put(e)\n"
+                "print(e[3])\n"
+                "put(m[5])\n"
+                "print(m[5][3])",
+            .expectedOutput =
+                "7\n"
+                "9\n"
+                "9"
+        },
+        TestParameter
+        {
+            .input =
+                "def total(values: array[i64]) -> i64:\n"
+                "    let s: i64 = 0\n"
+                "    let i = 0\n"
+                "    while i < len(values):\n"
+                "        s += values[i]\n"
+                "        i += 1\n"
+                "    return s\n"
+                "\n"
+                "def fill(values: array[i64], n: num):\n"
+                "    let i = 0\n"
+                "    while i < n:\n"
+                "        values.append(i * i)\n"
+                "        i += 1\n"
+                "\n"
+                "contract Store:\n"
+                "    let values: array[u8]\n"
+                "\n"
+                "    def add(self, x: u8):\n"
+                "        self.values.append(x)\n"
+                "\n"
+                "let a: array[i64]\n"
+                "print(len(a))\n"
+                "fill(a, 10)\n"
+                "print(len(a))\n"
+                "print(total(a))\n"
+                "a[3] = 100\n"
+                "print(a[3] - a[2])\n"
+                "let store = Store()\n"
+                "store.add(5)\n"
+                "store.add(7)\n"
+                "print(len(store.values))\n"
+                "print(store.values[1])",
+            .expectedOutput =
+                "0\n"
+                "10\n"
+                "285\n"
+                "96\n"
+                "2\n"
+                "7"
+        },
+        TestParameter
+        {
+            .input =
+                "class Proposal:\n"
+                "    let count: i64\n"
+                "    let open: bool\n"
+                "    let weight: u8\n"
+                "\n"
+                "class Voter:\n"
+                "    let weight: num\n"
+                "    let hasVoted: bool\n"
+                "\n"
+                "contract Ballot:\n"
+                "    let proposals: array[Proposal]\n"
+                "    let columns: array[Proposal, soa]\n"
+                "    let voters: map[u64, Voter]\n"
+                "\n"
+                "    def add(self, weight: u8):\n"
+                "        let p = Proposal()\n"
+                "        p.weight = weight\n"
+                "        p.open = True\n"
+                "        self.proposals.append(p)\n"
+                "        self.columns.append(p)\n"
+                "\n"
+                "    def vote(self, voter: u64, index: u64):\n"
+                "        self.voters[voter].hasVoted = True\n"
+                "        self.voters[voter].weight += 1.5\n"
+                "        self.proposals[index].count += 1\n"
+                "        self.columns[index].count += 2\n"
+                "\n"
+                "    def total(self, x: num) -> i64:\n"
+                "        let s: i64 = 0\n"
+                "        let i = 0\n"
+                "        while i < len(self.columns):\n"
+                "            s += self.columns[i].count\n"
+                "            i += 1\n"
+                "        return s\n"
+                "\n"
+                "let b = Ballot()\n"
+                "b.add(3)\n"
+                "b.add(4)\n"
+                "b.vote(7, 1)\n"
+                "b.vote(7, 1)\n"
+                "b.vote(8, 0)\n"
+                "print(b.proposals[1].count)\n"
+                "print(b.columns[1].count)\n"
+                "print(b.columns[1].weight)\n"
+                "print(b.columns[0].open)\n"
+                "print(b.proposals[0].weight)\n"
+                "print(b.voters[7].weight)\n"
+                "print(b.voters[7].hasVoted)\n"
+                "print(b.voters[9].hasVoted)\n"
+                "print(len(b.columns))\n"
+                "print(b.total(0))",
+            .expectedOutput =
+                "2\n"
+                "4\n"
+                "4\n"
+                "1\n"
+                "3\n"
+                "3\n"
+                "1\n"
+                "0\n"
+                "2\n"
+                "6"
+        },
+        TestParameter
+        {
+            .input =
+                "contract Parser:\n"
+                "    let name: str = \"parser\"\n"
+                "    let last: str\n"
+                "\n"
+                "    def parse(self, payload: str) -> u64:\n"
+                "        let count: u64 = 0\n"
+                "        let rest = payload\n"
+                "        let i: u64 = 0\n"
+                "        while i < len(rest):\n"
+                "            if rest[i] == 44:\n"
+                "                self.last = rest[0:i]\n"
+                "                count += 1\n"
+                "                rest = rest[i + 1:len(rest)]\n"
+                "                i = 0\n"
+                "            else:\n"
+                "                i += 1\n"
+                "        self.last = rest\n"
+                "        return count + 1\n"
+                "\n"
+                "let p = Parser()\n"
+                "let s = \"amount=5,to=alice,memo=hi\"\n"
+                "print(len(s))\n"
+                "print(s[0:6])\n"
+                "print(s[0])\n"
+                "print(p.parse(s))\n"
+                "print(p.last)\n"
+                "print(p.name[2:6])\n"
+                "let key = s[0:6]\n"
+                "print(key == \"amount\")\n"
+                "print(key != \"amount\")\n"
+                "print(key == \"amoun\")\n"
+                "let e: str\n"
+                "print(e)\n"
+                "print(e == s[9:9])\n"
+                "e = \"x\"\n"
+                "print(e)",
+            .expectedOutput =
+                "25\n"
+                "amount\n"
+                "97\n"
+                "3\n"
+                "memo=hi\n"
+                "rser\n"
+                "1\n"
+                "0\n"
+                "0\n"
+                "\n"
+                "1\n"
+                "x"
+        },
+        TestParameter
+        {
+            .input =
+                "class Point:\n"
+                "    let x: num\n"
+                "    def get(self, k: num) -> num:\n"
+                "        return self.x + k\n"
+                "\n"
+                "def twice(a: num) -> num:\n"
+                "    return a * 2\n"
+                "\n"
+                "contract Counter:\n"
+                "    let count: num\n"
+                "    def bump(self, by: num) -> num:\n"
+                "        self.count += by * 2\n"
+                "        return self.count\n"
+                "\n"
+                "let c = Counter()\n"
+                "print(c.bump(3))\n"
+                "print(c.bump(4))\n"
+                "print(twice(5))\n"
+                "let p = Point()\n"
+                "print(p.get(1))",
+            .expectedOutput =
+                "6\n"
+                "14\n"
+                "10\n"
+                "1",
+            .optimizationLevel = A1::Compiler::OptimizationLevel::O2
+        },
+        TestParameter
+        {
+            .input =
+                "contract Sum:\n"
+                "    let values: array[u64]\n"
+                "    def total(self, n: u64) -> u64:\n"
+                "        let i: u64 = 0\n"
+                "        while i < n:\n"
+                "            self.values.append(i)\n"
+                "            i += 1\n"
+                "        let sum: u64 = 0\n"
+                "        i = 0\n"
+                "        while i < len(self.values):\n"
+                "            sum += self.values[i]\n"
+                "            i += 1\n"
+                "        return sum\n"
+                "\n"
+                "let s = Sum()\n"
+                "print(s.total(100))",
+            .expectedOutput = "4950",
+            .optimizationLevel = A1::Compiler::OptimizationLevel::Oz
+        },
+        TestParameter
+        {
+            .input =
+                "class Pair:\n"
+                "    let a: num\n"
+                "    def sum(self, b: num) -> num:\n"
+                "        return self.a + b\n"
+                "\n"
+                "def square(a: num) -> num:\n"
+                "    return a * a\n"
+                "\n"
+                "contract Bank:\n"
+                "    let balance: num\n"
+                "    def deposit(self, amount: num) -> num:\n"
+                "        self.balance += amount\n"
+                "        return self.balance\n"
+                "\n"
+                "def cube(a: num) -> num:\n"
+                "    return a * a * a\n"
+                "\n"
+                "contract Ballot:\n"
+                "    let votes: num\n"
+                "    def vote(self, weight: num) -> num:\n"
+                "        self.votes += weight\n"
+                "        return self.votes\n"
+                "\n"
+                "let b = Bank()\n"
+                "print(b.deposit(square(3)))\n"
+                "print(b.deposit(cube(2)))\n"
+                "let v = Ballot()\n"
+                "v.vote(1)\n"
+                "print(v.vote(1))\n"
+                "let p = Pair()\n"
+                "print(p.sum(7))",
+            .expectedOutput =
+                "9\n"
+                "17\n"
+                "2\n"
+                "7",
+            .optimizationLevel = A1::Compiler::OptimizationLevel::O2,
+            .threadsCount      = 4U
+        },
+        TestParameter
+        {
+            // Contract is instantiated by the top level statements and by the function, which are separate units
+            .input =
+                "contract Counter:\n"
+                "    let count: num\n"
+                "    def bump(self, by: num) -> num:\n"
+                "        self.count += by\n"
+                "        return self.count\n"
+                "\n"
+                "def twice() -> num:\n"
+                "    let c = Counter()\n"
+                "    c.bump(1)\n"
+                "    return c.bump(1)\n"
+                "\n"
+                "let d = Counter()\n"
+                "print(d.bump(1))\n"
+                "print(twice())",
+            .expectedOutput =
+                "1\n"
+                "2",
+            .threadsCount = 2U
         }
     )
-);
\ No newline at end of file
+);
+
+TEST( LLVMCompilerTest, compilesSourceInMemory )
+{
+    auto const output
+    {
+        A1::compile
+        (
+            "contract Counter:\n"
+            "    let count: u64\n"
+            "    def bump(self, by: u64) -> u64:\n"
+            "        self.count += by\n"
+            "        return self.count\n"
+            "let m: map[u64, u64]\n"
+            "m[1] = 2\n"
+            "let c = Counter()\n"
+            "print(c.bump(m[1]))",
+            { .optimizationLevel = A1::Compiler::OptimizationLevel::O2 }
+        )
+    };
+
+    ASSERT_TRUE( output.succeeded() );
+    EXPECT_EQ  ( output.importedModules, std::vector< std::string >{ "core" } );
+
+    // Output is the linked module, thus it runs as is, once written into the file
+    static constexpr auto executableFilename{ "in_memory_out" };
+    std::ofstream{ executableFilename, std::ios::binary }.write
+    (
+        reinterpret_cast< char const * >( output.objectCode.data() ),
+        static_cast< std::streamsize >( std::size( output.objectCode ) )
+    );
+    std::filesystem::permissions( executableFilename, std::filesystem::perms::owner_all );
+
+    EXPECT_EQ( run( fmt::format( "./{}", executableFilename ) ), "2\n" );
+    std::remove( executableFilename );
+}
+
+TEST( LLVMCompilerTest, reportsDiagnosticsInMemory )
+{
+    {
+        auto const output{ A1::compile( "let x: num = \"foo\"" ) };
+
+        ASSERT_EQ( std::size( output.diagnostics ), 1U );
+        ASSERT_TRUE( output.diagnostics[ 0U ].errorInfo.has_value() );
+        EXPECT_EQ( output.diagnostics[ 0U ].errorInfo->lineNumber  , 1U  );
+        EXPECT_EQ( output.diagnostics[ 0U ].errorInfo->columnNumber, 19U );
+        EXPECT_EQ( output.diagnostics[ 0U ].message, "Cannot initialize variable 'x' of type 'num' with value of type 'str'" );
+        EXPECT_TRUE( output.objectCode.empty() );
+    }
+    {
+        auto const output{ A1::compile( "let s = \"foo" ) };
+
+        ASSERT_EQ( std::size( output.diagnostics ), 1U );
+        EXPECT_EQ( output.diagnostics[ 0U ].message, "Missing closing quote" );
+    }
+}
+
+TEST( LLVMCompilerTest, compilesSourcesConcurrently )
+{
+    static constexpr auto source
+    {
+        "contract Token:\n"
+        "    let supply: u64\n"
+        "    def mint(self, amount: u64) -> u64:\n"
+        "        self.supply += amount\n"
+        "        return self.supply\n"
+        "let t = Token()\n"
+        "print(t.mint(5))"
+    };
+
+    static constexpr A1::Compiler::Options options{ .optimizationLevel = A1::Compiler::OptimizationLevel::O2 };
+
+    auto const expected{ A1::compile( source, options ) };
+    ASSERT_TRUE( expected.succeeded() );
+
+    std::vector< std::future< A1::Compiler::Output > > outputs;
+    for ( auto i{ 0U }; i < 8U; ++i )
+    {
+        outputs.push_back( std::async( std::launch::async, []{ return A1::compile( source, options ); } ) );
+    }
+
+    for ( auto & output : outputs )
+    {
+        EXPECT_EQ( output.get().objectCode, expected.objectCode );
+    }
+}
+
+TEST( LLVMCompilerTest, compilesUnitsDeterministically )
+{
+    static constexpr auto source
+    {
+        "def fee(amount: u64) -> u64:\n"
+        "    return amount / 100\n"
+        "contract Token:\n"
+        "    let supply: u64\n"
+        "    def mint(self, amount: u64) -> u64:\n"
+        "        self.supply += amount\n"
+        "        return self.supply\n"
+        "contract Vault:\n"
+        "    let locked: u64\n"
+        "    def lock(self, amount: u64) -> u64:\n"
+        "        self.locked += amount\n"
+        "        return self.locked\n"
+        "let t = Token()\n"
+        "print(t.mint(fee(500)))"
+    };
+
+    auto const serial  { A1::compile( source, { .optimizationLevel = A1::Compiler::OptimizationLevel::O2, .threadsCount = 1U } ) };
+    auto const parallel{ A1::compile( source, { .optimizationLevel = A1::Compiler::OptimizationLevel::O2, .threadsCount = 4U } ) };
+
+    ASSERT_TRUE( serial  .succeeded() );
+    ASSERT_TRUE( parallel.succeeded() );
+
+    // Objects of the units are linked in the order of the source, whatever the number of threads is
+    EXPECT_FALSE( serial.objectCode.empty() );
+    EXPECT_EQ   ( parallel.objectCode, serial.objectCode );
+}
+
+TEST( LLVMCompilerTest, compilesFilesInBatch )
+{
+    auto const directory{ std::filesystem::temp_directory_path() / "A1CompilerTest_batch" };
+    std::filesystem::remove_all( directory );
+    std::filesystem::create_directories( directory );
+
+    std::vector< std::pair< std::string_view, std::string_view > > const files
+    {
+        { "first.ao" , "print(1 + 2)"           },
+        { "broken.ao", "let x: num = \"foo\""   },
+        { "second.ao", "print(\"second\")"      }
+    };
+
+    std::vector< A1::LoadJob > jobs;
+    for ( auto const & [ name, source ] : files )
+    {
+        auto const path{ directory / name };
+        std::ofstream{ path } << source;
+        jobs.push_back( { .inputFile = path, .executableFilename = std::filesystem::path{ path }.replace_extension().string() } );
+    }
+
+    auto const results{ A1::loadAll( A1::Compiler::Settings{}, jobs, 3U ) };
+
+    // Results are in the order of the jobs, failure of one file does not stop the others
+    ASSERT_EQ( std::size( results ), 3U );
+    EXPECT_TRUE( results[ 0U ].succeeded() );
+    EXPECT_EQ  ( results[ 1U ].error, "1:19: error: Cannot initialize variable 'x' of type 'num' with value of type 'str'" );
+    EXPECT_TRUE( results[ 2U ].succeeded() );
+
+    EXPECT_EQ( run( jobs[ 0U ].executableFilename ), "3\n"      );
+    EXPECT_EQ( run( jobs[ 2U ].executableFilename ), "second\n" );
+
+    std::filesystem::remove_all( directory );
+}
@@ -0,0 +1,105 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/AST/AST.hpp>
+#include <CoreLib/Compiler/Statistics.hpp>
+#include <CoreLib/Tokenizer/Tokenizer.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+    using Counts = std::map< std::string_view, std::size_t >;
+
+    struct TestParameter
+    {
+        std::string_view input;
+
+        Counts expectedTokens;
+        Counts expectedNodes;
+
+        friend std::ostream & operator<<( std::ostream & os, TestParameter const & param )
+        {
+            return os << param.input;
+        }
+    };
+
+    struct StatisticsTestFixture : ::testing::TestWithParam< TestParameter > {};
+} // namespace
+
+TEST_P( StatisticsTestFixture, counting )
+{
+    auto const & [ input, expectedTokens, expectedNodes ]{ GetParam() };
+
+    A1::Compiler::Statistics statistics;
+    for ( auto it{ A1::tokenize( A1::Stream{ input } ) }; it->is_not< A1::Eof >(); ++it )
+    {
+        statistics.countToken( *it );
+    }
+    EXPECT_EQ( statistics.tokens, expectedTokens );
+
+    auto token{ A1::tokenize( A1::Stream{ input } ) };
+    auto root { A1::AST::parse( token ) };
+
+    std::size_t expectedNodesCount{ 0U };
+    for ( auto const & [ kind, count ] : expectedNodes ) { expectedNodesCount += count; }
+
+    EXPECT_EQ( statistics.countNodes( *root ), expectedNodesCount );
+    EXPECT_EQ( statistics.nodesCount, expectedNodesCount );
+    EXPECT_EQ( statistics.nodes, expectedNodes );
+    EXPECT_GE( statistics.astBytes, expectedNodesCount * sizeof( A1::AST::Node ) );
+}
+
+INSTANTIATE_TEST_SUITE_P
+(
+    StatisticsTest,
+    StatisticsTestFixture,
+    ::testing::Values
+    (
+        TestParameter
+        {
+            .input          = "",
+            .expectedTokens = {},
+            .expectedNodes  = { { "ModuleDefinition", 1U } }
+        },
+        TestParameter
+        {
+            .input          = "let x: num = a + 1",
+            .expectedTokens = { { "identifier", 2U }, { "keyword", 2U }, { "number", 1U }, { "operator", 3U } },
+            .expectedNodes  =
+            {
+                { "Addition"          , 1U },
+                { "Identifier"        , 2U },
+                { "ModuleDefinition"  , 1U },
+                { "Number"            , 1U },
+                { "TypeID"            , 1U },
+                { "VariableDefinition", 1U }
+            }
+        },
+        TestParameter
+        {
+            .input          = "if x:\n    print(\"foo\")",
+            .expectedTokens =
+            {
+                { "identifier" , 2U },
+                { "indentation", 1U },
+                { "keyword"    , 1U },
+                { "newline"    , 1U },
+                { "operator"   , 3U },
+                { "string"     , 1U }
+            },
+            .expectedNodes  =
+            {
+                { "Call"            , 1U },
+                { "Identifier"      , 2U },
+                { "ModuleDefinition", 1U },
+                { "StatementIf"     , 1U },
+                { "StringLiteral"   , 1U }
+            }
+        }
+    )
+);
@@ -0,0 +1,149 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/AST/AST.hpp>
+#include <CoreLib/Lint/Linter.hpp>
+#include <CoreLib/Tokenizer/Tokenizer.hpp>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct TestParameter
+    {
+        std::string_view input;
+
+        /** Expected diagnostics, formatted as '<line>: <rule>: <message>'. */
+        std::vector< std::string_view > expectedDiagnostics;
+
+        friend std::ostream & operator<<( std::ostream & os, TestParameter const & param )
+        {
+            return os << param.input;
+        }
+    };
+
+    struct LinterTestFixture : ::testing::TestWithParam< TestParameter > {};
+
+    [[ nodiscard ]]
+    std::vector< std::string > format( std::vector< A1::Lint::Diagnostic > const & diagnostics )
+    {
+        std::vector< std::string > result;
+        for ( auto const & diagnostic : diagnostics )
+        {
+            result.push_back( fmt::format( "{}: {}: {}", diagnostic.errorInfo.lineNumber, diagnostic.rule, diagnostic.message ) );
+        }
+        return result;
+    }
+} // namespace
+
+TEST_P( LinterTestFixture, linting )
+{
+    auto const & [ input, expectedDiagnostics ]{ GetParam() };
+
+    A1::Lint::Linter linter;
+    for ( auto & rule : A1::Lint::builtinRules() )
+    {
+        linter.addRule( std::move( rule ) );
+    }
+
+    A1::AST::NodeIndex index;
+
+    auto token{ A1::tokenize( A1::Stream{ input } ) };
+    auto root { A1::AST::parse( token, &index ) };
+
+    std::vector< std::string > const expected{ std::begin( expectedDiagnostics ), std::end( expectedDiagnostics ) };
+
+    // All the ways of running the rules report the same diagnostics
+    EXPECT_EQ( format( linter.run( *root                 ) ), expected );
+    EXPECT_EQ( format( linter.run( *root, nullptr,    4U ) ), expected );
+    EXPECT_EQ( format( linter.run( *root, &index         ) ), expected );
+}
+
+INSTANTIATE_TEST_SUITE_P
+(
+    LinterTest,
+    LinterTestFixture,
+    ::testing::Values
+    (
+        TestParameter
+        {
+            .input =
+                "let x = 5\n"
+                "def func(a: num) -> num:\n"
+                "    let y = a + 1\n"
+                "    return y",
+            .expectedDiagnostics = {}
+        },
+        TestParameter
+        {
+            .input =
+                "def func(a: num) -> num:\n"
+                "    let y = a + 1\n"
+                "    let z = 2\n"
+                "    return a\n"
+                "def other():\n"
+                "    let w = 3\n"
+                "    print(w)",
+            .expectedDiagnostics =
+            {
+                "2: unused-variable: Variable 'y' is never used",
+                "3: unused-variable: Variable 'z' is never used"
+            }
+        },
+        TestParameter
+        {
+            .input =
+                "let total = 0\n"
+                "def func(a: num) -> num:\n"
+                "    let a = 1\n"
+                "    let total = a\n"
+                "    return total",
+            .expectedDiagnostics =
+            {
+                "3: shadowed-name: Variable 'a' shadows the function parameter",
+                "4: shadowed-name: Variable 'total' shadows the module-level definition"
+            }
+        },
+        TestParameter
+        {
+            // Variables of the contract functions are checked as well, data members are not
+            .input =
+                "let count = 0\n"
+                "contract Counter:\n"
+                "    let value = 0\n"
+                "    def bump(self, by: num):\n"
+                "        let count = by\n"
+                "        let by = 1",
+            .expectedDiagnostics =
+            {
+                "5: shadowed-name: Variable 'count' shadows the module-level definition",
+                "5: unused-variable: Variable 'count' is never used",
+                "6: shadowed-name: Variable 'by' shadows the function parameter"
+            }
+        },
+        TestParameter
+        {
+            .input =
+                "contract First:\n"
+                "    let owner: str\n"
+                "contract Second:\n"
+                "    let owner: str\n"
+                "    def __init__(self):\n"
+                "        self.owner = \"foo\"\n"
+                "contract Third:\n"
+                "    let count = 0",
+            .expectedDiagnostics =
+            {
+                "1: missing-init: Contract 'First' has data members without initial values, but no '__init__' function"
+            }
+        }
+    )
+);
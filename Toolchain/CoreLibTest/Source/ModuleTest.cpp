@@ -0,0 +1,170 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/Module.hpp>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using A1::AST::NodeType;
+
+    struct TestParameter
+    {
+        /** Source files, mapped from the file name to the A1 source code. The first one is the main file. */
+        std::vector< std::pair< std::string_view, std::string_view > > files;
+
+        /**
+         * Top-level statements of the resulting module. Function definitions are
+         * represented by the function name, other statements by their node type.
+         */
+        std::vector< std::string_view > expectedStatements{};
+
+        /** Expected error message, empty in case module is expected to be parsed successfully. */
+        std::string_view expectedErrorMessage{};
+
+        friend std::ostream & operator<<( std::ostream & os, TestParameter const & param )
+        {
+            return os << param.files.front().second;
+        }
+    };
+
+    struct ModuleTestFixture : ::testing::TestWithParam< TestParameter >
+    {
+        void SetUp() override
+        {
+            // Each test case gets its own directory, so that test cases can run in parallel
+            std::string testName{ ::testing::UnitTest::GetInstance()->current_test_info()->name() };
+            std::replace( std::begin( testName ), std::end( testName ), '/', '_' );
+
+            directory_ = std::filesystem::temp_directory_path() / fmt::format( "A1ModuleTest_{}", testName );
+            std::filesystem::remove_all( directory_ );
+            std::filesystem::create_directories( directory_ );
+        }
+
+        void TearDown() override
+        {
+            std::filesystem::remove_all( directory_ );
+        }
+
+    protected:
+        std::filesystem::path directory_;
+    };
+
+    [[ nodiscard ]]
+    std::string_view describe( A1::AST::Node const & statement )
+    {
+        if ( statement.is< NodeType >() && statement.get< NodeType >() == NodeType::FunctionDefinition )
+        {
+            return statement.children()[ 0U ]->get< A1::Identifier >().name;
+        }
+        return statement.is< NodeType >() ? A1::AST::toString( statement.get< NodeType >() ) : "leaf";
+    }
+} // namespace
+
+TEST_P( ModuleTestFixture, importResolution )
+{
+    auto const & [ files, expectedStatements, expectedErrorMessage ]{ GetParam() };
+
+    for ( auto const & [ name, source ] : files )
+    {
+        std::ofstream{ directory_ / name } << source;
+    }
+
+    auto const mainFile{ directory_ / files.front().first };
+    if ( !expectedErrorMessage.empty() )
+    {
+        EXPECT_THROW
+        (
+            {
+                try
+                {
+                    [[ maybe_unused ]] auto const root{ A1::parseModule( mainFile ) };
+                }
+                catch ( std::runtime_error const & ex )
+                {
+                    EXPECT_STREQ( expectedErrorMessage.data(), ex.what() );
+                    throw;
+                }
+            },
+            std::runtime_error
+        );
+        return;
+    }
+
+    auto const root{ A1::parseModule( mainFile ) };
+
+    std::vector< std::string_view > statements;
+    for ( auto const & statement : root->children() )
+    {
+        if ( statement != nullptr ) { statements.push_back( describe( *statement ) ); }
+    }
+    EXPECT_EQ( statements, expectedStatements );
+}
+
+INSTANTIATE_TEST_SUITE_P
+(
+    ModuleTest,
+    ModuleTestFixture,
+    ::testing::Values
+    (
+        TestParameter
+        {
+            .files =
+            {
+                { "main.ao", "import core\ndef main():\n    pass\n" }
+            },
+            .expectedStatements = { "StatementImport", "main" }
+        },
+        TestParameter
+        {
+            .files =
+            {
+                { "main.ao" , "import utils\ndef main():\n    pass\n" },
+                { "utils.ao", "def helper():\n    pass\n"              }
+            },
+            .expectedStatements = { "helper", "main" }
+        },
+        TestParameter
+        {
+            .files =
+            {
+                { "main.ao" , "import left\nimport right\ndef main():\n    pass\n" },
+                { "left.ao" , "import base\ndef left():\n    pass\n"                },
+                { "right.ao", "import base\ndef right():\n    pass\n"               },
+                { "base.ao" , "import core\ndef base():\n    pass\n"                }
+            },
+            .expectedStatements = { "StatementImport", "base", "left", "right", "main" }
+        },
+        TestParameter
+        {
+            .files =
+            {
+                { "main.ao"  , "import first\ndef main():\n    pass\n"   },
+                { "first.ao" , "import second\ndef first():\n    pass\n" },
+                { "second.ao", "import first\ndef second():\n    pass\n" }
+            },
+            .expectedErrorMessage = "Module 'first.ao' is imported circularly"
+        },
+        TestParameter
+        {
+            .files =
+            {
+                { "main.a1", "" }
+            },
+            .expectedErrorMessage = "File 'main.a1' has invalid extension. Required extension: '.ao'"
+        }
+    )
+);
@@ -0,0 +1,323 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/AST/AST.hpp>
+#include <CoreLib/Errors/SemanticError.hpp>
+#include <CoreLib/Semantic/Analyzer.hpp>
+#include <CoreLib/Tokenizer/Tokenizer.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+    struct TestParameter
+    {
+        std::string_view input;
+
+        /** Name of the type of the last statement in the module. */
+        std::string_view expectedType;
+
+        friend std::ostream & operator<<( std::ostream & os, TestParameter const & param )
+        {
+            return os << param.input;
+        }
+    };
+
+    struct AnalyzerTestFixture : ::testing::TestWithParam< TestParameter > {};
+
+    struct ErrorTestParameter
+    {
+        std::string_view input;
+        std::string_view expectedErrorMessage;
+
+        friend std::ostream & operator<<( std::ostream & os, ErrorTestParameter const & param )
+        {
+            return os << param.input;
+        }
+    };
+
+    struct AnalyzerErrorTestFixture : ::testing::TestWithParam< ErrorTestParameter > {};
+} // namespace
+
+TEST_P( AnalyzerTestFixture, typeResolution )
+{
+    auto const [ input, expectedType ]{ GetParam() };
+
+    auto token{ A1::tokenize( A1::Stream{ input } ) };
+    auto root { A1::AST::parse( token ) };
+
+    [[ maybe_unused ]] auto const symbols{ A1::Semantic::analyze( *root ) };
+
+    auto const & statements{ root->children() };
+    ASSERT_FALSE( statements.empty() );
+
+    EXPECT_EQ( A1::Registry::toStringView( statements.back()->typeID() ), expectedType );
+}
+
+INSTANTIATE_TEST_SUITE_P
+(
+    AnalyzerTest,
+    AnalyzerTestFixture,
+    ::testing::Values
+    (
+        TestParameter{ .input = "1 + 2"                      , .expectedType = "num"  },
+        TestParameter{ .input = "1 < 2"                      , .expectedType = "bool" },
+        TestParameter{ .input = "!5"                         , .expectedType = "bool" },
+        TestParameter{ .input = "-True"                      , .expectedType = "num"  },
+        TestParameter{ .input = "let x = 1\n\"foo\""         , .expectedType = "str"  },
+        TestParameter{ .input = "let x: i32 = 5\nx + x"      , .expectedType = "i32"  },
+        TestParameter{ .input = "let x: i8 = 5\nx * 2"       , .expectedType = "num"  },
+        TestParameter{ .input = "let x = \"foo\"\nx"         , .expectedType = "str"  },
+        TestParameter{ .input = "let x: u16 = 5\nx += 1"     , .expectedType = "u16"  },
+        TestParameter{ .input = "print(1)"                   , .expectedType = "null" },
+        TestParameter{ .input = "let s = \"abc\"\ns[1:3]"     , .expectedType = "str"  },
+        TestParameter{ .input = "let s = \"abc\"\ns[1]"       , .expectedType = "u8"   },
+        TestParameter{ .input = "let s = \"abc\"\nlen(s)"     , .expectedType = "u64"  },
+        TestParameter{ .input = "\"abc\"[0:2] == \"ab\""       , .expectedType = "bool" },
+        TestParameter
+        {
+            .input =
+                "def func() -> u8:\n"
+                "    return 1\n"
+                "func()",
+            .expectedType = "u8"
+        },
+        TestParameter
+        {
+            .input =
+                "let x = func()\n"
+                "def func() -> str:\n"
+                "    return \"foo\"\n"
+                "func()",
+            .expectedType = "str"
+        },
+        TestParameter
+        {
+            .input =
+                "contract Example:\n"
+                "    let name: str\n"
+                "    let count = 5\n"
+                "let var = Example()\n"
+                "var",
+            .expectedType = "Example"
+        },
+        TestParameter
+        {
+            .input =
+                "contract Example:\n"
+                "    let name: str\n"
+                "    let count = 5\n"
+                "let var = Example()\n"
+                "var.count",
+            .expectedType = "num"
+        },
+        TestParameter
+        {
+            .input =
+                "contract Example:\n"
+                "    def func(self, x: num) -> bool:\n"
+                "        return x > 5\n"
+                "let var = Example()\n"
+                "var.func(4)",
+            .expectedType = "bool"
+        }
+    )
+);
+
+TEST_P( AnalyzerErrorTestFixture, semanticError )
+{
+    auto const [ input, expectedErrorMessage ]{ GetParam() };
+
+    auto token{ A1::tokenize( A1::Stream{ input } ) };
+    auto root { A1::AST::parse( token ) };
+
+    EXPECT_THROW
+    (
+        {
+            try
+            {
+                [[ maybe_unused ]] auto const symbols{ A1::Semantic::analyze( *root ) };
+            }
+            catch ( A1::SemanticError const & ex )
+            {
+                EXPECT_STREQ( expectedErrorMessage.data(), ex.what() );
+                throw;
+            }
+        },
+        A1::SemanticError
+    );
+}
+
+INSTANTIATE_TEST_SUITE_P
+(
+    AnalyzerTest,
+    AnalyzerErrorTestFixture,
+    ::testing::Values
+    (
+        ErrorTestParameter
+        {
+            .input                = "let x: num = \"foo\"",
+            .expectedErrorMessage = "1:19: error: Cannot initialize variable 'x' of type 'num' with value of type 'str'"
+        },
+        ErrorTestParameter
+        {
+            .input                = "let x = \"foo\" + 1",
+            .expectedErrorMessage = "1:14: error: Arithmetic operation cannot be applied to value of type 'str'"
+        },
+        ErrorTestParameter
+        {
+            .input                = "let x = 5\nx = \"foo\"",
+            .expectedErrorMessage = "2:4: error: Cannot assign value of type 'str' to 'num'"
+        },
+        ErrorTestParameter
+        {
+            .input                = "let a = 1\nprint(b + a)",
+            .expectedErrorMessage = "2:8: error: Unknown identifier 'b'"
+        },
+        ErrorTestParameter
+        {
+            .input                = "x = 1",
+            .expectedErrorMessage = "1:2: error: Unknown identifier 'x'"
+        },
+        ErrorTestParameter
+        {
+            .input                = "print(nosuch(1))",
+            .expectedErrorMessage = "1:13: error: Unknown function 'nosuch'"
+        },
+        ErrorTestParameter
+        {
+            .input                = "def f():\n    pass\nprint(f())",
+            .expectedErrorMessage = "3:9: error: Cannot print value of unknown type"
+        },
+        ErrorTestParameter
+        {
+            .input                = "let a: array[num]\nprint(a)",
+            .expectedErrorMessage = "2:8: error: Cannot print value of type 'array[num]'"
+        },
+        ErrorTestParameter
+        {
+            .input                = "let s = \"abc\"\ns[0] = 1",
+            .expectedErrorMessage = "2:3: error: Left-hand side of the assignment is not assignable"
+        },
+        ErrorTestParameter
+        {
+            .input                = "let x = 5\nx == \"foo\"",
+            .expectedErrorMessage = "2:5: error: Cannot compare values of types 'num' and 'str'"
+        },
+        ErrorTestParameter
+        {
+            .input =
+                "def func(a: num) -> num:\n"
+                "    return a\n"
+                "func(1, 2)",
+            .expectedErrorMessage = "3:6: error: Function 'func' expects 1 argument(s) (2 given)"
+        },
+        ErrorTestParameter
+        {
+            .input =
+                "def func(a: num) -> num:\n"
+                "    return a\n"
+                "func(\"foo\")",
+            .expectedErrorMessage = "3:11: error: Cannot pass value of type 'str' as parameter 'a' of type 'num'"
+        },
+        ErrorTestParameter
+        {
+            .input =
+                "def func() -> num:\n"
+                "    return \"foo\"",
+            .expectedErrorMessage = "2:17: error: Cannot return value of type 'str' from function returning 'num'"
+        },
+        ErrorTestParameter
+        {
+            .input =
+                "def func():\n"
+                "    pass\n"
+                "def func():\n"
+                "    pass",
+            .expectedErrorMessage = "3:4: error: Function 'func' is already defined"
+        },
+        ErrorTestParameter
+        {
+            .input =
+                "contract Example:\n"
+                "    let name: str\n"
+                "let var = Example()\n"
+                "print(var.count)",
+            .expectedErrorMessage = "4:16: error: Contract 'Example' has no data member 'count'"
+        },
+        ErrorTestParameter
+        {
+            .input =
+                "contract Example:\n"
+                "    def func(self):\n"
+                "        pass\n"
+                "let var = Example()\n"
+                "var.func(1)",
+            .expectedErrorMessage = "5:10: error: Function 'func' expects 0 argument(s) (1 given)"
+        },
+        ErrorTestParameter
+        {
+            .input = "let m: map[str, num]",
+            .expectedErrorMessage = "1:11: error: Map key of type 'str' is not supported"
+        },
+        ErrorTestParameter
+        {
+            .input =
+                "let m: map[u8, num]\n"
+                "m[\"key\"] = 1",
+            .expectedErrorMessage = "2:8: error: Cannot index map with key of type 'u8' by value of type 'str'"
+        },
+        ErrorTestParameter
+        {
+            .input =
+                "let a: array[num]\n"
+                "a.append(\"value\")",
+            .expectedErrorMessage = "2:17: error: Cannot append value of type 'str' to 'array[num]'"
+        },
+        ErrorTestParameter
+        {
+            .input =
+                "let a: array[num]\n"
+                "a.pop()",
+            .expectedErrorMessage = "2:7: error: Type 'array[num]' has no function 'pop'"
+        },
+        ErrorTestParameter
+        {
+            .input =
+                "let a: array[num]\n"
+                "a[0:1]",
+            .expectedErrorMessage = "2:2: error: Cannot slice value of type 'array[num]'"
+        },
+        ErrorTestParameter
+        {
+            .input =
+                "let s = \"abc\"\n"
+                "s[0:\"b\"]",
+            .expectedErrorMessage = "2:8: error: Cannot index string by value of type 'str'"
+        },
+        ErrorTestParameter
+        {
+            .input = "\"a\" < \"b\"",
+            .expectedErrorMessage = "1:6: error: Strings are compared for equality only"
+        },
+        ErrorTestParameter
+        {
+            .input =
+                "let a: array[num, soa]",
+            .expectedErrorMessage = "1:13: error: Array of type 'array[num, soa]' is not supported, struct-of-arrays layout requires class elements"
+        },
+        ErrorTestParameter
+        {
+            .input =
+                "class Point:\n"
+                "    let x: num\n"
+                "let a: array[Point, soa]\n"
+                "let p = a[0]",
+            .expectedErrorMessage = "4:11: error: Element of array of type 'array[Point, soa]' is accessed by its data members only"
+        }
+    )
+);
@@ -0,0 +1,173 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/AST/AST.hpp>
+#include <CoreLib/Semantic/Analyzer.hpp>
+#include <CoreLib/Semantic/BoundsAnalysis.hpp>
+#include <CoreLib/Tokenizer/Tokenizer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string_view>
+
+namespace
+{
+    struct TestParameter
+    {
+        std::string_view input;
+
+        /** Number of the subscripts, which are proven to be in bounds. */
+        std::size_t expectedCount{ 0U };
+
+        friend std::ostream & operator<<( std::ostream & os, TestParameter const & param )
+        {
+            return os << param.input;
+        }
+    };
+
+    struct BoundsAnalysisTestFixture : ::testing::TestWithParam< TestParameter > {};
+} // namespace
+
+TEST_P( BoundsAnalysisTestFixture, analysis )
+{
+    auto const & [ input, expectedCount ]{ GetParam() };
+
+    auto token{ A1::tokenize( A1::Stream{ input } ) };
+    auto root { A1::AST::parse( token ) };
+
+    [[ maybe_unused ]] auto const symbols{ A1::Semantic::analyze( *root ) };
+
+    EXPECT_EQ( std::size( A1::Semantic::findInBoundsSubscripts( *root ) ), expectedCount );
+}
+
+INSTANTIATE_TEST_SUITE_P
+(
+    BoundsAnalysisTest,
+    BoundsAnalysisTestFixture,
+    ::testing::Values
+    (
+        TestParameter
+        {
+            .input =
+                "let a: array[num]\n"
+                "let sum = 0\n"
+                "let i = 0\n"
+                "while i < len(a):\n"
+                "    sum += a[i]\n"
+                "    a[i] = 0\n"
+                "    a.append(sum)\n"
+                "    i += 1\n",
+            .expectedCount = 2U
+        },
+        TestParameter
+        {
+            // Index is written before the subscript
+            .input =
+                "let a: array[num]\n"
+                "let i = 0\n"
+                "while i < len(a):\n"
+                "    i += 1\n"
+                "    print(a[i])\n",
+            .expectedCount = 0U
+        },
+        TestParameter
+        {
+            // Index may be negative
+            .input =
+                "let a: array[num]\n"
+                "let i = 0\n"
+                "i = i - 1\n"
+                "while i < len(a):\n"
+                "    print(a[i])\n"
+                "    i += 1\n",
+            .expectedCount = 0U
+        },
+        TestParameter
+        {
+            // Bound of the other array
+            .input =
+                "let a: array[num]\n"
+                "let b: array[num]\n"
+                "let i = 0\n"
+                "while len(b) > i:\n"
+                "    print(a[i] + b[i])\n"
+                "    i += 1\n",
+            .expectedCount = 1U
+        },
+        TestParameter
+        {
+            // Array is replaced by the call of the user-defined function
+            .input =
+                "def reset(x: num):\n"
+                "    print(x)\n"
+                "let a: array[num]\n"
+                "let i = 0\n"
+                "while i < len(a):\n"
+                "    reset(i)\n"
+                "    print(a[i])\n"
+                "    i += 1\n",
+            .expectedCount = 0U
+        },
+        TestParameter
+        {
+            // Narrow signed index wraps around to negative values, unlike the unsigned and 64-bit ones
+            .input =
+                "let a: array[num]\n"
+                "let i: i8 = 0\n"
+                "let j: u8 = 0\n"
+                "let k: i64 = 0\n"
+                "while i < len(a):\n"
+                "    print(a[i])\n"
+                "    i += 1\n"
+                "while j < len(a):\n"
+                "    print(a[j])\n"
+                "    j += 1\n"
+                "while k < len(a):\n"
+                "    print(a[k])\n"
+                "    k += 1\n",
+            .expectedCount = 2U
+        },
+        TestParameter
+        {
+            // Argument may be negative
+            .input =
+                "def sum(a: array[num], i: num) -> num:\n"
+                "    let s = 0\n"
+                "    while i < len(a):\n"
+                "        s += a[i]\n"
+                "        i += 1\n"
+                "    return s\n",
+            .expectedCount = 0U
+        },
+        TestParameter
+        {
+            .input =
+                "contract Values:\n"
+                "    let values: array[i64]\n"
+                "    def sum(self) -> i64:\n"
+                "        let s: i64 = 0\n"
+                "        let i: u64\n"
+                "        while i < len(self.values):\n"
+                "            s += self.values[i]\n"
+                "            i += 1\n"
+                "        return s\n",
+            .expectedCount = 1U
+        },
+        TestParameter
+        {
+            // String subscript is bounded as the array one, whereas the slice is always checked
+            .input =
+                "let s = \"a,b\"\n"
+                "let i = 0\n"
+                "while i < len(s):\n"
+                "    print(s[i])\n"
+                "    print(s[0:i])\n"
+                "    i += 1\n",
+            .expectedCount = 1U
+        }
+    )
+);
@@ -0,0 +1,150 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/AST/AST.hpp>
+#include <CoreLib/Semantic/Analyzer.hpp>
+#include <CoreLib/Semantic/WidthInference.hpp>
+#include <CoreLib/Tokenizer/Tokenizer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    struct TestParameter
+    {
+        std::string_view input;
+
+        /** Names of the types of the defined variables, in the order of their definitions. */
+        std::vector< std::string_view > expectedTypes{};
+
+        friend std::ostream & operator<<( std::ostream & os, TestParameter const & param )
+        {
+            return os << param.input;
+        }
+    };
+
+    void collectVariableTypes( A1::AST::Node const & node, std::vector< std::string_view > & types )
+    {
+        if ( node.is< A1::AST::NodeType >() && node.get< A1::AST::NodeType >() == A1::AST::NodeType::VariableDefinition )
+        {
+            types.push_back( A1::Registry::toStringView( node.children()[ 0U ]->typeID() ) );
+        }
+
+        for ( auto const & child : node.children() )
+        {
+            if ( child != nullptr ) { collectVariableTypes( *child, types ); }
+        }
+    }
+
+    struct WidthInferenceTestFixture : ::testing::TestWithParam< TestParameter > {};
+} // namespace
+
+TEST_P( WidthInferenceTestFixture, inference )
+{
+    auto const & [ input, expectedTypes ]{ GetParam() };
+
+    auto token{ A1::tokenize( A1::Stream{ input } ) };
+    auto root { A1::AST::parse( token ) };
+
+    [[ maybe_unused ]] auto const symbols{ A1::Semantic::analyze( *root ) };
+    A1::Semantic::inferIntegerWidths( *root );
+
+    std::vector< std::string_view > types;
+    collectVariableTypes( *root, types );
+
+    EXPECT_EQ( types, expectedTypes );
+}
+
+INSTANTIATE_TEST_SUITE_P
+(
+    WidthInferenceTest,
+    WidthInferenceTestFixture,
+    ::testing::Values
+    (
+        TestParameter
+        {
+            .input =
+                "let a = 5\n"
+                "let b = -200\n"
+                "let c = 100000\n"
+                "let d = 10000000000\n"
+                "let e = \"str\"\n"
+                "let f: num = 5\n",
+            .expectedTypes = { "i8", "i16", "i32", "num", "str", "num" }
+        },
+        TestParameter
+        {
+            .input =
+                "let a = 5\n"
+                "let b = 5\n"
+                "a = 1000\n"
+                "b = a\n",
+            .expectedTypes = { "i16", "num" }
+        },
+        TestParameter
+        {
+            .input =
+                "let i = 0\n"
+                "while i < 127:\n"
+                "    i += 1\n",
+            .expectedTypes = { "i8" }
+        },
+        TestParameter
+        {
+            .input =
+                "let i = 0\n"
+                "while i < 128:\n"
+                "    i += 1\n",
+            .expectedTypes = { "i16" }
+        },
+        TestParameter
+        {
+            .input =
+                "let i = 100\n"
+                "while i >= 0:\n"
+                "    i -= 1\n",
+            .expectedTypes = { "i8" }
+        },
+        TestParameter
+        {
+            // Loop which does not bound the variable, or writes it more than once per iteration
+            .input =
+                "let i = 0\n"
+                "let j = 0\n"
+                "let k = 0\n"
+                "while k < 10:\n"
+                "    i += 1\n"
+                "    j += 1\n"
+                "    j += 1\n"
+                "    k += 1\n",
+            .expectedTypes = { "num", "num", "i8" }
+        },
+        TestParameter
+        {
+            .input =
+                "let i = 0\n"
+                "i *= 2\n"
+                "let j = 0\n"
+                "j += 3\n",
+            .expectedTypes = { "num", "i8" }
+        },
+        TestParameter
+        {
+            .input =
+                "def func(x: num) -> num:\n"
+                "    let i = 0\n"
+                "    let y = x\n"
+                "    while i < 10:\n"
+                "        i += 1\n"
+                "    return i\n",
+            .expectedTypes = { "i8", "num" }
+        }
+    )
+);
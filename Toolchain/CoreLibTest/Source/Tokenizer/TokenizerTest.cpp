@@ -62,6 +62,19 @@ INSTANTIATE_TEST_SUITE_P
             }
         },
         TestParameter
+        {
+            .expression     = "price = 1.25 * 0.5",
+            .expectedTokens =
+            {
+                A1::Identifier{ .name = "price" },
+                A1::ReservedToken::OpAssign,
+                A1::Number{ .value = 125, .decimals = 2U },
+                A1::ReservedToken::OpMul,
+                A1::Number{ .value = 5, .decimals = 1U },
+                A1::Eof{}
+            }
+        },
+        TestParameter
         {
             .expression     = "if var == \"foo\":",
             .expectedTokens =
@@ -562,6 +575,11 @@ INSTANTIATE_TEST_SUITE_P
             .expectedErrorMessage = "1:11: error: Missing closing quote"
         },
         ErrorTestParameter
+        {
+            .expression           = "var = 0.1234567",
+            .expectedErrorMessage = "1:16: error: Number has more decimal places than num can hold"
+        },
+        ErrorTestParameter
         {
             .expression =
                 "var1 = 5\n"
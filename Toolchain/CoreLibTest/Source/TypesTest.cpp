@@ -0,0 +1,145 @@
+/**
+ *
+ * Copyright (c)2022 The Adamnite C++ Authors.
+ *
+ * This code is open-sourced under the MIT license.
+ */
+
+#include <CoreLib/AST/AST.hpp>
+#include <CoreLib/Tokenizer/Tokenizer.hpp>
+#include <CoreLib/Types.hpp>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace A1;
+
+    struct TestParameter
+    {
+        /** Type annotation as written in the source code. */
+        std::string_view input;
+
+        std::string_view expectedName;
+
+        friend std::ostream & operator<<( std::ostream & os, TestParameter const & param )
+        {
+            return os << param.input;
+        }
+    };
+
+    struct TypesTestFixture : ::testing::TestWithParam< TestParameter > {};
+
+    [[ nodiscard ]]
+    TypeID parseType( std::string_view const annotation )
+    {
+        auto const source{ fmt::format( "let x: {}", annotation ) };
+
+        auto token{ tokenize( Stream{ std::string_view{ source } } ) };
+        auto root { AST::parse( token ) };
+
+        auto const & definition{ root->children()[ 0U ]->children() };
+        return definition[ 1U ]->get< TypeID >();
+    }
+} // namespace
+
+TEST_P( TypesTestFixture, interning )
+{
+    auto const [ input, expectedName ]{ GetParam() };
+
+    auto const typeID{ parseType( input ) };
+
+    ASSERT_NE( typeID, nullptr );
+    EXPECT_EQ( typeID, parseType( input ) );
+    EXPECT_EQ( Registry::toStringView( typeID ), expectedName );
+    EXPECT_EQ( Registry::getHandle( *typeID ), typeID );
+}
+
+INSTANTIATE_TEST_SUITE_P
+(
+    TypesTest,
+    TypesTestFixture,
+    ::testing::Values
+    (
+        TestParameter{ .input = "num"          , .expectedName = "num"          },
+        TestParameter{ .input = "array[u8]"    , .expectedName = "array[u8]"    },
+        TestParameter{ .input = "array[str]"   , .expectedName = "array[str]"   },
+        TestParameter{ .input = "map[str, num]", .expectedName = "map[str, num]" },
+        TestParameter{ .input = "map[num, str]", .expectedName = "map[num, str]" },
+        TestParameter{ .input = "array[array[u8]]"    , .expectedName = "array[array[u8]]"     },
+        TestParameter{ .input = "array[Proposal]"     , .expectedName = "array[Proposal]"      },
+        TestParameter{ .input = "array[Proposal, soa]", .expectedName = "array[Proposal, soa]" },
+        TestParameter{ .input = "map[address, Voter]" , .expectedName = "map[address, Voter]"  }
+    )
+);
+
+TEST( TypesTest, structuralEquality )
+{
+    using namespace Registry;
+
+    EXPECT_NE( getArrayHandle( getNumHandle() ), getArrayHandle( getStrHandle() ) );
+    EXPECT_NE( getMapHandle( getNumHandle(), getStrHandle() ), getMapHandle( getStrHandle(), getNumHandle() ) );
+    EXPECT_EQ( getArrayHandle( getArrayHandle( getI8Handle() ) ), getArrayHandle( getArrayHandle( getI8Handle() ) ) );
+    EXPECT_EQ( getArrayHandle( nullptr ), nullptr );
+    EXPECT_NE( getArrayHandle( getNumHandle() ), getArrayHandle( getNumHandle(), ArrayLayout::StructOfArrays ) );
+
+    auto const function{ getFunctionHandle( getBoolHandle(), { getNumHandle(), getStrHandle() } ) };
+    EXPECT_EQ( function, getFunctionHandle( getBoolHandle(), { getNumHandle(), getStrHandle() } ) );
+    EXPECT_NE( function, getFunctionHandle( getBoolHandle(), { getStrHandle(), getNumHandle() } ) );
+    EXPECT_NE( function, getFunctionHandle( nullptr, { getNumHandle(), getStrHandle() } ) );
+    EXPECT_EQ( toStringView( function ), "def(num, str) -> bool" );
+    EXPECT_EQ( toStringView( getFunctionHandle( nullptr, {} ) ), "def()" );
+
+    EXPECT_EQ( getContractHandle( "Example" ), getHandle( ContractType{ .name = "Example" } ) );
+}
+
+TEST( TypesTest, denseIndices )
+{
+    using namespace Registry;
+
+    EXPECT_EQ( getIndex( nullptr ), 0U );
+    EXPECT_EQ( getIndex( getNumHandle() ), static_cast< std::size_t >( PrimitiveType::Num ) );
+    EXPECT_EQ( getIndex( getU64Handle() ), static_cast< std::size_t >( PrimitiveType::U64 ) );
+    EXPECT_EQ( getIndex( getU256Handle() ), static_cast< std::size_t >( PrimitiveType::U256 ) );
+
+    auto const array{ getArrayHandle( getI32Handle() ) };
+    auto const map  { getMapHandle( getStrHandle(), array ) };
+
+    EXPECT_GE( getIndex( array ), static_cast< std::size_t >( PrimitiveType::Count ) );
+    EXPECT_GE( getIndex( map   ), static_cast< std::size_t >( PrimitiveType::Count ) );
+    EXPECT_NE( getIndex( array ), getIndex( map ) );
+    EXPECT_EQ( getIndex( map ), getIndex( getMapHandle( getStrHandle(), array ) ) );
+}
+
+TEST( TypesTest, concurrentInterning )
+{
+    static constexpr auto threadsCount{ 8U };
+
+    std::vector< std::vector< TypeID > > results( threadsCount );
+    std::vector< std::thread > threads;
+    for ( auto i{ 0U }; i < threadsCount; ++i )
+    {
+        threads.emplace_back
+        (
+            [ &result = results[ i ] ]
+            {
+                auto inner{ Registry::getU16Handle() };
+                for ( auto depth{ 0U }; depth < 100U; ++depth )
+                {
+                    inner = Registry::getArrayHandle( inner );
+                    result.push_back( Registry::getMapHandle( inner, Registry::getStrHandle() ) );
+                }
+            }
+        );
+    }
+    for ( auto & thread : threads ) { thread.join(); }
+
+    for ( auto const & result : results )
+    {
+        EXPECT_EQ( result, results.front() );
+    }
+}